@@ -16,9 +16,23 @@
 #include "../TUI/TUIKit/external/ftxui-image-view/include/image_view.hpp"
 
 using namespace ftxui;
-std::map<int, PlantComponent *> treeIndexToComponent;
-std::vector<std::string> treeEntries;
-int selectedTreeIndex = -1;
+
+// One row of the flattened inventory hierarchy. Rows are cheap to keep for the
+// whole tree; only the rows inside the visible window are formatted to text.
+struct TreeRow
+{
+    PlantComponent *component;
+    int depth;
+};
+
+const int TREE_VISIBLE_ROWS = 15;
+std::vector<TreeRow> treeRows;
+PlantComponent *treeRowsRoot = nullptr;
+unsigned long treeRowsVersion = 0;
+bool treeRowsBuilt = false;
+int treeWindowStart = 0;
+std::vector<std::string> treeEntries; // formatted rows of the visible window only
+int selectedTreeIndex = -1;           // index within the visible window
 int previousSelectedTreeIndex = -1;
 PlantComponent *selectedInventoryComponent = nullptr;
 
@@ -70,45 +84,81 @@ Element &getImage(const std::string &id)
     return cache[id] = image_view(id);
 }
 
-void buildTreeEntries(
-    PlantComponent *component,
-    std::vector<std::string> &entries,
-    std::map<int, PlantComponent *> &indexMap,
-    int depth = 0)
+void buildTreeRows(PlantComponent *component, std::vector<TreeRow> &rows, int depth = 0)
 {
     if (!component)
         return;
 
-    int currentIndex = entries.size();
-    std::string indent(depth * 2, ' ');
-    std::string prefix = depth > 0 ? "├─ " : "📦 ";
+    rows.push_back({component, depth});
 
-    std::string icon = "";
     if (component->getType() == ComponentType::PLANT_GROUP)
     {
-        icon = "📁 ";
-    }
-    else
-    {
-        icon = "🌱 ";
+        PlantGroup *group = static_cast<PlantGroup *>(component);
+        for (PlantComponent *child : *group->getPlants())
+        {
+            buildTreeRows(child, rows, depth + 1);
+        }
     }
+}
+
+std::string formatTreeRow(const TreeRow &row)
+{
+    std::string indent(row.depth * 2, ' ');
+    std::string prefix = row.depth > 0 ? "├─ " : "📦 ";
+    std::string icon = row.component->getType() == ComponentType::PLANT_GROUP ? "📁 " : "🌱 ";
 
-    entries.push_back(indent + prefix + icon + component->getName());
-    indexMap[currentIndex] = component;
+    return indent + prefix + icon + row.component->getNameView();
+}
 
-    if (component->getType() == ComponentType::PLANT_GROUP)
+// Rows hold raw component pointers, so they are rebuilt before any row is read
+// once the composite structure has changed (a plant sold, removed or destroyed).
+// Returns true if the rows were rebuilt.
+bool syncTreeRows(bool force = false)
+{
+    unsigned long version = PlantGroup::getStructureVersion();
+    if (!force && treeRowsBuilt && version == treeRowsVersion)
+        return false;
+
+    treeRows.clear();
+    buildTreeRows(treeRowsRoot, treeRows);
+    treeRowsVersion = version;
+    treeRowsBuilt = true;
+    return true;
+}
+
+void fillTreeWindow()
+{
+    syncTreeRows();
+
+    int maxStart = std::max(0, static_cast<int>(treeRows.size()) - TREE_VISIBLE_ROWS);
+    treeWindowStart = std::max(0, std::min(treeWindowStart, maxStart));
+
+    int windowEnd = std::min(static_cast<int>(treeRows.size()), treeWindowStart + TREE_VISIBLE_ROWS);
+    treeEntries.clear();
+    for (int i = treeWindowStart; i < windowEnd; i++)
     {
-        PlantGroup *group = dynamic_cast<PlantGroup *>(component);
-        if (group)
-        {
-            std::list<PlantComponent *> children = *group->getPlants();
-            for (PlantComponent *child : children)
-            {
-                buildTreeEntries(child, entries, indexMap, depth + 1);
-            }
-        }
+        treeEntries.push_back(formatTreeRow(treeRows[i]));
     }
 }
+
+PlantComponent *treeComponentAt(int windowIndex)
+{
+    if (syncTreeRows())
+        fillTreeWindow();
+
+    if (windowIndex < 0 || windowIndex >= static_cast<int>(treeEntries.size()))
+        return nullptr;
+    return treeRows[treeWindowStart + windowIndex].component;
+}
+
+// Shifts the visible window by delta rows; returns false at either end of the tree.
+bool scrollTreeWindow(int delta)
+{
+    int previousStart = treeWindowStart;
+    treeWindowStart += delta;
+    fillTreeWindow();
+    return treeWindowStart != previousStart;
+}
 string getFilter(NurseryFacade &nursery, int index, bool seasonsFilter)
 {
     vector<string> names;
@@ -120,27 +170,24 @@ string getFilter(NurseryFacade &nursery, int index, bool seasonsFilter)
     return names[index];
 }
 
-void refreshInventoryView(NurseryFacade &nursery)
+// Rebuilds the flattened rows only when the composite structure changed since the
+// last build (or when forced), then formats just the visible window.
+void refreshInventoryView(NurseryFacade &nursery, bool force = false)
 {
-    treeEntries.clear();
-    treeIndexToComponent.clear();
-
     selectedInfoText = "Select an item in the inventory.";
     inventoryStatusText = "Inventory refreshed.";
 
     PlantComponent *root = nursery.getInventoryRoot();
-    if (root)
-    {
-        buildTreeEntries(root, treeEntries, treeIndexToComponent);
-    }
+    bool rootChanged = root != treeRowsRoot;
+    treeRowsRoot = root;
+    syncTreeRows(force || rootChanged);
+
+    fillTreeWindow();
 
-    if (selectedTreeIndex >= 0 && selectedTreeIndex < static_cast<int>(treeEntries.size()))
+    PlantComponent *selected = treeComponentAt(selectedTreeIndex);
+    if (selected)
     {
-        auto it = treeIndexToComponent.find(selectedTreeIndex);
-        if (it != treeIndexToComponent.end())
-        {
-            selectedInventoryComponent = it->second;
-        }
+        selectedInventoryComponent = selected;
     }
 }
 
@@ -214,7 +261,7 @@ int main()
         } });
 
     auto refreshButton = Button("Refresh", [&]
-                                { refreshInventoryView(nursery); });
+                                { refreshInventoryView(nursery, true); });
 
     auto startTickButton = Button("Start Simulating", [&]
                                   {
@@ -287,11 +334,10 @@ int main()
                 if (group && comp != nursery.getInventoryRoot() && comp != componentToMove)
                 {
                     std::string indent(depth * 2, ' ');
-                    groupList.push_back(indent + "└─ " + comp->getName());
+                    groupList.push_back(indent + "└─ " + comp->getNameView());
                     groupComponents.push_back(comp);
 
-                    std::list<PlantComponent *> children = *group->getPlants();
-                    for (PlantComponent *child : children)
+                    for (PlantComponent *child : *group->getPlants())
                     {
                         findGroups(child, depth + 1);
                     }
@@ -301,9 +347,8 @@ int main()
 
         if (root && root->getType() == ComponentType::PLANT_GROUP)
         {
-            PlantGroup *rootGroup = dynamic_cast<PlantGroup *>(root);
-            std::list<PlantComponent *> children = *rootGroup->getPlants();
-            for (PlantComponent *child : children)
+            PlantGroup *rootGroup = static_cast<PlantGroup *>(root);
+            for (PlantComponent *child : *rootGroup->getPlants())
             {
                 findGroups(child, 1);
             }
@@ -355,31 +400,48 @@ int main()
 
     auto on_menu_change = [&]
     {
-        if (selectedTreeIndex >= 0 && selectedTreeIndex < static_cast<int>(treeEntries.size()))
+        PlantComponent *selected = treeComponentAt(selectedTreeIndex);
+        if (selected)
         {
-            auto it = treeIndexToComponent.find(selectedTreeIndex);
-            if (it != treeIndexToComponent.end())
-            {
-                selectedInventoryComponent = it->second;
+            selectedInventoryComponent = selected;
 
-                if (selectedInventoryComponent->getType() == ComponentType::PLANT_GROUP)
-                {
-                    selectedInfoText = selectedInventoryComponent->getInfo();
-                }
-                else
-                {
-                    selectedInfoText = selectedInventoryComponent->getDecorator()->getInfo();
-                }
-
-                inventoryStatusText = "Status: Selected item in Inventory.";
+            if (selectedInventoryComponent->getType() == ComponentType::PLANT_GROUP)
+            {
+                selectedInfoText = selectedInventoryComponent->getInfo();
             }
+            else
+            {
+                selectedInfoText = selectedInventoryComponent->getDecorator()->getInfo();
+            }
+
+            inventoryStatusText = "Status: Selected item in Inventory.";
         }
     };
 
     MenuOption menuOption;
     menuOption.on_change = on_menu_change;
 
-    auto treeMenu = Menu(&treeEntries, &selectedTreeIndex, menuOption);
+    // The menu only holds the visible window; moving past its edges scrolls the
+    // window over treeRows instead of letting the menu own every row.
+    auto treeMenu = Menu(&treeEntries, &selectedTreeIndex, menuOption) | CatchEvent([&](Event event)
+                                                                                    {
+        int lastRow = static_cast<int>(treeEntries.size()) - 1;
+        int delta = 0;
+        if (event == Event::ArrowDown && selectedTreeIndex == lastRow)
+            delta = 1;
+        else if (event == Event::ArrowUp && selectedTreeIndex == 0)
+            delta = -1;
+        else if (event == Event::PageDown)
+            delta = TREE_VISIBLE_ROWS;
+        else if (event == Event::PageUp)
+            delta = -TREE_VISIBLE_ROWS;
+
+        if (delta == 0 || !scrollTreeWindow(delta))
+            return false;
+
+        selectedTreeIndex = std::max(0, std::min(selectedTreeIndex, static_cast<int>(treeEntries.size()) - 1));
+        on_menu_change();
+        return true; });
 
     string userName = "";
     Customer *currentCustomer = nullptr;
@@ -0,0 +1,110 @@
+#include "BenchHarness.h"
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+BenchHarness::BenchHarness()
+	: minTimeNs(200e6), sink(0.0)
+{
+}
+
+bool BenchHarness::parse(int argc, char **argv)
+{
+	for (int i = 1; i < argc; i++)
+	{
+		bool hasValue = i + 1 < argc;
+		if (std::strcmp(argv[i], "--filter") == 0 && hasValue)
+			filter = argv[++i];
+		else if (std::strcmp(argv[i], "--min-time") == 0 && hasValue)
+			minTimeNs = std::atof(argv[++i]) * 1e6;
+		else if (std::strcmp(argv[i], "--json") == 0 && hasValue)
+			jsonPath = argv[++i];
+		else
+		{
+			std::cerr << "usage: " << argv[0] << " [--filter <text>] [--min-time <ms>] [--json <path|->]" << std::endl;
+			return false;
+		}
+	}
+	return true;
+}
+
+bool BenchHarness::selected(const std::string &name) const
+{
+	return filter.empty() || name.find(filter) != std::string::npos;
+}
+
+void BenchHarness::record(const std::string &name, uint64_t iterations, double nanos, uint64_t allocations, uint64_t itemsPerOp)
+{
+	BenchResult result;
+	result.name = name;
+	result.iterations = iterations;
+	result.nsPerOp = nanos / iterations;
+	result.allocationsPerOp = (double)allocations / iterations;
+	result.itemsPerOp = itemsPerOp;
+	result.itemsPerSecond = nanos > 0 ? (double)itemsPerOp * iterations * 1e9 / nanos : 0.0;
+	results.push_back(result);
+
+	std::cout << std::left << std::setw(36) << name << std::right << std::fixed << std::setprecision(1)
+			  << std::setw(14) << result.nsPerOp << " ns/op"
+			  << std::setw(10) << std::setprecision(2) << result.allocationsPerOp << " allocs/op"
+			  << std::setw(14) << std::setprecision(0) << result.itemsPerSecond << " items/s" << std::endl;
+}
+
+void BenchHarness::metric(const std::string &name, double value)
+{
+	metrics.push_back(std::make_pair(name, value));
+	std::cout << std::left << std::setw(36) << name << std::right << std::fixed << std::setprecision(1)
+			  << std::setw(14) << value << std::endl;
+}
+
+const std::vector<BenchResult> &BenchHarness::getResults() const
+{
+	return results;
+}
+
+void BenchHarness::writeJson(std::ostream &out) const
+{
+	// Names are "<area>/<case>" literals from the suite, so no escaping is needed
+	out << "{\n  \"schema\": 1,\n  \"benchmarks\": [";
+	for (std::size_t i = 0; i < results.size(); i++)
+	{
+		const BenchResult &result = results[i];
+		out << (i == 0 ? "\n" : ",\n")
+			<< "    {\"name\": \"" << result.name << "\""
+			<< ", \"iterations\": " << result.iterations
+			<< std::fixed << std::setprecision(3)
+			<< ", \"ns_per_op\": " << result.nsPerOp
+			<< ", \"allocs_per_op\": " << result.allocationsPerOp
+			<< ", \"items_per_op\": " << result.itemsPerOp
+			<< ", \"items_per_second\": " << result.itemsPerSecond << "}";
+	}
+	out << "\n  ],\n  \"metrics\": {";
+	for (std::size_t i = 0; i < metrics.size(); i++)
+	{
+		out << (i == 0 ? "\n" : ",\n") << "    \"" << metrics[i].first << "\": "
+			<< std::fixed << std::setprecision(3) << metrics[i].second;
+	}
+	out << "\n  }\n}\n";
+}
+
+bool BenchHarness::finish() const
+{
+	if (jsonPath.empty())
+		return true;
+	if (jsonPath == "-")
+	{
+		writeJson(std::cout);
+		return true;
+	}
+
+	std::ofstream out(jsonPath.c_str(), std::ios::trunc);
+	if (!out)
+	{
+		std::cerr << "Could not write " << jsonPath << std::endl;
+		return false;
+	}
+	writeJson(out);
+	return true;
+}
@@ -0,0 +1,133 @@
+#ifndef PHOTOSYNTECH_BENCHHARNESS_H
+#define PHOTOSYNTECH_BENCHHARNESS_H
+
+#include "diagnostics/AllocationTracker.h"
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief One measured benchmark.
+ */
+struct BenchResult
+{
+	std::string name;
+	uint64_t iterations;
+	double nsPerOp;
+	double allocationsPerOp;
+	uint64_t itemsPerOp;	///< Work units (plants, lookups...) processed by one op
+	double itemsPerSecond;
+};
+
+/**
+ * @brief Minimal microbenchmark runner with stable JSON output.
+ *
+ * Each benchmark is a callable run in batches whose size doubles until one
+ * batch takes at least the minimum time; the last batch is reported. Results
+ * carry ns/op, heap allocations/op and throughput, and are written as JSON in
+ * registration order so successive runs can be diffed for regression tracking.
+ * Figures that are not timings, such as memory footprints, go under "metrics".
+ *
+ * Command line (see parse()):
+ * - --filter <text>   only run benchmarks whose name contains text
+ * - --min-time <ms>   minimum batch duration (default 200)
+ * - --json <path>     also write results as JSON ("-" for stdout)
+ *
+ * @see core_bench.cpp (the suite)
+ */
+class BenchHarness
+{
+	public:
+		BenchHarness();
+
+		/**
+		 * @brief Reads options from the command line.
+		 * @return False if the arguments were invalid (usage has been printed).
+		 */
+		bool parse(int argc, char **argv);
+
+		/**
+		 * @brief Checks whether a benchmark is selected by --filter.
+		 *
+		 * Lets the suite skip expensive setup (e.g. a million-plant inventory)
+		 * for benchmarks that will not run.
+		 */
+		bool selected(const std::string &name) const;
+
+		/**
+		 * @brief Measures op, which must perform one unit of work per call.
+		 * @param name Stable benchmark name, "<area>/<case>".
+		 * @param itemsPerOp Work units processed per call, for throughput.
+		 * @param op Callable; its return value is accumulated so it cannot be optimised out.
+		 */
+		template <typename Op>
+		void run(const std::string &name, uint64_t itemsPerOp, Op op);
+
+		/**
+		 * @brief Records a non-timing figure (e.g. bytes per plant) for the JSON output.
+		 * @param name Stable metric name, "<area>/<figure>".
+		 */
+		void metric(const std::string &name, double value);
+
+		/**
+		 * @brief Gets the results measured so far.
+		 */
+		const std::vector<BenchResult> &getResults() const;
+
+		/**
+		 * @brief Writes the results as JSON (schema version 1).
+		 */
+		void writeJson(std::ostream &out) const;
+
+		/**
+		 * @brief Writes the JSON file requested with --json, if any.
+		 * @return False if the file could not be written.
+		 */
+		bool finish() const;
+
+	private:
+		void record(const std::string &name, uint64_t iterations, double nanos, uint64_t allocations, uint64_t itemsPerOp);
+
+		std::string filter;
+		std::string jsonPath;
+		double minTimeNs;
+		std::vector<BenchResult> results;
+		std::vector<std::pair<std::string, double> > metrics;
+		double sink;
+};
+
+template <typename Op>
+void BenchHarness::run(const std::string &name, uint64_t itemsPerOp, Op op)
+{
+	if (!selected(name))
+		return;
+
+	// Warm up once so lazily built caches are not charged to the first batch
+	sink += (double)op();
+
+	uint64_t iterations = 1;
+	for (;;)
+	{
+		uint64_t allocationsBefore = AllocationTracker::getTotalCounts().allocations;
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		for (uint64_t i = 0; i < iterations; i++)
+		{
+			sink += (double)op();
+		}
+		std::chrono::steady_clock::time_point stop = std::chrono::steady_clock::now();
+		uint64_t allocations = AllocationTracker::getTotalCounts().allocations - allocationsBefore;
+
+		double nanos = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count();
+		if (nanos >= minTimeNs || iterations >= (1ull << 30))
+		{
+			record(name, iterations, nanos, allocations, itemsPerOp);
+			return;
+		}
+		iterations *= 2;
+	}
+}
+
+#endif //PHOTOSYNTECH_BENCHHARNESS_H
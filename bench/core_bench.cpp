@@ -0,0 +1,407 @@
+/**
+ * @file core_bench.cpp
+ * @brief Microbenchmark suite for the nursery's core operations.
+ *
+ * Covers builder construction per plant type, cloning decorated plants,
+ * PlantGroup::tick at 1k/100k/1M plants, iterator traversal, season and name
+ * filtering, flyweight lookups, info rendering, the facade calls the TUI makes and generated
+ * workloads (nested groups, mixed types, staff observers), plus the memory
+ * footprint of a generated million-plant nursery. Each case
+ * reports ns/op, heap allocations/op and throughput; --json writes the same
+ * numbers in a stable format for regression tracking.
+ *
+ * Usage: make bench [BENCH_ARGS="--filter tick --json bench.json"]
+ */
+
+#include "BenchHarness.h"
+#include "builder/Director.h"
+#include "builder/SunflowerBuilder.h"
+#include "builder/RoseBuilder.h"
+#include "builder/JadePlantBuilder.h"
+#include "builder/MapleBuilder.h"
+#include "builder/CactusBuilder.h"
+#include "builder/CherryBlossomBuilder.h"
+#include "builder/LavenderBuilder.h"
+#include "builder/PineBuilder.h"
+#include "builder/ParallelBuild.h"
+#include "composite/InfoBuffer.h"
+#include "composite/InfoSink.h"
+#include "composite/PlantGroup.h"
+#include "diagnostics/MemoryReport.h"
+#include "diagnostics/WorkloadGenerator.h"
+#include "facade/NurseryFacade.h"
+#include "iterator/AggPlant.h"
+#include "iterator/AggPlantName.h"
+#include "iterator/AggSeason.h"
+#include "iterator/Iterator.h"
+#include "iterator/PlantQuery.h"
+#include "iterator/PlantRange.h"
+#include "singleton/Singleton.h"
+#include "state/Seed.h"
+#include "strategy/MidWater.h"
+#include <iostream>
+
+namespace
+{
+	/**
+	 * @brief Builds one plant of a type through its builder, as the facade does.
+	 */
+	template <typename ConcreteBuilder>
+	PlantComponent *buildPlant()
+	{
+		ConcreteBuilder builder;
+		Director director(&builder);
+		director.construct();
+		return director.getPlant();
+	}
+
+	template <typename ConcreteBuilder>
+	void benchBuilder(BenchHarness &harness, const std::string &type)
+	{
+		harness.run("builder/" + type, 1, []()
+					{
+						PlantComponent *plant = buildPlant<ConcreteBuilder>();
+						delete plant;
+						return 1; });
+	}
+
+	/**
+	 * @brief Bulk builds of 20k roses: one Director per plant, then ParallelBuild at rising thread counts.
+	 *
+	 * serial vs 1t measures cloning instead of rebuilding; only 1t vs the
+	 * higher counts says anything about threads, and only on a multi-core host.
+	 */
+	void benchParallelBuild(BenchHarness &harness)
+	{
+		if (!harness.selected("build/"))
+			return;
+
+		const std::size_t plantCount = 20000;
+		const Species &rose = SpeciesCatalog::get(SpeciesCatalog::ROSE);
+		harness.run("build/rose_20k_serial", plantCount, [plantCount]()
+					{
+						for (std::size_t i = 0; i < plantCount; i++)
+							delete buildPlant<RoseBuilder>();
+						return 1; });
+
+		const unsigned threadCounts[] = {1, 2, 4, 8};
+		for (unsigned threads : threadCounts)
+		{
+			ParallelBuild parallel(threads);
+			harness.run("build/rose_20k_" + std::to_string(threads) + "t", plantCount, [&parallel, &rose, plantCount]()
+						{
+							std::vector<PlantComponent *> plants = parallel.build(rose, plantCount);
+							for (PlantComponent *plant : plants)
+								delete plant;
+							return 1; });
+		}
+	}
+
+	/**
+	 * @brief Fills a root group with plants cloned from builder output, spread over nested groups.
+	 */
+	PlantGroup *buildInventory(int plantCount)
+	{
+		PlantComponent *templates[3] = {buildPlant<RoseBuilder>(), buildPlant<CactusBuilder>(), buildPlant<PineBuilder>()};
+
+		PlantGroup *root = new PlantGroup();
+		PlantGroup *group = nullptr;
+		for (int p = 0; p < plantCount; p++)
+		{
+			if (p % 1000 == 0)
+			{
+				group = new PlantGroup();
+				root->addComponent(group);
+			}
+			group->addComponent(templates[p % 3]->getDecorator()->clone());
+		}
+
+		for (PlantComponent *plant : templates)
+			delete plant;
+		return root;
+	}
+
+	void benchTick(BenchHarness &harness, const std::string &name, int plantCount)
+	{
+		if (!harness.selected(name))
+			return;
+
+		PlantGroup *root = buildInventory(plantCount);
+		harness.run(name, (uint64_t)plantCount, [root]()
+					{
+						root->tick();
+						return 1; });
+		delete root;
+	}
+
+	void benchCare(BenchHarness &harness, const std::string &suffix, int plantCount)
+	{
+		if (!harness.selected("care/"))
+			return;
+
+		// Levels saturate after a few rounds; the clamping still runs for every plant
+		PlantGroup *root = buildInventory(plantCount);
+		harness.run("care/group_water_" + suffix, plantCount, [root]()
+					{
+						root->water();
+						return 1; });
+		harness.run("care/group_set_outside_" + suffix, plantCount, [root]()
+					{
+						root->setOutside();
+						return 1; });
+		delete root;
+	}
+
+	void benchTraversal(BenchHarness &harness)
+	{
+		const int plantCount = 100000;
+		if (!harness.selected("iterate/") && !harness.selected("filter/"))
+			return;
+
+		PlantGroup *root = buildInventory(plantCount);
+		std::list<PlantComponent *> *plants = root->getPlants();
+
+		harness.run("iterate/plant_range_100k", plantCount, [plants]()
+					{
+						long visited = 0;
+						for (LivingPlant *plant : PlantRange(plants))
+							visited += plant->getHealth() >= 0;
+						return visited; });
+
+		harness.run("iterate/plant_iterator_100k", plantCount, [plants]()
+					{
+						long visited = 0;
+						AggPlant aggregate(plants);
+						Iterator *itr = aggregate.createIterator();
+						for (; !itr->isDone(); itr->next())
+							visited += itr->currentItem()->getHealth() >= 0;
+						delete itr;
+						return visited; });
+
+		harness.run("filter/season_iterator_100k", plantCount, [plants]()
+					{
+						long matched = 0;
+						AggSeason aggregate(plants, "Spring Season");
+						Iterator *itr = aggregate.createIterator();
+						for (; !itr->isDone(); itr->next())
+							matched++;
+						delete itr;
+						return matched; });
+
+		harness.run("filter/name_iterator_100k", plantCount, [plants]()
+					{
+						long matched = 0;
+						AggPlantName aggregate(plants, "Rose");
+						Iterator *itr = aggregate.createIterator();
+						for (; !itr->isDone(); itr->next())
+							matched++;
+						delete itr;
+						return matched; });
+
+		harness.run("filter/query_state_100k", plantCount, [plants]()
+					{ return (long)PlantQuery(plants).state(Seed::getID()).count(); });
+
+		delete root;
+	}
+
+	void benchFlyweights(BenchHarness &harness)
+	{
+		Inventory *inv = Inventory::getInstance();
+
+		harness.run("flyweight/get_string", 1, [inv]()
+					{ return inv->getString("Spring Season") != nullptr; });
+
+		harness.run("flyweight/get_water_strategy", 1, [inv]()
+					{ return inv->getWaterFly(MidWater::getID()) != nullptr; });
+
+		harness.run("flyweight/get_state", 1, [inv]()
+					{ return inv->getStates(Seed::getID()) != nullptr; });
+	}
+
+	/**
+	 * @brief Renders plant and group info the way a TUI redraw does: cached, into a kept buffer.
+	 */
+	void benchInfo(BenchHarness &harness)
+	{
+		if (!harness.selected("info/"))
+			return;
+
+		PlantGroup *root = buildInventory(1000);
+		PlantGroup *group = static_cast<PlantGroup *>(root->getPlants()->front());
+		PlantComponent *plant = group->getPlants()->front()->getDecorator();
+
+		harness.run("info/plant_get_info", 1, [plant]()
+					{ return plant->getInfo().size(); });
+
+		InfoBuffer buffer;
+		harness.run("info/plant_write_info", 1, [plant, &buffer]()
+					{
+						buffer.clear();
+						plant->writeInfo(buffer);
+						return buffer.size(); });
+
+		harness.run("info/group_write_info_1k", 1000, [group, &buffer]()
+					{
+						buffer.clear();
+						group->writeInfo(buffer);
+						return buffer.size(); });
+
+		// Streamed to a sink that only counts: one chunk buffer, whatever the group's size
+		uint64_t streamed = 0;
+		CallbackInfoSink counter([&streamed](const char *, std::size_t length)
+								 { streamed += length; });
+		harness.run("info/group_stream_info_1k", 1000, [group, &counter, &streamed]()
+					{
+						streamed = 0;
+						group->streamInfo(counter);
+						return (long)streamed; });
+
+		// Every plant changes between renders, as after a tick
+		harness.run("info/group_rerender_1k", 1000, [group, &buffer]()
+					{
+						for (PlantComponent *child : *group->getPlants())
+							static_cast<LivingPlant *>(child)->invalidateInfo();
+						buffer.clear();
+						group->writeInfo(buffer);
+						return buffer.size(); });
+		delete root;
+	}
+
+	void benchFacade(BenchHarness &harness)
+	{
+		if (!harness.selected("facade/"))
+			return;
+
+		NurseryFacade facade;
+		for (int i = 0; i < 1000; i++)
+			facade.createPlant(facade.getAvailablePlantTypes()[i % 8]);
+		PlantComponent *plant = facade.findPlant(0);
+
+		harness.run("facade/create_plant", 1, [&facade]()
+					{
+						PlantComponent *created = facade.createPlant("Rose");
+						facade.removeComponentFromInventory(created);
+						delete created;
+						return 1; });
+
+		harness.run("facade/get_plant_info", 1, [&facade, plant]()
+					{ return facade.getPlantInfo(plant).size(); });
+
+		harness.run("facade/water_plant", 1, [&facade, plant]()
+					{
+						facade.waterPlant(plant);
+						return 1; });
+
+		harness.run("facade/get_menu_string_1k", 1000, [&facade]()
+					{ return facade.getMenuString().size(); });
+
+		harness.run("facade/page_plants_1k", 50, [&facade]()
+					{ return facade.getMenuPage(500, 50).items.size(); });
+	}
+
+	void benchWorkload(BenchHarness &harness)
+	{
+		WorkloadConfig config;
+		config.plants = 10000;
+		config.groupDepth = 2;
+		config.groupFanout = 8;
+		config.maxExtraDecorators = 2;
+
+		harness.run("workload/build_10k", config.plants, [config]()
+					{
+						WorkloadGenerator generator(config);
+						generator.build();
+						delete Inventory::getInstance();
+						return 1; });
+
+		// Observed ticks: every leaf group has a staff member who waters and moves plants
+		if (!harness.selected("workload/observed_tick_100k"))
+			return;
+		config.plants = 100000;
+		WorkloadGenerator generator(config);
+		generator.build();
+		harness.run("workload/observed_tick_100k", config.plants, [&generator]()
+					{
+						generator.run(1);
+						return 1; });
+		delete Inventory::getInstance();
+	}
+
+	/**
+	 * @brief Reports the footprint of a generated 1M-plant nursery and times measuring it.
+	 */
+	void benchMemory(BenchHarness &harness)
+	{
+		if (!harness.selected("memory/"))
+			return;
+
+		WorkloadConfig config;
+		config.plants = 1000000;
+		config.groupDepth = 3;
+		config.groupFanout = 10;
+		config.maxExtraDecorators = 2;
+		config.staff = 10;
+		WorkloadGenerator generator(config);
+		generator.build();
+
+		MemoryReport report = MemoryReport::measure();
+		report.writeText(std::cout);
+		harness.metric("memory/bytes_per_plant_1m", report.getBytesPerPlant());
+		harness.metric("memory/total_mib_1m", report.getTotalBytes() / (1024.0 * 1024.0));
+		harness.metric("memory/decorator_bytes_per_plant_1m",
+					   (double)report.get(MemoryReport::Category::DECORATORS).bytes / report.getPlantCount());
+
+		harness.run("memory/measure_1m", config.plants, []()
+					{ return MemoryReport::measure().getPlantCount(); });
+		delete Inventory::getInstance();
+	}
+}
+
+int main(int argc, char **argv)
+{
+	BenchHarness harness;
+	if (!harness.parse(argc, argv))
+		return 2;
+
+	benchBuilder<SunflowerBuilder>(harness, "sunflower");
+	benchBuilder<RoseBuilder>(harness, "rose");
+	benchBuilder<JadePlantBuilder>(harness, "jade");
+	benchBuilder<MapleBuilder>(harness, "maple");
+	benchBuilder<CactusBuilder>(harness, "cactus");
+	benchBuilder<CherryBlossomBuilder>(harness, "cherry_blossom");
+	benchBuilder<LavenderBuilder>(harness, "lavender");
+	benchBuilder<PineBuilder>(harness, "pine");
+
+	// Cloning from the outermost decorator copies the plant and shares the interned chain
+	PlantComponent *rose = buildPlant<RoseBuilder>();
+	PlantComponent *roseChain = rose->getDecorator();
+	harness.run("clone/decorated_rose", 1, [roseChain]()
+				{
+					PlantComponent *copy = roseChain->clone();
+					delete copy;
+					return 1; });
+	harness.run("clone/bare_plant", 1, [rose]()
+				{
+					PlantComponent *copy = rose->clone();
+					delete copy;
+					return 1; });
+	delete rose;
+
+	benchParallelBuild(harness);
+
+	benchTick(harness, "tick/group_1k", 1000);
+	benchTick(harness, "tick/group_100k", 100000);
+	benchTick(harness, "tick/group_1m", 1000000);
+
+	benchCare(harness, "1k", 1000);
+	benchCare(harness, "100k", 100000);
+	benchTraversal(harness);
+	benchFlyweights(harness);
+	benchInfo(harness);
+	benchFacade(harness);
+	benchWorkload(harness);
+	benchMemory(harness);
+
+	delete Inventory::getInstance();
+	return harness.finish() ? 0 : 1;
+}
@@ -0,0 +1,147 @@
+/**
+ * @file iteration_bench.cpp
+ * @brief Microbenchmark comparing the virtual Iterator API with PlantRange.
+ *
+ * Builds a nested inventory (groups of groups of plants) and times full
+ * traversals through AggPlant + PlantIterator (heap aggregate, heap iterator,
+ * std::stack frames) against the stack-allocated PlantRange, then times a
+ * stock-valuation style reduction through ParallelTraversal at increasing
+ * worker counts.
+ *
+ * Usage: make bench-iteration [BENCH_ARGS="<plants> <groups> <repetitions> [<max threads>]"]
+ * The worker counts default to powers of two up to the hardware core count.
+ */
+
+#include "iterator/AggPlant.h"
+#include "iterator/Iterator.h"
+#include "iterator/PlantRange.h"
+#include "iterator/ParallelTraversal.h"
+#include "composite/PlantGroup.h"
+#include "prototype/Succulent.h"
+#include "singleton/Singleton.h"
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+namespace
+{
+	/**
+	 * @brief Builds a root group with nested subgroups holding the given number of plants.
+	 */
+	PlantGroup* buildInventory(int plantCount, int groupCount)
+	{
+		PlantGroup* root = new PlantGroup();
+		PlantGroup* groups[3] = {nullptr, nullptr, nullptr};
+
+		for (int g = 0; g < groupCount; g++) {
+			PlantGroup* outer = new PlantGroup();
+			PlantGroup* inner = new PlantGroup();
+			outer->addComponent(inner);
+			root->addComponent(outer);
+			groups[0] = root;
+			groups[1] = outer;
+			groups[2] = inner;
+
+			for (int p = g; p < plantCount; p += groupCount) {
+				groups[p % 3]->addComponent(new Succulent());
+			}
+		}
+		return root;
+	}
+
+	/**
+	 * @brief Counts plants with the heap-allocated Iterator API, as the facade used to.
+	 */
+	long traverseWithIterator(PlantGroup* root)
+	{
+		long visited = 0;
+		AggPlant* agg = new AggPlant(root->getPlants());
+		Iterator* itr = agg->createIterator();
+		while (!itr->isDone()) {
+			visited += itr->currentItem()->getHealth() >= 0;
+			itr->next();
+		}
+		delete itr;
+		delete agg;
+		return visited;
+	}
+
+	/**
+	 * @brief Counts plants with the stack-allocated PlantRange.
+	 */
+	long traverseWithRange(PlantGroup* root)
+	{
+		long visited = 0;
+		for (LivingPlant* plant : PlantRange(root->getPlants())) {
+			visited += plant->getHealth() >= 0;
+		}
+		return visited;
+	}
+
+	/**
+	 * @brief Runs a traversal repeatedly and reports nanoseconds per visited plant.
+	 */
+	template <typename Traversal>
+	void report(const char* label, Traversal traversal, PlantGroup* root, int repetitions)
+	{
+		long visited = 0;
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		for (int r = 0; r < repetitions; r++) {
+			visited += traversal(root);
+		}
+		std::chrono::steady_clock::time_point stop = std::chrono::steady_clock::now();
+
+		double nanos = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count();
+		std::cout << label << ": " << nanos / repetitions / 1000.0 << " us/traversal, "
+				  << (visited > 0 ? nanos / visited : 0.0) << " ns/plant (" << visited / repetitions << " plants)"
+				  << std::endl;
+	}
+}
+
+int main(int argc, char** argv)
+{
+	int plantCount = argc > 1 ? std::atoi(argv[1]) : 10000;
+	int groupCount = argc > 2 ? std::atoi(argv[2]) : 100;
+	int repetitions = argc > 3 ? std::atoi(argv[3]) : 200;
+	unsigned maxThreads = argc > 4 ? (unsigned)std::atoi(argv[4]) : std::thread::hardware_concurrency();
+
+	PlantGroup* root = buildInventory(plantCount, groupCount > 0 ? groupCount : 1);
+
+	// Warm caches once so both variants start from the same state
+	traverseWithIterator(root);
+	traverseWithRange(root);
+
+	report("Iterator*  ", traverseWithIterator, root, repetitions);
+	report("PlantRange ", traverseWithRange, root, repetitions);
+
+	{
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		std::size_t flattened = 0;
+		for (int r = 0; r < repetitions; r++) {
+			flattened += ParallelTraversal(root->getPlants(), 1).size();
+		}
+		std::chrono::steady_clock::time_point stop = std::chrono::steady_clock::now();
+
+		double nanos = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count();
+		std::cout << "Flatten    : " << nanos / repetitions / 1000.0 << " us/traversal (" << flattened / repetitions
+				  << " plants)" << std::endl;
+	}
+
+	for (unsigned threads = 1; threads <= (maxThreads > 0 ? maxThreads : 1); threads *= 2) {
+		ParallelTraversal traversal(root->getPlants(), threads);
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		double total = 0.0;
+		for (int r = 0; r < repetitions; r++) {
+			total += traversal.sum([](LivingPlant* plant) { return plant->getPrice(); });
+		}
+		std::chrono::steady_clock::time_point stop = std::chrono::steady_clock::now();
+
+		double nanos = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count();
+		std::cout << "Parallel sum (" << traversal.workerCount() << " workers): "
+				  << nanos / repetitions / 1000.0 << " us/reduction (checksum " << total << ")" << std::endl;
+	}
+
+	delete root;
+	delete Inventory::getInstance();
+	return 0;
+}
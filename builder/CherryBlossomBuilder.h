@@ -1,12 +1,12 @@
 #ifndef CHERRYBLOSSOMBUILDER_H
 #define CHERRYBLOSSOMBUILDER_H
 
-#include "Builder.h"
+#include "SpeciesBuilder.h"
 
 /**
  * @brief Concrete builder for Cherry Blossom trees.
  *
- * Implements the Builder interface to construct Cherry Blossom trees with specific attributes:
+ * Builds Cherry Blossom trees from the SpeciesCatalog::CHERRY_BLOSSOM entry:
  * - Base Type: Tree
  * - Sun Strategy: MidSun (60% initial exposure)
  * - Water Strategy: MidWater (60% initial level)
@@ -14,60 +14,21 @@
  * - Decorators: Spring, Large Flowers, Small Leaves, Large Stem
  * - Initial State: Seed
  *
- * @see Builder The abstract builder interface
+ * @see SpeciesBuilder Follows the catalog recipe
+ * @see SpeciesCatalog Where the recipe is defined
  * @see Tree The base plant type
  * @see MidSun The sun exposure strategy
  * @see MidWater The watering strategy
  * @see Seed The initial maturity state
  */
-class CherryBlossomBuilder : public Builder
+class CherryBlossomBuilder : public SpeciesBuilder
 {
-
-
 public:
     /**
      * @brief Constructor for CherryBlossomBuilder.
      */
     CherryBlossomBuilder();
-	virtual ~CherryBlossomBuilder(){};
-    /**
-     * @brief Creates a new Tree object as the base for the Cherry Blossom.
-     */
-    void createObject() ;
-
-    /**
-     * @brief Assigns MidWater strategy to the Cherry Blossom tree.
-     */
-    void assignWaterStrategy() ;
-
-    /**
-     * @brief Assigns MidSun strategy to the Cherry Blossom tree.
-     */
-    void assignSunStrategy() ;
-
-    /**
-     * @brief Assigns initial Seed state to the Cherry Blossom tree.
-     */
-    void assignMaturityState() ;
-
-    /**
-     * @brief Sets up the initial health, water, and sun levels for the Cherry Blossom tree.
-     */
-    void setUp() ;
-
-    /**
-     * @brief Adds decorators to the PlantComponent.
-     * 
-     * Applies the following decorators in sequence:
-     * - Spring season
-     * - Large Flowers
-     * - Small Leaves
-     * - Large Stem
-     */
-    void addDecorators() ;
-
-
-
+    virtual ~CherryBlossomBuilder(){};
 };
 
 #endif // CHERRYBLOSSOMBUILDER_H
\ No newline at end of file
@@ -1,4 +1,6 @@
 #include "Director.h"
+#include "../diagnostics/AllocationTracker.h"
+#include "../diagnostics/Tracer.h"
 Director::Director(Builder* builder) : builder(builder) {
 }
 
@@ -7,6 +9,8 @@ void Director::construct() {
         return;
     }
 
+    AllocationTracker::TagScope tag(AllocationTracker::Tag::BUILDER);
+    TRACE_SCOPE("construct", "builder");
     builder->createObject();
     builder->assignWaterStrategy();
     builder->assignSunStrategy();
@@ -1,12 +1,12 @@
 #ifndef JADEPLANTBUILDER_H
 #define JADEPLANTBUILDER_H
 
-#include "Builder.h"
+#include "SpeciesBuilder.h"
 
 /**
  * @brief Concrete builder for Jade plants.
  *
- * Implements the Builder interface to construct Jade plants with specific attributes:
+ * Builds Jade plants from the SpeciesCatalog::JADE entry:
  * - Base Type: Succulent
  * - Sun Strategy: MidSun
  * - Water Strategy: LowWater
@@ -14,50 +14,18 @@
  * - Decorators: Small Flowers, Small Leaves, Medium Stem, No Thorns
  * - Initial State: Seed
  *
- * @see Builder
+ * @see SpeciesBuilder Follows the catalog recipe
+ * @see SpeciesCatalog Where the recipe is defined
  * @see Succulent
  */
-class JadePlantBuilder : public Builder
+class JadePlantBuilder : public SpeciesBuilder
 {
-
-
 public:
     /**
      * @brief Constructor for JadePlantBuilder.
      */
     JadePlantBuilder();
-	virtual ~JadePlantBuilder(){};
-    /**
-     * @brief Creates a new Succulent object as the base for the Jade plant.
-     */
-    void createObject() ;
-
-    /**
-     * @brief Assigns LowWater strategy to the Jade plant.
-     */
-    void assignWaterStrategy() ;
-
-    /**
-     * @brief Assigns MidSun strategy to the Jade plant.
-     */
-    void assignSunStrategy() ;
-
-    /**
-     * @brief Assigns initial Seed state to the Jade plant.
-     */
-    void assignMaturityState() ;
-
-    /**
-     * @brief Sets up the initial health, water, and sun levels for the Jade plant.
-     */
-    void setUp() ;
-
-    /**
-     * @brief Adds decorators to the LivingPlant.
-     */
-    void addDecorators() ;
-
-
+    virtual ~JadePlantBuilder(){};
 };
 
 #endif // JADEPLANTBUILDER_H
\ No newline at end of file
@@ -1,12 +1,12 @@
 #ifndef LAVENDERBUILDER_H
 #define LAVENDERBUILDER_H
 
-#include "Builder.h"
+#include "SpeciesBuilder.h"
 
 /**
  * @brief Concrete builder for Lavender plants.
  *
- * Implements the Builder interface to construct Lavender plants with specific attributes:
+ * Builds Lavender plants from the SpeciesCatalog::LAVENDER entry:
  * - Base Type: Herb
  * - Sun Strategy: HighSun
  * - Water Strategy: LowWater
@@ -14,49 +14,18 @@
  * - Decorators: Small Flowers, Small Leaves, Medium Stem, No Thorns
  * - Initial State: Seed
  *
- * @see Builder
+ * @see SpeciesBuilder Follows the catalog recipe
+ * @see SpeciesCatalog Where the recipe is defined
  * @see Herb
  */
-class LavenderBuilder : public Builder
+class LavenderBuilder : public SpeciesBuilder
 {
-
- 
-
 public:
     /**
      * @brief Constructor for LavenderBuilder.
      */
     LavenderBuilder();
-	virtual ~LavenderBuilder(){};
-    /**
-     * @brief Creates a new Herb object as the base for the Lavender.
-     */
-    void createObject() ;
-
-    /**
-     * @brief Assigns LowWater strategy to the Lavender plant.
-     */
-    void assignWaterStrategy() ;
-
-    /**
-     * @brief Assigns HighSun strategy to the Lavender plant.
-     */
-    void assignSunStrategy() ;
-
-    /**
-     * @brief Assigns initial Seed state to the Lavender plant.
-     */
-    void assignMaturityState() ;
-
-    /**
-     * @brief Sets up the initial health, water, and sun levels for the Lavender plant.
-     */
-    void setUp() ;
-    /**
-     * @brief Adds decorators to the PlantComponent.
-     */
-    void addDecorators() ;
-
+    virtual ~LavenderBuilder(){};
 };
 
 #endif // LAVENDERBUILDER_H
\ No newline at end of file
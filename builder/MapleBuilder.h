@@ -1,12 +1,12 @@
 #ifndef MAPLEBUILDER_H
 #define MAPLEBUILDER_H
 
-#include "Builder.h"
+#include "SpeciesBuilder.h"
 
 /**
  * @brief Concrete builder for Maple trees.
  *
- * Implements the Builder interface to construct Maple trees with specific attributes:
+ * Builds Maple trees from the SpeciesCatalog::MAPLE entry:
  * - Base Type: Tree
  * - Sun Strategy: MidSun
  * - Water Strategy: MidWater
@@ -14,48 +14,18 @@
  * - Decorators: No Flowers, Large Leaves, Large Stem, No Thorns
  * - Initial State: Seed
  *
- * @see Builder
+ * @see SpeciesBuilder Follows the catalog recipe
+ * @see SpeciesCatalog Where the recipe is defined
  * @see Tree
  */
-class MapleBuilder : public Builder
+class MapleBuilder : public SpeciesBuilder
 {
-
-
 public:
     /**
      * @brief Constructor for MapleBuilder.
      */
     MapleBuilder();
-	virtual ~MapleBuilder(){};
-    /**
-     * @brief Creates a new Tree object as the base for the Maple.
-     */
-    void createObject() ;
-
-    /**
-     * @brief Assigns MidWater strategy to the Maple tree.
-     */
-    void assignWaterStrategy() ;
-
-    /**
-     * @brief Assigns MidSun strategy to the Maple tree.
-     */
-    void assignSunStrategy() ;
-
-    /**
-     * @brief Assigns initial Seed state to the Maple tree.
-     */
-    void assignMaturityState() ;
-
-    /**
-     * @brief Sets up the initial health, water, and sun levels for the Maple tree.
-     */
-    void setUp() ;
-    /**
-     * @brief Adds decorators to the PlantComponent.
-     */
-    void addDecorators() ;
-
+    virtual ~MapleBuilder(){};
 };
 
 #endif // MAPLEBUILDER_H
\ No newline at end of file
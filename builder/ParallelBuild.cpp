@@ -0,0 +1,110 @@
+#include "ParallelBuild.h"
+#include "Director.h"
+#include "../diagnostics/AllocationTracker.h"
+#include "../diagnostics/Tracer.h"
+#include "../iterator/ParallelTraversal.h"
+#include <exception>
+#include <thread>
+
+const std::size_t ParallelBuild::MIN_PLANTS_PER_THREAD;
+
+ParallelBuild::ParallelBuild(unsigned threadCount, std::size_t minPlantsPerThread)
+    : maxWorkers(threadCount != 0 ? threadCount : std::thread::hardware_concurrency()),
+      minPlantsPerThread(minPlantsPerThread != 0 ? minPlantsPerThread : 1)
+{
+    if (maxWorkers == 0)
+        maxWorkers = 1;
+}
+
+unsigned ParallelBuild::workerCount(std::size_t count) const
+{
+    // Never split below the per-thread minimum, but always keep at least one worker
+    std::size_t byWork = count / minPlantsPerThread;
+    unsigned workers = byWork < maxWorkers ? (unsigned)byWork : maxWorkers;
+    return workers != 0 ? workers : 1;
+}
+
+std::vector<PlantComponent *> ParallelBuild::build(const Species &species, std::size_t count) const
+{
+    std::vector<PlantComponent *> plants(count, nullptr);
+    if (count == 0)
+        return plants;
+
+    unsigned workers = workerCount(count);
+    std::vector<std::exception_ptr> errors(workers);
+    std::size_t chunk = (count + workers - 1) / workers;
+    std::exception_ptr failure;
+    {
+        std::vector<std::thread> threads;
+        threads.reserve(workers - 1);
+        ParallelTraversal::JoinAll joinAll(threads);
+        try
+        {
+            for (unsigned w = 0; w < workers; w++)
+            {
+                std::size_t begin = w * chunk < count ? w * chunk : count;
+                std::size_t end = begin + chunk < count ? begin + chunk : count;
+                PlantComponent **out = plants.data() + begin;
+                std::exception_ptr *error = &errors[w];
+
+                // The calling thread takes the last chunk instead of idling in join()
+                if (w + 1 < workers)
+                {
+                    threads.push_back(std::thread([&species, out, begin, end, error]()
+                                                  {
+                                                      TRACE_THREAD_NAME("builder");
+                                                      *error = buildRange(species, out, end - begin); }));
+                }
+                else
+                {
+                    *error = buildRange(species, out, end - begin);
+                }
+            }
+        }
+        catch (...)
+        {
+            // A thread could not be started; the ones that were still finish their chunks
+            failure = std::current_exception();
+        }
+    }
+
+    for (std::size_t w = 0; w < errors.size() && !failure; w++)
+        failure = errors[w];
+    if (failure)
+    {
+        for (PlantComponent *plant : plants)
+            delete plant;
+        std::rethrow_exception(failure);
+    }
+    return plants;
+}
+
+std::exception_ptr ParallelBuild::buildRange(const Species &species, PlantComponent **out, std::size_t count)
+{
+    if (count == 0)
+        return nullptr;
+
+    AllocationTracker::TagScope tag(AllocationTracker::Tag::BUILDER);
+    TRACE_SCOPE("build_range", "builder");
+    Builder *builder = nullptr;
+    try
+    {
+        builder = species.createBuilder();
+        Director director(builder);
+        director.construct();
+        out[0] = director.getPlant();
+
+        // Clone the first plant's shared chain: no re-interning, so workers never meet on the chain pool's lock
+        PlantComponent *decorated = out[0]->getDecorator();
+        for (std::size_t i = 1; i < count; i++)
+            out[i] = decorated != nullptr ? decorated->clone() : director.getPlant();
+    }
+    catch (...)
+    {
+        // Anything escaping a worker thread would terminate the process; the caller rethrows it
+        delete builder;
+        return std::current_exception();
+    }
+    delete builder;
+    return nullptr;
+}
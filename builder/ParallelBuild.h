@@ -0,0 +1,77 @@
+#ifndef ParallelBuild_h
+#define ParallelBuild_h
+
+#include "SpeciesCatalog.h"
+#include <cstddef>
+#include <exception>
+#include <vector>
+
+class PlantComponent;
+
+/**
+ * @brief Builds many plants of one species on several threads.
+ *
+ * Stocking the nursery with thousands of plants used to mean one Director
+ * run per plant on the calling thread. A bulk build instead splits the
+ * count into equal chunks, one per worker; each worker runs the species'
+ * builder once and clones the first plant it gets from Director::getPlant()
+ * for the rest of its chunk, like any prototype. Every plant is identical to
+ * one built on its own.
+ *
+ * **System Role:**
+ * Bulk path behind NurseryFacade::createPlants(). The construction pipeline
+ * it relies on is safe to share between threads: Inventory::getInstance()
+ * creates the Inventory once, strategy and state lookups only read their
+ * factories, and names and decorator chains are interned under their pools'
+ * locks. Workers only build; the caller adds the plants to the inventory.
+ *
+ * **Implementation Details:**
+ * - Counts under minPlantsPerThread per worker are built on fewer workers;
+ *   the calling thread always takes the last chunk itself
+ * - Worker count defaults to std::thread::hardware_concurrency()
+ * - Any exception a worker throws is carried back and rethrown on the caller
+ *   once every started worker has been joined
+ * - Most of the gain over one Director per plant comes from cloning rather
+ *   than threads; scaling with the worker count has not been measured
+ *
+ * @see SpeciesBuilder (the recipe each worker runs)
+ * @see ParallelTraversal (the same chunking for reads)
+ */
+class ParallelBuild
+{
+	public:
+		/**
+		 * @brief Smallest chunk worth handing to its own thread.
+		 */
+		static const std::size_t MIN_PLANTS_PER_THREAD = 256;
+
+		/**
+		 * @param threadCount Maximum number of workers, or 0 for the hardware core count.
+		 * @param minPlantsPerThread Smallest chunk handed to a worker.
+		 */
+		ParallelBuild(unsigned threadCount = 0, std::size_t minPlantsPerThread = MIN_PLANTS_PER_THREAD);
+
+		/**
+		 * @brief Builds count plants of a species.
+		 * @return The plants, owned by the caller, in no particular order.
+		 * @throws const char* if a builder fails, or whatever else a worker threw
+		 *         (e.g. std::bad_alloc); plants already built are deleted.
+		 */
+		std::vector<PlantComponent *> build(const Species &species, std::size_t count) const;
+
+		/**
+		 * @brief Number of workers build() uses for count plants, including the calling thread.
+		 */
+		unsigned workerCount(std::size_t count) const;
+
+	private:
+		unsigned maxWorkers;
+		std::size_t minPlantsPerThread;
+
+		/**
+		 * @brief Fills out[0, count) with plants of a species; returns what a builder threw, or nullptr.
+		 */
+		static std::exception_ptr buildRange(const Species &species, PlantComponent **out, std::size_t count);
+};
+
+#endif
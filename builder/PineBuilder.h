@@ -1,12 +1,12 @@
 #ifndef PINEBUILDER_H
 #define PINEBUILDER_H
 
-#include "Builder.h"
+#include "SpeciesBuilder.h"
 
 /**
  * @brief Concrete builder for Pine trees.
  *
- * Implements the Builder interface to construct Pine trees with specific attributes:
+ * Builds Pine trees from the SpeciesCatalog::PINE entry:
  * - Base Type: Tree
  * - Sun Strategy: HighSun (80% initial exposure)
  * - Water Strategy: LowWater (40% initial level)
@@ -14,57 +14,21 @@
  * - Decorators: Winter, Small Leaves, Large Stem
  * - Initial State: Seed
  *
- * @see Builder The abstract builder interface
+ * @see SpeciesBuilder Follows the catalog recipe
+ * @see SpeciesCatalog Where the recipe is defined
  * @see Tree The base plant type
  * @see HighSun The sun exposure strategy
  * @see LowWater The watering strategy
  * @see Seed The initial maturity state
  */
-class PineBuilder : public Builder
+class PineBuilder : public SpeciesBuilder
 {
-
-
-
 public:
     /**
      * @brief Constructor for PineBuilder.
      */
     PineBuilder();
-	virtual ~PineBuilder(){};
-    /**
-     * @brief Creates a new Tree object as the base for the Pine.
-     */
-    void createObject() ;
-
-    /**
-     * @brief Assigns LowWater strategy to the Pine tree.
-     */
-    void assignWaterStrategy() ;
-
-    /**
-     * @brief Assigns HighSun strategy to the Pine tree.
-     */
-    void assignSunStrategy() ;
-
-    /**
-     * @brief Assigns initial Seed state to the Pine tree.
-     */
-    void assignMaturityState() ;
-
-    /**
-     * @brief Sets up the initial health, water, and sun levels for the Pine tree.
-     */
-    void setUp() ;
-    /**
-     * @brief Adds decorators to the LivingPlant.
-     * 
-     * Applies the following decorators in sequence:
-     * - Winter season
-     * - Small Leaves
-     * - Large Stem
-     */
-    void addDecorators() ;
-
+    virtual ~PineBuilder(){};
 };
 
 #endif // PINEBUILDER_H
\ No newline at end of file
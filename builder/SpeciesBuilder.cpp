@@ -0,0 +1,66 @@
+#include "SpeciesBuilder.h"
+#include "../state/Seed.h"
+
+SpeciesBuilder::SpeciesBuilder(const Species &species)
+    : Builder(), species(species)
+{
+}
+
+void SpeciesBuilder::createObject()
+{
+    if (!plant)
+    {
+        plant = species.createBase(species.name);
+    }
+}
+
+void SpeciesBuilder::assignWaterStrategy()
+{
+    if (plant)
+    {
+        plant->setWaterStrategy(species.waterStrategy());
+    }
+}
+
+void SpeciesBuilder::assignSunStrategy()
+{
+    if (plant)
+    {
+        plant->setSunStrategy(species.sunStrategy());
+    }
+}
+
+void SpeciesBuilder::assignMaturityState()
+{
+    if (plant)
+    {
+        plant->setMaturity(Seed::getID());
+    }
+}
+
+void SpeciesBuilder::addDecorators()
+{
+    if (plant)
+    {
+        PlantComponent *season = species.createSeason();
+        plant->setSeason(season->getNameFlyweight());
+        plant->addAttribute(season);
+        for (std::size_t i = 0; i < Species::MAX_ATTRIBUTES && species.createAttributes[i] != nullptr; i++)
+            plant->addAttribute(species.createAttributes[i]());
+    }
+}
+
+void SpeciesBuilder::setUp()
+{
+    if (plant)
+    {
+        plant->setHealth(100);
+        plant->setWaterLevel(species.waterLevel);
+        plant->setSunExposure(species.sunExposure);
+    }
+}
+
+const Species &SpeciesBuilder::getSpecies() const
+{
+    return species;
+}
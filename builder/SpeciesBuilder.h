@@ -0,0 +1,60 @@
+#ifndef SpeciesBuilder_h
+#define SpeciesBuilder_h
+
+#include "Builder.h"
+#include "SpeciesCatalog.h"
+
+/**
+ * @brief Concrete builder that follows a SpeciesCatalog recipe.
+ *
+ * Every concrete builder used to spell out its species in six near-identical
+ * methods. They now derive from this class and only name their catalog
+ * entry, so the recipe lives in one place and the facade can build any
+ * species straight from its entry.
+ *
+ * Construction is unchanged: the base type carries the species name, the
+ * strategies come from the entry, the maturity state is Seed, the season is
+ * applied before the attributes, and health starts at 100.
+ *
+ * @see SpeciesCatalog (the recipes)
+ * @see Director (calls the steps in order)
+ */
+class SpeciesBuilder : public Builder
+{
+	public:
+		/**
+		 * @param species Catalog entry to build; entries live for the whole program.
+		 */
+		SpeciesBuilder(const Species &species);
+		virtual ~SpeciesBuilder() {}
+
+		/**
+		 * @brief Creates the species' base type, named after the species.
+		 */
+		void createObject();
+
+		void assignWaterStrategy();
+		void assignSunStrategy();
+
+		/**
+		 * @brief Starts the plant as a Seed.
+		 */
+		void assignMaturityState();
+
+		/**
+		 * @brief Applies the species' season, then its attributes in catalog order.
+		 */
+		void addDecorators();
+
+		/**
+		 * @brief Sets full health and the species' initial water and sun levels.
+		 */
+		void setUp();
+
+		const Species &getSpecies() const;
+
+	private:
+		const Species &species;
+};
+
+#endif
@@ -0,0 +1,168 @@
+#include "SpeciesCatalog.h"
+#include "CactusBuilder.h"
+#include "CherryBlossomBuilder.h"
+#include "JadePlantBuilder.h"
+#include "LavenderBuilder.h"
+#include "MapleBuilder.h"
+#include "PineBuilder.h"
+#include "RoseBuilder.h"
+#include "SunflowerBuilder.h"
+#include "../prototype/Herb.h"
+#include "../prototype/Shrub.h"
+#include "../prototype/Succulent.h"
+#include "../prototype/Tree.h"
+#include "../strategy/HighSun.h"
+#include "../strategy/LowWater.h"
+#include "../strategy/MidSun.h"
+#include "../strategy/MidWater.h"
+#include "../decorator/plantDecorator/Autumn.h"
+#include "../decorator/plantDecorator/LargeFlowers.h"
+#include "../decorator/plantDecorator/LargeLeaf.h"
+#include "../decorator/plantDecorator/LargeStem.h"
+#include "../decorator/plantDecorator/SmallFlowers.h"
+#include "../decorator/plantDecorator/SmallLeaf.h"
+#include "../decorator/plantDecorator/Spring.h"
+#include "../decorator/plantDecorator/Summer.h"
+#include "../decorator/plantDecorator/Thorns.h"
+#include "../decorator/plantDecorator/Winter.h"
+#include <cstring>
+
+namespace
+{
+    template <class T>
+    LivingPlant *base(const std::string &name)
+    {
+        return new T(name);
+    }
+
+    template <class T>
+    PlantComponent *decorator()
+    {
+        return new T();
+    }
+
+    template <class T>
+    Builder *builder()
+    {
+        return new T();
+    }
+
+    constexpr std::size_t length(const char *text)
+    {
+        return *text == '\0' ? 0 : 1 + length(text + 1);
+    }
+
+    // Second character plus length separates every catalog name
+    constexpr std::size_t slotOf(const char *name, std::size_t length)
+    {
+        return (length + (length > 1 ? (unsigned char)name[1] : 0)) % SpeciesCatalog::SLOT_COUNT;
+    }
+
+#define SPECIES_NAME(text) text, length(text)
+
+    // Indexed by SpeciesCatalog::Id
+    constexpr Species SPECIES[SpeciesCatalog::COUNT] = {
+        {SPECIES_NAME("Sunflower"), PlantCategory::FLOWERING, &base<Herb>,
+         &MidWater::getID, &HighSun::getID, &decorator<Summer>,
+         {&decorator<LargeFlowers>, &decorator<LargeLeaf>, &decorator<LargeStem>},
+         60, 80, &builder<SunflowerBuilder>,
+         "Sunflowers grow really fast and the bees absolutely love them - great for your garden ecosystem."},
+        {SPECIES_NAME("Rose"), PlantCategory::FLOWERING, &base<Shrub>,
+         &MidWater::getID, &MidSun::getID, &decorator<Spring>,
+         {&decorator<LargeFlowers>, &decorator<SmallLeaf>, &decorator<LargeStem>, &decorator<Thorns>},
+         60, 60, &builder<RoseBuilder>,
+         "Roses are classic, though watch out for the thorns when you're pruning them."},
+        {SPECIES_NAME("Jade"), PlantCategory::SUCCULENT, &base<Succulent>,
+         &LowWater::getID, &MidSun::getID, &decorator<Winter>,
+         {&decorator<SmallFlowers>, &decorator<SmallLeaf>, &decorator<LargeStem>},
+         30, 60, &builder<JadePlantBuilder>,
+         "Jade plants are supposed to bring good luck, and they're super easy to grow from cuttings."},
+        {SPECIES_NAME("Maple Tree"), PlantCategory::TREE, &base<Tree>,
+         &MidWater::getID, &MidSun::getID, &decorator<Autumn>,
+         {&decorator<LargeLeaf>, &decorator<LargeStem>},
+         60, 60, &builder<MapleBuilder>,
+         "The Maple gives you those gorgeous fall colors - really transforms your yard in autumn."},
+        {SPECIES_NAME("Cactus"), PlantCategory::SUCCULENT, &base<Succulent>,
+         &LowWater::getID, &HighSun::getID, &decorator<Summer>,
+         {&decorator<SmallFlowers>, &decorator<LargeStem>, &decorator<Thorns>},
+         30, 80, &builder<CactusBuilder>,
+         "Cacti are practically indestructible - they store water so you can't really overwater them."},
+        {SPECIES_NAME("Cherry Blossom"), PlantCategory::TREE, &base<Tree>,
+         &MidWater::getID, &MidSun::getID, &decorator<Spring>,
+         {&decorator<LargeFlowers>, &decorator<SmallLeaf>, &decorator<LargeStem>},
+         60, 60, &builder<CherryBlossomBuilder>,
+         "The Cherry Blossom puts on an amazing show in spring - the flowers are just spectacular."},
+        {SPECIES_NAME("Lavender"), PlantCategory::FLOWERING, &base<Herb>,
+         &LowWater::getID, &HighSun::getID, &decorator<Autumn>,
+         {&decorator<SmallFlowers>, &decorator<SmallLeaf>, &decorator<LargeStem>},
+         40, 80, &builder<LavenderBuilder>,
+         "Lavender smells amazing, doesn't need much water, and the purple flowers are just lovely."},
+        {SPECIES_NAME("Pine Tree"), PlantCategory::TREE, &base<Tree>,
+         &LowWater::getID, &HighSun::getID, &decorator<Winter>,
+         {&decorator<SmallLeaf>, &decorator<LargeStem>},
+         40, 80, &builder<PineBuilder>,
+         "The Pine stays green all year round and doesn't need much maintenance, which is great if you're busy."},
+    };
+
+#undef SPECIES_NAME
+
+    // First species hashing to slot, or -1
+    constexpr int speciesInSlot(std::size_t slot, std::size_t id = 0)
+    {
+        return id == SpeciesCatalog::COUNT ? -1
+               : slotOf(SPECIES[id].name, SPECIES[id].nameLength) == slot ? (int)id
+                                                                          : speciesInSlot(slot, id + 1);
+    }
+
+    constexpr bool isCollisionFree(std::size_t id = 0)
+    {
+        return id == SpeciesCatalog::COUNT ||
+               (speciesInSlot(slotOf(SPECIES[id].name, SPECIES[id].nameLength)) == (int)id && isCollisionFree(id + 1));
+    }
+
+    static_assert(isCollisionFree(), "Species names collide in the catalog hash; adjust slotOf()");
+    static_assert(SpeciesCatalog::SLOT_COUNT == 16, "SLOTS lists one entry per slot");
+
+    constexpr signed char SLOTS[SpeciesCatalog::SLOT_COUNT] = {
+        speciesInSlot(0), speciesInSlot(1), speciesInSlot(2), speciesInSlot(3),
+        speciesInSlot(4), speciesInSlot(5), speciesInSlot(6), speciesInSlot(7),
+        speciesInSlot(8), speciesInSlot(9), speciesInSlot(10), speciesInSlot(11),
+        speciesInSlot(12), speciesInSlot(13), speciesInSlot(14), speciesInSlot(15)};
+}
+
+const std::size_t Species::MAX_ATTRIBUTES;
+const std::size_t SpeciesCatalog::SLOT_COUNT;
+
+const Species &SpeciesCatalog::get(Id id)
+{
+    return SPECIES[id];
+}
+
+const Species *SpeciesCatalog::find(const std::string &name)
+{
+    return find(name.data(), name.size());
+}
+
+const Species *SpeciesCatalog::find(const char *name, std::size_t length)
+{
+    int id = SLOTS[slotOf(name, length)];
+    if (id < 0)
+        return nullptr;
+
+    const Species &species = SPECIES[id];
+    if (species.nameLength != length || std::memcmp(species.name, name, length) != 0)
+        return nullptr;
+    return &species;
+}
+
+const std::vector<std::string> &SpeciesCatalog::getNames()
+{
+    static const std::vector<std::string> names = []()
+    {
+        std::vector<std::string> names;
+        for (const Species &species : SPECIES)
+            names.push_back(species.name);
+        return names;
+    }();
+    return names;
+}
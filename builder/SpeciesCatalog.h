@@ -0,0 +1,111 @@
+#ifndef SpeciesCatalog_h
+#define SpeciesCatalog_h
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+class Builder;
+class LivingPlant;
+class PlantComponent;
+
+/**
+ * @brief Broad plant family, used when staff describe a species.
+ */
+enum class PlantCategory
+{
+	TREE,
+	FLOWERING,
+	SUCCULENT
+};
+
+/**
+ * @brief Everything needed to build one nursery species.
+ *
+ * Entries are compile-time constants in SpeciesCatalog.cpp; the function
+ * pointers create the base plant, the season and the attribute decorators
+ * and return the strategy ids, so SpeciesBuilder can follow a recipe without
+ * knowing the species.
+ */
+struct Species
+{
+	static const std::size_t MAX_ATTRIBUTES = 4;
+
+	const char *name;
+	std::size_t nameLength;
+	PlantCategory category;
+	LivingPlant *(*createBase)(const std::string &name);
+	int (*waterStrategy)();
+	int (*sunStrategy)();
+	PlantComponent *(*createSeason)();
+	// Applied after the season, in order; unused slots are null
+	PlantComponent *(*createAttributes[MAX_ATTRIBUTES])();
+	int waterLevel;
+	int sunExposure;
+	Builder *(*createBuilder)();
+	// What staff say about this species in particular
+	const char *advice;
+};
+
+/**
+ * @brief Compile-time catalog of the species the nursery can build.
+ *
+ * NurseryFacade::createPlant() used to pick a builder through a chain of
+ * string comparisons, getAvailablePlantTypes() rebuilt its list on every
+ * call, and Staff::assistSuggestion() classified plants by scanning names for
+ * "Maple", "Pine" and so on. They now all go through this catalog: find()
+ * hashes a name into a constant slot table and confirms the single candidate
+ * with one comparison, so species dispatch is O(1) with no string scanning.
+ * Staff still falls back to the keyword scan for names that are not exact
+ * species names.
+ *
+ * The hash is perfect for the catalog's names; a static_assert in
+ * SpeciesCatalog.cpp fails the build if a new species collides.
+ *
+ * **System Role:**
+ * Single source of truth for species recipes. The concrete builders are
+ * thin SpeciesBuilder subclasses that name their entry here.
+ *
+ * @see SpeciesBuilder (builds a plant from an entry)
+ * @see NurseryFacade::createPlant()
+ */
+class SpeciesCatalog
+{
+	public:
+		/**
+		 * @brief Catalog order, which is also the order getNames() lists.
+		 */
+		enum Id
+		{
+			SUNFLOWER,
+			ROSE,
+			JADE,
+			MAPLE,
+			CACTUS,
+			CHERRY_BLOSSOM,
+			LAVENDER,
+			PINE,
+			COUNT
+		};
+
+		/**
+		 * @brief Slots in the name hash table.
+		 */
+		static const std::size_t SLOT_COUNT = 16;
+
+		static const Species &get(Id id);
+
+		/**
+		 * @brief Looks a species up by its exact name.
+		 * @return The species, or nullptr if no species has that name.
+		 */
+		static const Species *find(const std::string &name);
+		static const Species *find(const char *name, std::size_t length);
+
+		/**
+		 * @brief Gets the species names in catalog order; built once.
+		 */
+		static const std::vector<std::string> &getNames();
+};
+
+#endif
@@ -0,0 +1,89 @@
+#include "CareBatch.h"
+#include "PlantGroup.h"
+#include "../prototype/LivingPlant.h"
+#include "../decorator/PlantAttributes.h"
+#include "../singleton/Singleton.h"
+#include "../diagnostics/Tracer.h"
+
+CareBatch::CareBatch()
+    : care(WATER)
+{
+}
+
+void CareBatch::water(PlantComponent *root)
+{
+    TRACE_SCOPE("batch_water", "inventory");
+    scratch().run(root, WATER);
+}
+
+void CareBatch::setOutside(PlantComponent *root)
+{
+    TRACE_SCOPE("batch_set_outside", "inventory");
+    scratch().run(root, SUN);
+}
+
+void CareBatch::run(PlantComponent *root, Care care)
+{
+    this->care = care;
+    collect(root);
+    for (std::size_t strategy = 0; strategy < counts.size(); strategy++)
+        flush(strategy);
+}
+
+void CareBatch::collect(PlantComponent *component)
+{
+    ComponentType type = component->getType();
+
+    // Decorators only forward care to the component they wrap
+    while (type == ComponentType::PLANT_COMPONENT)
+    {
+        component = static_cast<PlantAttributes *>(component)->nextComponent;
+        if (component == nullptr)
+            return;
+        type = component->getType();
+    }
+
+    if (type == ComponentType::PLANT_GROUP)
+    {
+        for (PlantComponent *child : *static_cast<PlantGroup *>(component)->getPlants())
+            collect(child);
+        return;
+    }
+
+    LivingPlant *plant = static_cast<LivingPlant *>(component);
+    std::size_t strategy = care == WATER ? plant->waterStrategy : plant->sunStrategy;
+    if (strategy == LivingPlant::NO_FLYWEIGHT)
+        return;
+
+    if (strategy >= counts.size())
+    {
+        counts.resize(strategy + 1, 0);
+        slots.resize(counts.size() * FLUSH_SIZE);
+    }
+    slots[strategy * FLUSH_SIZE + counts[strategy]] = plant;
+    if (++counts[strategy] == FLUSH_SIZE)
+        flush(strategy);
+}
+
+void CareBatch::flush(std::size_t strategy)
+{
+    std::size_t count = counts[strategy];
+    if (count == 0)
+        return;
+    counts[strategy] = 0;
+
+    LivingPlant **plants = &slots[strategy * FLUSH_SIZE];
+    Inventory *inv = Inventory::getInstance();
+    if (care == WATER)
+        inv->getWaterFlyAt(strategy)->getState()->waterAll(plants, count);
+    else
+        inv->getSunFlyAt(strategy)->getState()->addSunAll(plants, count);
+}
+
+const std::size_t CareBatch::FLUSH_SIZE;
+
+CareBatch &CareBatch::scratch()
+{
+    static thread_local CareBatch batch;
+    return batch;
+}
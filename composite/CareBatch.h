@@ -0,0 +1,75 @@
+#ifndef CareBatch_h
+#define CareBatch_h
+
+#include <cstddef>
+#include <vector>
+
+class PlantComponent;
+class LivingPlant;
+
+/**
+ * @brief Waters a whole plant hierarchy, or puts it outside, one strategy at a time.
+ *
+ * PlantGroup::water() used to call water() on every child, which went
+ * through the decorators to LivingPlant::water(), which resolved the
+ * strategy flyweight and made a second virtual call into it. A batch instead
+ * walks the hierarchy once, buckets the plants by the strategy id they
+ * already store, and hands each bucket to its strategy's waterAll() (or
+ * addSunAll()): one virtual call per strategy, and a tight loop per bucket.
+ *
+ * Each bucket is a fixed run of FLUSH_SIZE slots and is applied as soon as
+ * it fills, so a plant is updated while the walk has only just brought it
+ * into cache. Every plant with a given strategy goes through that
+ * strategy's bucket in walk order, so stateful strategies such as
+ * AlternatingWater see the same sequence as before and every plant ends up
+ * with exactly the levels the per-plant calls would have produced.
+ *
+ * **System Role:**
+ * Care path behind PlantGroup::water() and PlantGroup::setOutside(). Buckets
+ * live in a per-thread scratch batch and keep their slots, so repeated
+ * greenhouse waterings do not allocate.
+ *
+ * @see WaterStrategy::waterAll()
+ * @see SunStrategy::addSunAll()
+ */
+class CareBatch
+{
+	public:
+		/**
+		 * @brief Plants a bucket holds before it is handed to its strategy.
+		 */
+		static const std::size_t FLUSH_SIZE = 256;
+
+		/**
+		 * @brief Waters every plant under root, as root->water() on each would.
+		 */
+		static void water(PlantComponent *root);
+
+		/**
+		 * @brief Puts every plant under root outside, as root->setOutside() on each would.
+		 */
+		static void setOutside(PlantComponent *root);
+
+	private:
+		// Which strategy id a plant is bucketed by
+		enum Care
+		{
+			WATER,
+			SUN
+		};
+
+		// FLUSH_SIZE slots per strategy id, of which counts[id] are filled
+		std::vector<LivingPlant *> slots;
+		std::vector<std::size_t> counts;
+		Care care;
+
+		CareBatch();
+
+		void run(PlantComponent *root, Care care);
+		void collect(PlantComponent *component);
+		void flush(std::size_t strategy);
+
+		static CareBatch &scratch();
+};
+
+#endif
@@ -0,0 +1,166 @@
+#include "InfoBuffer.h"
+#include "InfoSink.h"
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+namespace
+{
+	// Large enough for any double printed with "%.Nf" at the precisions used here
+	const std::size_t NUMBER_SIZE = 352;
+
+	/**
+	 * @brief Whether printf would print value as a plain integer, so snprintf can be skipped.
+	 *
+	 * Prices are almost always whole rands. limit keeps %g out of exponent notation.
+	 */
+	bool isPlainInteger(double value, double limit)
+	{
+		return std::fabs(value) < limit && value == std::floor(value) && !(value == 0 && std::signbit(value));
+	}
+}
+
+const std::size_t InfoBuffer::DEFAULT_CHUNK_SIZE;
+
+InfoBuffer::InfoBuffer()
+	: sink(nullptr), chunkSize(0)
+{
+}
+
+InfoBuffer::InfoBuffer(InfoSink *sink, std::size_t chunkSize)
+	: sink(sink), chunkSize(chunkSize)
+{
+	// One chunk plus the piece that overflows it, so steady streaming never reallocates
+	text.reserve(chunkSize + chunkSize / 2);
+}
+
+void InfoBuffer::clear()
+{
+	text.clear();
+}
+
+void InfoBuffer::reserve(std::size_t bytes)
+{
+	text.reserve(bytes);
+}
+
+InfoBuffer &InfoBuffer::append(const char *text)
+{
+	this->text.append(text, std::strlen(text));
+	return *this;
+}
+
+InfoBuffer &InfoBuffer::append(const char *text, std::size_t length)
+{
+	this->text.append(text, length);
+	return *this;
+}
+
+InfoBuffer &InfoBuffer::append(const std::string &text)
+{
+	this->text.append(text);
+	return *this;
+}
+
+InfoBuffer &InfoBuffer::integer(long value)
+{
+	char digits[24];
+	char *end = digits + sizeof(digits);
+	char *start = end;
+	unsigned long magnitude = value < 0 ? 0ul - (unsigned long)value : (unsigned long)value;
+	do
+	{
+		*--start = (char)('0' + magnitude % 10);
+		magnitude /= 10;
+	} while (magnitude != 0);
+	if (value < 0)
+		*--start = '-';
+	text.append(start, end - start);
+	return *this;
+}
+
+InfoBuffer &InfoBuffer::fixed(double value, int precision)
+{
+	if (isPlainInteger(value, 1e15) && precision >= 0 && precision < 16)
+	{
+		integer((long)value);
+		if (precision > 0)
+			text.append(1, '.').append(precision, '0');
+		return *this;
+	}
+
+	char number[NUMBER_SIZE];
+	int length = std::snprintf(number, sizeof(number), "%.*f", precision, value);
+	if (length > 0)
+		text.append(number, (std::size_t)length < sizeof(number) ? length : sizeof(number) - 1);
+	return *this;
+}
+
+InfoBuffer &InfoBuffer::general(double value)
+{
+	if (isPlainInteger(value, 1e6))
+		return integer((long)value);
+
+	char number[32];
+	int length = std::snprintf(number, sizeof(number), "%g", value);
+	if (length > 0)
+		text.append(number, length);
+	return *this;
+}
+
+InfoBuffer &InfoBuffer::padFrom(std::size_t mark, std::size_t width)
+{
+	std::size_t written = text.size() - mark;
+	if (written < width)
+		text.append(width - written, ' ');
+	return *this;
+}
+
+InfoBuffer &InfoBuffer::column(const char *text, std::size_t width)
+{
+	std::size_t mark = this->text.size();
+	append(text);
+	return padFrom(mark, width);
+}
+
+InfoBuffer &InfoBuffer::column(const std::string &text, std::size_t width)
+{
+	std::size_t mark = this->text.size();
+	append(text);
+	return padFrom(mark, width);
+}
+
+void InfoBuffer::checkpoint()
+{
+	if (sink != nullptr && text.size() >= chunkSize)
+		flush();
+}
+
+void InfoBuffer::flush()
+{
+	if (sink == nullptr || text.empty())
+		return;
+	sink->write(text.data(), text.size());
+	text.clear();
+}
+
+bool InfoBuffer::isStreaming() const
+{
+	return sink != nullptr;
+}
+
+std::size_t InfoBuffer::size() const
+{
+	return text.size();
+}
+
+const std::string &InfoBuffer::str() const
+{
+	return text;
+}
+
+InfoBuffer &InfoBuffer::scratch()
+{
+	static thread_local InfoBuffer buffer;
+	return buffer;
+}
@@ -0,0 +1,134 @@
+#ifndef InfoBuffer_h
+#define InfoBuffer_h
+
+#include <cstddef>
+#include <string>
+
+class InfoSink;
+
+/**
+ * @brief Reusable text buffer for rendering component info without iostreams.
+ *
+ * getInfo() used to build a std::ostringstream with setw/setprecision for
+ * every plant, every time the TUI redrew. Components now render through
+ * PlantComponent::writeInfo() into one of these instead: appends go straight
+ * into a std::string whose capacity survives clear(), numbers are formatted
+ * into a stack buffer, and column padding is a single fill. Once a buffer has
+ * grown to the size of the largest report it renders, rendering allocates
+ * nothing.
+ *
+ * **System Role:**
+ * Formatting layer shared by LivingPlant, PlantAttributes, SharedDecorator
+ * and PlantGroup. Callers that render repeatedly (TUI redraws, reports) keep
+ * a buffer and pass it in; getInfo() uses a per-thread scratch buffer.
+ *
+ * Output matches what the stream code produced: fixed() uses printf's "%.Nf"
+ * like std::fixed, general() uses "%g" like a default-formatted stream.
+ *
+ * A buffer constructed with an InfoSink streams instead: renderers call
+ * checkpoint() between self-contained pieces (PlantGroup does so after
+ * every child) and the buffer hands its text to the sink once it holds a
+ * chunk, so memory stays bounded however large the report is.
+ *
+ * @see PlantComponent::writeInfo()
+ * @see InfoSink (streaming destinations)
+ */
+class InfoBuffer
+{
+	public:
+		/**
+		 * @brief Bytes a streaming buffer collects before handing them to its sink.
+		 */
+		static const std::size_t DEFAULT_CHUNK_SIZE = 16384;
+
+		InfoBuffer();
+
+		/**
+		 * @brief Creates a buffer that streams into a sink.
+		 * @param sink Receives the text in chunks; must outlive the buffer.
+		 * @param chunkSize Flush threshold used by checkpoint().
+		 */
+		InfoBuffer(InfoSink *sink, std::size_t chunkSize = DEFAULT_CHUNK_SIZE);
+
+		/**
+		 * @brief Empties the buffer, keeping its capacity.
+		 */
+		void clear();
+
+		/**
+		 * @brief Grows the capacity ahead of a large render.
+		 */
+		void reserve(std::size_t bytes);
+
+		InfoBuffer &append(const char *text);
+		InfoBuffer &append(const char *text, std::size_t length);
+		InfoBuffer &append(const std::string &text);
+
+		/**
+		 * @brief Appends a decimal integer.
+		 */
+		InfoBuffer &integer(long value);
+
+		/**
+		 * @brief Appends a value with a fixed number of decimals (std::fixed).
+		 */
+		InfoBuffer &fixed(double value, int precision);
+
+		/**
+		 * @brief Appends a value the way a default-formatted stream prints it.
+		 */
+		InfoBuffer &general(double value);
+
+		/**
+		 * @brief Left-aligns everything appended since mark in a column (std::left, std::setw).
+		 *
+		 * Pads with spaces up to width; longer text is left as is.
+		 *
+		 * @param mark size() before the column's text was appended.
+		 * @param width Column width.
+		 */
+		InfoBuffer &padFrom(std::size_t mark, std::size_t width);
+
+		/**
+		 * @brief Appends text left-aligned in a column of the given width.
+		 */
+		InfoBuffer &column(const char *text, std::size_t width);
+		InfoBuffer &column(const std::string &text, std::size_t width);
+
+		/**
+		 * @brief Marks a point where the text may be handed over; flushes once a chunk is full.
+		 *
+		 * Anything still referring to earlier offsets (padFrom() marks) must be
+		 * done with them. Does nothing without a sink.
+		 */
+		void checkpoint();
+
+		/**
+		 * @brief Hands everything buffered to the sink. Does nothing without a sink.
+		 */
+		void flush();
+
+		/**
+		 * @brief Whether this buffer streams into a sink.
+		 */
+		bool isStreaming() const;
+
+		std::size_t size() const;
+
+		/**
+		 * @brief Gets the rendered text; valid until the buffer is next changed.
+		 */
+		const std::string &str() const;
+
+		/**
+		 * @brief Gets the calling thread's scratch buffer, for one-shot renders such as getInfo().
+		 */
+		static InfoBuffer &scratch();
+
+	private:
+		std::string text;
+		InfoSink *sink;
+		std::size_t chunkSize;
+};
+
+#endif
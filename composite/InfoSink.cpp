@@ -0,0 +1,54 @@
+#include "InfoSink.h"
+#include <cerrno>
+#include <unistd.h>
+
+StreamInfoSink::StreamInfoSink(std::ostream &out)
+	: out(out)
+{
+}
+
+void StreamInfoSink::write(const char *data, std::size_t length)
+{
+	out.write(data, length);
+}
+
+FdInfoSink::FdInfoSink(int fd)
+	: fd(fd)
+{
+}
+
+void FdInfoSink::write(const char *data, std::size_t length)
+{
+	while (length > 0)
+	{
+		ssize_t written = ::write(fd, data, length);
+		if (written < 0)
+		{
+			if (errno == EINTR)
+				continue;
+			throw "Could not write report to file descriptor";
+		}
+		data += written;
+		length -= (std::size_t)written;
+	}
+}
+
+CallbackInfoSink::CallbackInfoSink(std::function<void(const char *, std::size_t)> callback)
+	: callback(callback)
+{
+}
+
+void CallbackInfoSink::write(const char *data, std::size_t length)
+{
+	callback(data, length);
+}
+
+StringInfoSink::StringInfoSink(std::string &text)
+	: text(text)
+{
+}
+
+void StringInfoSink::write(const char *data, std::size_t length)
+{
+	text.append(data, length);
+}
@@ -0,0 +1,93 @@
+#ifndef InfoSink_h
+#define InfoSink_h
+
+#include <cstddef>
+#include <functional>
+#include <ostream>
+#include <string>
+
+/**
+ * @brief Destination for streamed reports (group info, receipts).
+ *
+ * An InfoBuffer given a sink hands its text over in chunks whenever it has
+ * collected enough, so a report over a 20k-plant group or a wholesale basket
+ * never exists in memory as a whole: only about one chunk is buffered at a
+ * time.
+ *
+ * **System Role:**
+ * Output side of PlantComponent::streamInfo(), Staff::assistPurchases() and
+ * Customer::purchasePlants(). Concrete sinks cover streams, file descriptors,
+ * callbacks and, for the string-returning wrappers, a plain string.
+ *
+ * @see InfoBuffer (collects and flushes the chunks)
+ */
+class InfoSink
+{
+	public:
+		virtual ~InfoSink() {}
+
+		/**
+		 * @brief Consumes one chunk of text.
+		 * @param data Chunk start; only valid for the duration of the call.
+		 * @param length Chunk length in bytes.
+		 */
+		virtual void write(const char *data, std::size_t length) = 0;
+};
+
+/**
+ * @brief Writes chunks to a std::ostream.
+ */
+class StreamInfoSink : public InfoSink
+{
+	public:
+		StreamInfoSink(std::ostream &out);
+		void write(const char *data, std::size_t length);
+
+	private:
+		std::ostream &out;
+};
+
+/**
+ * @brief Writes chunks to a POSIX file descriptor, which stays owned by the caller.
+ */
+class FdInfoSink : public InfoSink
+{
+	public:
+		FdInfoSink(int fd);
+
+		/**
+		 * @throws const char* if the descriptor rejects the write.
+		 */
+		void write(const char *data, std::size_t length);
+
+	private:
+		int fd;
+};
+
+/**
+ * @brief Hands chunks to a callback.
+ */
+class CallbackInfoSink : public InfoSink
+{
+	public:
+		CallbackInfoSink(std::function<void(const char *, std::size_t)> callback);
+		void write(const char *data, std::size_t length);
+
+	private:
+		std::function<void(const char *, std::size_t)> callback;
+};
+
+/**
+ * @brief Appends chunks to a string, for callers that still want the whole report.
+ */
+class StringInfoSink : public InfoSink
+{
+	public:
+		StringInfoSink(std::string &text);
+		void write(const char *data, std::size_t length);
+
+	private:
+		std::string &text;
+};
+
+#endif
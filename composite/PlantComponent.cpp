@@ -1,5 +1,42 @@
 #include "PlantComponent.h"
+#include "InfoBuffer.h"
+#include "InfoSink.h"
+
+std::atomic<unsigned int> PlantComponent::nextId(0);
 
 PlantComponent::PlantComponent(double price, int waterAffect, int sunAffect)
-    : price(price), affectWaterValue(waterAffect), affectSunValue(sunAffect)
-{}
\ No newline at end of file
+    : price(price), affectWaterValue(waterAffect), affectSunValue(sunAffect), id(++nextId)
+{}
+
+PlantComponent::PlantComponent(const PlantComponent &other)
+    : price(other.price), affectWaterValue(other.affectWaterValue), affectSunValue(other.affectSunValue),
+      deleted(other.deleted), id(++nextId)
+{}
+
+unsigned int PlantComponent::getId() const
+{
+    return id;
+}
+
+void PlantComponent::reserveIds(unsigned int highestId)
+{
+    unsigned int current = nextId.load();
+    while (current < highestId && !nextId.compare_exchange_weak(current, highestId))
+    {
+    }
+}
+
+std::string PlantComponent::getInfo()
+{
+    InfoBuffer &buffer = InfoBuffer::scratch();
+    buffer.clear();
+    writeInfo(buffer);
+    return buffer.str();
+}
+
+void PlantComponent::streamInfo(InfoSink &sink)
+{
+    InfoBuffer buffer(&sink);
+    writeInfo(buffer);
+    buffer.flush();
+}
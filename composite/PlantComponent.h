@@ -4,7 +4,10 @@
 #include <string>
 
 #include <list>
+#include <atomic>
 class PlantAttributes;
+class InfoBuffer;
+class InfoSink;
 
 template <typename T>
 class Flyweight;
@@ -59,12 +62,21 @@ enum class ComponentType
  */
 class PlantComponent
 {
+	friend class InventorySnapshot;
+
 protected:
 	double price;
 	int affectWaterValue;
 	int affectSunValue;
 	bool deleted = false;
 
+	/**
+	 * Identifier that stays the same across snapshots and journal replay.
+	 */
+	unsigned int id;
+
+	static std::atomic<unsigned int> nextId;
+
 public:
 	/**
 	 * @brief Constructs a PlantComponent with basic attributes.
@@ -74,6 +86,23 @@ public:
 	 * @param sunAffect Sun affection value.
 	 */
 	PlantComponent(double price, int waterAffect, int sunAffect);
+
+	/**
+	 * @brief Copies a component; the copy receives a new id.
+	 */
+	PlantComponent(const PlantComponent &other);
+
+	/**
+	 * @brief Gets the component's stable identifier (never 0).
+	 */
+	unsigned int getId() const;
+
+	/**
+	 * @brief Ensures ids handed out from now on are greater than highestId.
+	 *
+	 * Called after restoring components whose ids were assigned in an earlier run.
+	 */
+	static void reserveIds(unsigned int highestId);
 	/**
 	 * @brief Clones the plant component (Prototype pattern).
 	 * @return Pointer to a new plant object that is a copy of this one.
@@ -112,9 +141,30 @@ public:
 
 	/**
 	 * @brief Gets plant information as a string.
+	 *
+	 * Renders writeInfo() into the calling thread's scratch buffer and copies
+	 * it out; callers that render repeatedly should keep an InfoBuffer and
+	 * call writeInfo() directly.
+	 *
 	 * @return String containing plant details.
 	 */
-	virtual std::string getInfo() = 0;
+	virtual std::string getInfo();
+
+	/**
+	 * @brief Appends this component's information to a buffer.
+	 * @param out Buffer to render into; existing contents are kept.
+	 */
+	virtual void writeInfo(InfoBuffer &out) = 0;
+
+	/**
+	 * @brief Writes this component's information to a sink in bounded chunks.
+	 *
+	 * Same text as getInfo(), without ever holding all of it: a group hands
+	 * it over chunk by chunk as its children are rendered.
+	 *
+	 * @param sink Destination (stream, file descriptor, callback, ...).
+	 */
+	void streamInfo(InfoSink &sink);
 
 	/**
 	 * @brief Gets plant name as a formatted string.
@@ -122,6 +172,17 @@ public:
 	 */
 	virtual std::string getName() = 0;
 
+	/**
+	 * @brief Gets the name without copying it.
+	 *
+	 * Plants and decorators return their interned flyweight string, so the
+	 * reference stays valid for as long as the Inventory does. Use this in
+	 * loops and comparisons; getName() copies.
+	 *
+	 * @return Reference to the component's name.
+	 */
+	virtual const std::string &getNameView() = 0;
+
 	/**
 	 * @brief Gets the sunlight affection value for this component.
 	 * @return Integer representing sunlight impact.
@@ -1,9 +1,14 @@
 #include "PlantGroup.h"
 #include "../observer/Observer.h"
 #include "../prototype/LivingPlant.h"
-#include <sstream>
+#include "../diagnostics/TickProfiler.h"
+#include "../diagnostics/Tracer.h"
+#include "InfoBuffer.h"
+#include "CareBatch.h"
 #include <algorithm>
 
+std::atomic<unsigned long> PlantGroup::structureVersion(0);
+
 PlantGroup::PlantGroup()
     : PlantComponent(0.0, 0, 0) {};
 
@@ -21,6 +26,7 @@ PlantGroup::~PlantGroup()
         itr++;
         // should work.
     }
+    markStructureChanged();
 }
 
 PlantGroup::PlantGroup(std::string groupName)
@@ -43,10 +49,7 @@ void PlantGroup::setOutside()
 {
     if (!plants.empty())
     {
-        for (PlantComponent *component : plants)
-        {
-            component->setOutside();
-        }
+        CareBatch::setOutside(this);
     }
 };
 
@@ -54,30 +57,25 @@ void PlantGroup::water()
 {
     if (!plants.empty())
     {
-        for (PlantComponent *component : plants)
-        {
-            component->water();
-        }
+        CareBatch::water(this);
     }
 };
 
-std::string PlantGroup::getInfo()
+void PlantGroup::writeInfo(InfoBuffer &out)
 {
-    std::stringstream ss;
-
-    ss << "\n*** Plant Group ***" << std::endl;
-    ss << "---------------------------------" << std::endl;
+    out.append("\n*** Plant Group ***\n");
+    out.append("---------------------------------\n");
     int counter = 0;
     for (PlantComponent *component : plants)
     {
         counter++;
-        ss << component->getDecorator()->getInfo();
+        component->getDecorator()->writeInfo(out);
 
-        ss << "\n--- End of Component" + std::to_string(counter) + " ---\n";
+        out.append("\n--- End of Component").integer(counter).append(" ---\n");
+        out.checkpoint();
     }
 
-    ss << "---------------------------------" << std::endl;
-    return ss.str();
+    out.append("---------------------------------\n");
 };
 
 std::list<PlantComponent *> *PlantGroup::getPlants()
@@ -91,9 +89,20 @@ ComponentType PlantGroup::getType() const
 }
 PlantComponent *PlantGroup::clone()
 {
+    TRACE_SCOPE("clone", "prototype");
     return new PlantGroup(*this);
 };
 
+unsigned long PlantGroup::getStructureVersion()
+{
+    return structureVersion.load();
+}
+
+void PlantGroup::markStructureChanged()
+{
+    structureVersion++;
+}
+
 void PlantGroup::setGroupName(std::string newGroupName)
 {
     this->groupName = newGroupName;
@@ -106,6 +115,7 @@ std::string PlantGroup::getGroupName()
 
 void PlantGroup::update()
 {
+    TickProfiler::PhaseTimer timer(TickProfiler::Phase::UPDATE);
 
     for (PlantComponent *component : plants)
     {
@@ -166,6 +176,7 @@ void PlantGroup::addAttribute(PlantComponent *attribute)
 void PlantGroup::addComponent(PlantComponent *component)
 {
     plants.push_back(component);
+    markStructureChanged();
 }
 
 bool PlantGroup::removeComponent(PlantComponent *component)
@@ -176,6 +187,7 @@ bool PlantGroup::removeComponent(PlantComponent *component)
     if (it != plants.end())
     {
         plants.erase(it);
+        markStructureChanged();
         return true;
     }
 
@@ -196,27 +208,27 @@ bool PlantGroup::removeComponent(PlantComponent *component)
 
 std::string PlantGroup::getName()
 {
-    std::stringstream ss;
-    ss << "Plant Group: ";
+    return getNameView();
+};
 
+const std::string &PlantGroup::getNameView()
+{
+    unsigned long version = structureVersion.load();
+    if (displayNameVersion == version)
+        return displayName;
+
+    displayName.assign("Plant Group: ");
     int count = 0;
     for (PlantComponent *component : plants)
     {
-        if (count < 3)
-        {
-            ss << component->getName() << ", ";
-        }
-        count++;
-    }
-
-    std::string name = ss.str();
-    if (name.length() > 2)
-    {
-        name.pop_back();
-        name.pop_back();
+        if (count++ == 3)
+            break;
+        displayName.append(component->getNameView()).append(", ");
     }
-    return name;
-};
+    displayName.resize(displayName.length() - 2);
+    displayNameVersion = version;
+    return displayName;
+}
 PlantComponent *PlantGroup::correctShape(PlantComponent *component)
 {
     throw "This should never be run";
@@ -257,6 +269,11 @@ void PlantGroup::detach(Observer *careTaker)
  */
 void PlantGroup::waterNeeded(PlantComponent *updatedPlant)
 {
+    if (observers.empty())
+        return;
+    TRACE_SCOPE("waterNeeded", "observer");
+    TickProfiler::PhaseTimer timer(TickProfiler::Phase::OBSERVERS);
+    TickProfiler::countNotifications(observers.size());
     for (Observer *obs : observers)
     {
         obs->getWaterUpdate(updatedPlant);
@@ -268,6 +285,11 @@ void PlantGroup::waterNeeded(PlantComponent *updatedPlant)
  */
 void PlantGroup::sunlightNeeded(PlantComponent *updatedPlant)
 {
+    if (observers.empty())
+        return;
+    TRACE_SCOPE("sunlightNeeded", "observer");
+    TickProfiler::PhaseTimer timer(TickProfiler::Phase::OBSERVERS);
+    TickProfiler::countNotifications(observers.size());
     for (Observer *obs : observers)
     {
         obs->getSunUpdate(updatedPlant);
@@ -279,6 +301,11 @@ void PlantGroup::sunlightNeeded(PlantComponent *updatedPlant)
  */
 void PlantGroup::stateUpdated(PlantComponent *updatedPlant)
 {
+    if (observers.empty())
+        return;
+    TRACE_SCOPE("stateUpdated", "observer");
+    TickProfiler::PhaseTimer timer(TickProfiler::Phase::OBSERVERS);
+    TickProfiler::countNotifications(observers.size());
     for (Observer *obs : observers)
     {
         obs->getStateUpdate(updatedPlant);
@@ -333,8 +360,10 @@ int PlantGroup::getSunlightValue()
 
 void PlantGroup::tick()
 {
+    TRACE_SCOPE("group_tick", "inventory");
     this->update();
-    
+
+    TickProfiler::PhaseTimer timer(TickProfiler::Phase::GROW);
     for (PlantComponent *component : plants)
     {
         component->tick();
@@ -3,6 +3,7 @@
 
 #include <string>
 #include <list>
+#include <atomic>
 #include "PlantComponent.h"
 #include "../observer/Subject.h"
 #include "../decorator/PlantAttributes.h"
@@ -17,6 +18,8 @@
  */
 class PlantGroup : public PlantComponent, public Subject
 {
+	friend class MemoryReport;
+
 private:
 	std::list<PlantComponent *> plants;
 	// This is the list of observers
@@ -24,6 +27,15 @@ private:
 
 	std::string groupName = "";
 
+	// getNameView() cache, rebuilt when structureVersion no longer matches
+	std::string displayName;
+	unsigned long displayNameVersion = ~0ul;
+
+	/**
+	 * @brief Process-wide counter bumped on every structural change to any group.
+	 */
+	static std::atomic<unsigned long> structureVersion;
+
 	/**
 	 * @brief Notifies observers that plants in this group need water.
 	 */
@@ -63,19 +75,23 @@ public:
 
 	/**
 	 * @brief Sets all plants in this group to be outside.
+	 *
+	 * Batched per sun strategy across nested groups (see CareBatch).
 	 */
 	void setOutside();
 
 	/**
 	 * @brief Waters all plants in this group.
+	 *
+	 * Batched per water strategy across nested groups (see CareBatch).
 	 */
 	void water();
 
 	/**
-	 * @brief Gets information about all plants in this group.
-	 * @return String containing details of all plants in the group.
+	 * @brief Renders information about all plants in this group.
+	 * @param out Buffer receiving the details of every plant in the group.
 	 */
-	std::string getInfo();
+	void writeInfo(InfoBuffer &out);
 
 	/**
 	 * @brief Clones the plant group and all its contained plants.
@@ -118,6 +134,16 @@ public:
 	 */
 	std::string getName();
 
+	/**
+	 * @brief Gets the group's display name without rebuilding it.
+	 *
+	 * The name lists the first three children, so it is cached and only
+	 * rebuilt after the structure version moves.
+	 *
+	 * @return Reference valid until the next structural change.
+	 */
+	const std::string &getNameView();
+
 	/**
 	 * @brief Gets the total price of all plants in this group.
 	 * @return Total price in currency units.
@@ -167,6 +193,23 @@ public:
 	virtual void tick();
 	virtual Flyweight<std::string *> *getNameFlyweight() { return nullptr; };
 
+	/**
+	 * @brief Gets the current structure version shared by all groups.
+	 *
+	 * The value changes whenever a component is added to or removed from any
+	 * PlantGroup, or a group is destroyed. Views that cache a flattened hierarchy
+	 * (e.g. the TUI inventory tree) compare it against the version they were
+	 * built from instead of rebuilding on every refresh.
+	 *
+	 * @return Monotonically increasing structure version.
+	 */
+	static unsigned long getStructureVersion();
+
+	/**
+	 * @brief Marks the hierarchy as changed after editing a getPlants() list directly.
+	 */
+	static void markStructureChanged();
+
 	void setGroupName(std::string newGroupName);
 	std::string getGroupName();
 	std::list<Observer *> getObservers();
@@ -27,9 +27,7 @@ LargePot::LargePot(const LargePot &other)
 
 PlantComponent *LargePot::clone()
 {
-    PlantComponent *clone = new LargePot();
-    clone->addAttribute(this->nextComponent->clone());
-    return clone;
+    return this->cloneShared();
 }
 PlantCharm::PlantCharm()
     : PlantAttributes("Standard Plant Charm", 30.00, 0, 0)
@@ -43,9 +41,7 @@ PlantCharm::PlantCharm(const PlantCharm &other)
 
 PlantComponent *PlantCharm::clone()
 {
-    PlantComponent *clone = new PlantCharm();
-    clone->addAttribute(this->nextComponent->clone());
-    return clone;
+    return this->cloneShared();
 }
 
 RedPot::RedPot()
@@ -60,9 +56,7 @@ RedPot::RedPot(const RedPot &other)
 
 PlantComponent *RedPot::clone()
 {
-    PlantComponent *clone = new RedPot();
-    clone->addAttribute(this->nextComponent->clone());
-    return clone;
+    return this->cloneShared();
 }
 
 ShopThemedCharm::ShopThemedCharm()
@@ -77,9 +71,7 @@ ShopThemedCharm::ShopThemedCharm(const ShopThemedCharm &other)
 
 PlantComponent *ShopThemedCharm::clone()
 {
-    PlantComponent *clone = new ShopThemedCharm();
-    clone->addAttribute(this->nextComponent->clone());
-    return clone;
+    return this->cloneShared();
 }
 
 Autumn::Autumn()
@@ -94,9 +86,7 @@ Autumn::Autumn(const Autumn &other)
 
 PlantComponent *Autumn::clone()
 {
-    PlantComponent *clone = new Autumn();
-    clone->addAttribute(this->nextComponent->clone());
-        return clone->correctShape(clone);
+    return this->cloneSharedPlant();
 }
 
 LargeFlowers::LargeFlowers()
@@ -111,9 +101,7 @@ LargeFlowers::LargeFlowers(const LargeFlowers &other)
 
 PlantComponent *LargeFlowers::clone()
 {
-    PlantComponent *clone = new LargeFlowers();
-    clone->addAttribute(this->nextComponent->clone());
-    return clone;
+    return this->cloneShared();
 }
 
 LargeLeaf::LargeLeaf()
@@ -128,9 +116,7 @@ LargeLeaf::LargeLeaf(const LargeLeaf &other)
 
 PlantComponent *LargeLeaf::clone()
 {
-    PlantComponent *clone = new LargeLeaf();
-    clone->addAttribute(this->nextComponent->clone());
-    return clone;
+    return this->cloneShared();
 }
 
 LargeStem::LargeStem()
@@ -145,9 +131,7 @@ LargeStem::LargeStem(const LargeStem &other)
 
 PlantComponent *LargeStem::clone()
 {
-    PlantComponent *clone = new LargeStem();
-    clone->addAttribute(this->nextComponent->clone());
-    return clone;
+    return this->cloneShared();
 }
 
 SmallFlowers::SmallFlowers()
@@ -163,9 +147,7 @@ SmallFlowers::SmallFlowers(const SmallFlowers &other)
 
 PlantComponent *SmallFlowers::clone()
 {
-    PlantComponent *clone = new SmallFlowers();
-    clone->addAttribute(this->nextComponent->clone());
-    return clone;
+    return this->cloneShared();
 }
 
 SmallLeaf::SmallLeaf()
@@ -180,9 +162,7 @@ SmallLeaf::SmallLeaf(const SmallLeaf &other)
 
 PlantComponent *SmallLeaf::clone()
 {
-    PlantComponent *clone = new SmallLeaf();
-    clone->addAttribute(this->nextComponent->clone());
-    return clone;
+    return this->cloneShared();
 }
 
 SmallStem::SmallStem()
@@ -197,9 +177,7 @@ SmallStem::SmallStem(const SmallStem &other)
 
 PlantComponent *SmallStem::clone()
 {
-    PlantComponent *clone = new SmallStem();
-    clone->addAttribute(this->nextComponent->clone());
-    return clone;
+    return this->cloneShared();
 }
 
 Spring::Spring()
@@ -214,9 +192,7 @@ Spring::Spring(const Spring &other)
 
 PlantComponent *Spring::clone()
 {
-    PlantComponent *clone = new Spring();
-    clone->addAttribute(this->nextComponent->clone());
-        return clone->correctShape(clone);
+    return this->cloneSharedPlant();
 }
 
 Summer::Summer()
@@ -231,9 +207,7 @@ Summer::Summer(const Summer &other)
 
 PlantComponent *Summer::clone()
 {
-    PlantComponent *clone = new Summer();
-    clone->addAttribute(this->nextComponent->clone());
-        return clone->correctShape(clone);
+    return this->cloneSharedPlant();
 }
 
 Thorns::Thorns()
@@ -248,9 +222,7 @@ Thorns::Thorns(const Thorns &other)
 
 PlantComponent *Thorns::clone()
 {
-    PlantComponent *clone = new Thorns();
-    clone->addAttribute(this->nextComponent->clone());
-    return clone;
+    return this->cloneShared();
 }
 
 Winter::Winter()
@@ -265,7 +237,5 @@ Winter::Winter(const Winter &other)
 
 PlantComponent *Winter::clone()
 {
-    PlantComponent *clone = new Winter();
-    clone->addAttribute(this->nextComponent->clone());
-    return clone->correctShape(clone);
+    return this->cloneSharedPlant();
 }
\ No newline at end of file
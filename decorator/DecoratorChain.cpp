@@ -0,0 +1,158 @@
+#include "DecoratorChain.h"
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+
+/**
+ * @brief Interned chains by hash. Chains delete themselves from here on their
+ * last release, so the pool only holds live chains.
+ *
+ * Never destroyed: plants still alive during static destruction must be able
+ * to release their chains.
+ */
+struct DecoratorChainPool
+{
+	std::mutex lock;
+	std::unordered_multimap<std::size_t, DecoratorChain *> chains;
+
+	static DecoratorChainPool &get()
+	{
+		static DecoratorChainPool *instance = new DecoratorChainPool();
+		return *instance;
+	}
+};
+
+bool DecoratorChain::Attribute::operator==(const Attribute &other) const
+{
+	return name == other.name && price == other.price &&
+		   affectWater == other.affectWater && affectSun == other.affectSun;
+}
+
+DecoratorChain::DecoratorChain(const std::vector<Attribute> &attributes, std::size_t hash)
+	: attributes(attributes), hash(hash), totalPrice(0.0), totalWater(0), totalSun(0), references(1)
+{
+	for (const Attribute &attribute : attributes)
+	{
+		attribute.name->retain();
+		totalPrice += attribute.price;
+		totalWater += attribute.affectWater;
+		totalSun += attribute.affectSun;
+	}
+}
+
+std::size_t DecoratorChain::hashOf(const std::vector<Attribute> &attributes)
+{
+	std::size_t hash = attributes.size();
+	for (const Attribute &attribute : attributes)
+	{
+		uint64_t priceBits;
+		std::memcpy(&priceBits, &attribute.price, sizeof(priceBits));
+		std::size_t parts[] = {std::hash<const void *>()(attribute.name), std::hash<uint64_t>()(priceBits),
+							   std::hash<int>()(attribute.affectWater), std::hash<int>()(attribute.affectSun)};
+		for (std::size_t part : parts)
+			hash ^= part + 0x9e3779b97f4a7c15ull + (hash << 6) + (hash >> 2);
+	}
+	return hash;
+}
+
+DecoratorChain *DecoratorChain::intern(const std::vector<Attribute> &attributes)
+{
+	if (attributes.empty())
+		throw "Cannot intern an empty decorator chain";
+
+	std::size_t hash = hashOf(attributes);
+	DecoratorChainPool &pool = DecoratorChainPool::get();
+	std::lock_guard<std::mutex> guard(pool.lock);
+
+	typedef std::unordered_multimap<std::size_t, DecoratorChain *>::iterator Iterator;
+	std::pair<Iterator, Iterator> range = pool.chains.equal_range(hash);
+	for (Iterator it = range.first; it != range.second; ++it)
+	{
+		if (it->second->attributes == attributes)
+			return it->second->acquire();
+	}
+
+	DecoratorChain *chain = new DecoratorChain(attributes, hash);
+	pool.chains.insert(std::make_pair(hash, chain));
+	return chain;
+}
+
+DecoratorChain *DecoratorChain::acquire()
+{
+	references.fetch_add(1, std::memory_order_relaxed);
+	return this;
+}
+
+void DecoratorChain::release()
+{
+	// Under the pool lock so intern() cannot hand out a chain that is being deleted
+	DecoratorChainPool &pool = DecoratorChainPool::get();
+	std::lock_guard<std::mutex> guard(pool.lock);
+	if (references.fetch_sub(1, std::memory_order_acq_rel) != 1)
+		return;
+
+	typedef std::unordered_multimap<std::size_t, DecoratorChain *>::iterator Iterator;
+	std::pair<Iterator, Iterator> range = pool.chains.equal_range(hash);
+	for (Iterator it = range.first; it != range.second; ++it)
+	{
+		if (it->second == this)
+		{
+			pool.chains.erase(it);
+			break;
+		}
+	}
+	for (const Attribute &attribute : attributes)
+		attribute.name->release();
+	delete this;
+}
+
+std::size_t DecoratorChain::size() const
+{
+	return attributes.size();
+}
+
+const DecoratorChain::Attribute &DecoratorChain::get(std::size_t index) const
+{
+	return attributes[index];
+}
+
+const std::vector<DecoratorChain::Attribute> &DecoratorChain::getAttributes() const
+{
+	return attributes;
+}
+
+double DecoratorChain::getPrice() const
+{
+	return totalPrice;
+}
+
+int DecoratorChain::getAffectWater() const
+{
+	return totalWater;
+}
+
+int DecoratorChain::getAffectSun() const
+{
+	return totalSun;
+}
+
+long DecoratorChain::getReferenceCount() const
+{
+	return references.load(std::memory_order_relaxed);
+}
+
+DecoratorChain::PoolStats DecoratorChain::getPoolStats()
+{
+	DecoratorChainPool &pool = DecoratorChainPool::get();
+	std::lock_guard<std::mutex> guard(pool.lock);
+
+	PoolStats stats;
+	stats.chains = pool.chains.size();
+	stats.attributes = 0;
+	stats.buckets = pool.chains.bucket_count();
+	for (std::unordered_multimap<std::size_t, DecoratorChain *>::value_type &entry : pool.chains)
+		stats.attributes += entry.second->attributes.capacity();
+	return stats;
+}
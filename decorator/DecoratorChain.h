@@ -0,0 +1,135 @@
+#ifndef DecoratorChain_h
+#define DecoratorChain_h
+
+#include <atomic>
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "../flyweight/Flyweight.h"
+
+/**
+ * @brief Interned, immutable list of decorator attributes shared by cloned plants.
+ *
+ * A decorated plant used to own one PlantAttributes node per layer, and every
+ * clone copied all of them. A chain holds the same layers as plain values,
+ * outermost first, with their price and care totals precomputed. intern()
+ * hash-conses chains, so every Rose with the same decorations points at one
+ * chain no matter how often it is cloned.
+ *
+ * Chains never change once interned. A plant that gets another attribute
+ * interns a new chain and releases the old one (copy-on-write), which leaves
+ * every other plant sharing the old chain untouched.
+ *
+ * **System Role:**
+ * Shared state behind SharedDecorator. Reference counted; the last release
+ * removes the chain from the pool. intern() and release() lock the pool,
+ * acquire() is a single atomic increment. A chain holds a reference on each
+ * layer's name string, so the string pool keeps them while the chain lives.
+ *
+ * **Pattern Role:** Flyweight (intrinsic decorator state shared across plants)
+ *
+ * @see SharedDecorator (per-plant handle onto a chain)
+ * @see PlantAttributes (the unshared decorator nodes chains are built from)
+ */
+class DecoratorChain
+{
+	public:
+		/**
+		 * @brief One decorator layer.
+		 */
+		struct Attribute
+		{
+			Flyweight<std::string *> *name;
+			double price;
+			int affectWater;
+			int affectSun;
+
+			bool operator==(const Attribute &other) const;
+		};
+
+		/**
+		 * @brief Size of the intern pool, for memory reports.
+		 */
+		struct PoolStats
+		{
+			std::size_t chains;
+			std::size_t attributes;
+			std::size_t buckets;
+		};
+
+		/**
+		 * @brief Finds or creates the chain holding these attributes.
+		 * @param attributes Layers, outermost first; must not be empty.
+		 * @return The shared chain with one reference taken for the caller.
+		 */
+		static DecoratorChain *intern(const std::vector<Attribute> &attributes);
+
+		/**
+		 * @brief Takes another reference to this chain.
+		 * @return This chain.
+		 */
+		DecoratorChain *acquire();
+
+		/**
+		 * @brief Drops one reference; the last one deletes the chain.
+		 */
+		void release();
+
+		/**
+		 * @brief Gets the number of layers.
+		 */
+		std::size_t size() const;
+
+		/**
+		 * @brief Gets a layer (0 is the outermost).
+		 */
+		const Attribute &get(std::size_t index) const;
+
+		/**
+		 * @brief Gets all layers, outermost first.
+		 */
+		const std::vector<Attribute> &getAttributes() const;
+
+		/**
+		 * @brief Sum of the layers' prices.
+		 */
+		double getPrice() const;
+
+		/**
+		 * @brief Sum of the layers' water affection.
+		 */
+		int getAffectWater() const;
+
+		/**
+		 * @brief Sum of the layers' sun affection.
+		 */
+		int getAffectSun() const;
+
+		/**
+		 * @brief Gets the number of references held on this chain.
+		 */
+		long getReferenceCount() const;
+
+		/**
+		 * @brief Gets the pool's current size.
+		 */
+		static PoolStats getPoolStats();
+
+	private:
+		friend struct DecoratorChainPool;
+
+		DecoratorChain(const std::vector<Attribute> &attributes, std::size_t hash);
+		DecoratorChain(const DecoratorChain &);
+		DecoratorChain &operator=(const DecoratorChain &);
+
+		static std::size_t hashOf(const std::vector<Attribute> &attributes);
+
+		std::vector<Attribute> attributes;
+		std::size_t hash;
+		double totalPrice;
+		int totalWater;
+		int totalSun;
+		std::atomic<long> references;
+};
+
+#endif
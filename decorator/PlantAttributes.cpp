@@ -1,19 +1,29 @@
 #include "PlantAttributes.h"
-#include <sstream>
-#include <iomanip>
+#include "SharedDecorator.h"
+#include "../prototype/LivingPlant.h"
+#include "../composite/InfoBuffer.h"
 
 PlantAttributes::PlantAttributes(std::string name, double price, int waterAffect, int sunAffect)
     : PlantComponent(price, waterAffect, sunAffect),
 
       nextComponent(nullptr),
       name(Inventory::getInstance()->getString(name)) {
+    this->name->retain();
+};
 
-      };
+PlantAttributes::PlantAttributes(Flyweight<std::string *> *name, double price, int waterAffect, int sunAffect)
+    : PlantComponent(price, waterAffect, sunAffect),
+      nextComponent(nullptr),
+      name(name) {
+    this->name->retain();
+};
 
 PlantAttributes::PlantAttributes(const PlantAttributes &other)
     : PlantComponent(other),
       nextComponent(other.nextComponent->clone()),
-      name(other.name) {};
+      name(other.name) {
+    this->name->retain();
+};
 
 void PlantAttributes::water()
 {
@@ -33,15 +43,29 @@ void PlantAttributes::update()
         nextComponent->update();
 };
 
-std::string PlantAttributes::getInfo()
+void PlantAttributes::writeInfo(InfoBuffer &out)
 {
-    std::string baseInfo = (nextComponent != nullptr) ? nextComponent->getInfo() : "";
-    std::stringstream ss;
-    ss << baseInfo;
-    ss<< *name->getState() << "\t Price R" << this->price<<std::setprecision(2) << "\t Affect on water\t[" + to_string(this->affectWaterValue) << "]" << "\t Affect on sunlight\t[" + to_string(this->affectSunValue) << "]" << "\n";
-    return ss.str();
+    if (nextComponent != nullptr)
+        nextComponent->writeInfo(out);
+    writeInfoLine(out, getAttribute(0));
 };
 
+void PlantAttributes::writeInfoLine(InfoBuffer &out, const DecoratorChain::Attribute &attribute)
+{
+    out.append(*attribute.name->getState()).append("\t Price R").general(attribute.price);
+    out.append("\t Affect on water\t[").integer(attribute.affectWater).append("]");
+    out.append("\t Affect on sunlight\t[").integer(attribute.affectSun).append("]\n");
+}
+
+void PlantAttributes::invalidatePlantInfo()
+{
+    PlantComponent *component = nextComponent;
+    while (component != nullptr && component->getType() == ComponentType::PLANT_COMPONENT)
+        component = static_cast<PlantAttributes *>(component)->nextComponent;
+    if (component != nullptr && component->getType() == ComponentType::LIVING_PLANT)
+        static_cast<LivingPlant *>(component)->invalidateInfo();
+}
+
 double PlantAttributes::getPrice()
 {
     double nextPrice = (nextComponent != nullptr) ? nextComponent->getPrice() : 0.0;
@@ -53,6 +77,11 @@ std::string PlantAttributes::getName()
     return *name->getState();
 };
 
+const std::string &PlantAttributes::getNameView()
+{
+    return *name->getState();
+}
+
 int PlantAttributes::affectSunlight()
 {
     int baseAffect = (nextComponent) ? nextComponent->affectSunlight() : 0;
@@ -74,6 +103,7 @@ void PlantAttributes::addAttribute(PlantComponent *attribute)
         attribute->addAttribute(nextComponent);
         this->nextComponent = attribute;
     }
+    invalidatePlantInfo();
 };
 PlantComponent *PlantAttributes::correctShape(PlantComponent *mainDecorator)
 {
@@ -87,6 +117,7 @@ PlantComponent *PlantAttributes::correctShape(PlantComponent *mainDecorator)
 };
 PlantAttributes::~PlantAttributes()
 {
+    name->release();
     if (nextComponent && nextComponent->isDeleted() == false)
     {
         nextComponent->markDeletion();
@@ -112,4 +143,56 @@ void PlantAttributes::tick()
 {
     if (nextComponent)
         nextComponent->tick();
-}
\ No newline at end of file
+}
+
+std::size_t PlantAttributes::getAttributeCount()
+{
+    return 1;
+}
+
+DecoratorChain::Attribute PlantAttributes::getAttribute(std::size_t)
+{
+    DecoratorChain::Attribute attribute;
+    attribute.name = this->name;
+    attribute.price = this->price;
+    attribute.affectWater = this->affectWaterValue;
+    attribute.affectSun = this->affectSunValue;
+    return attribute;
+}
+
+PlantComponent *PlantAttributes::collectAttributes(std::vector<DecoratorChain::Attribute> &attributes)
+{
+    PlantComponent *component = this;
+    while (component != nullptr && component->getType() == ComponentType::PLANT_COMPONENT)
+    {
+        PlantAttributes *attribute = static_cast<PlantAttributes *>(component);
+        for (std::size_t i = 0; i < attribute->getAttributeCount(); i++)
+            attributes.push_back(attribute->getAttribute(i));
+        component = attribute->nextComponent;
+    }
+    return component;
+}
+
+PlantComponent *PlantAttributes::cloneShared()
+{
+    std::vector<DecoratorChain::Attribute> attributes;
+    PlantComponent *base = collectAttributes(attributes);
+    DecoratorChain *chain = DecoratorChain::intern(attributes);
+
+    if (base && base->getType() == ComponentType::LIVING_PLANT)
+        return SharedDecorator::cloneBlock(static_cast<LivingPlant *>(base), chain);
+
+    PlantComponent *clone = new SharedDecorator(chain);
+    if (base)
+        clone->addAttribute(base->clone());
+    return clone;
+}
+
+PlantComponent *PlantAttributes::cloneSharedPlant()
+{
+    PlantComponent *clone = cloneShared();
+    PlantComponent *plant = static_cast<PlantAttributes *>(clone)->nextComponent;
+    if (plant != nullptr && plant->getType() == ComponentType::LIVING_PLANT)
+        return plant;
+    return this->nextComponent ? clone->correctShape(clone) : clone;
+}
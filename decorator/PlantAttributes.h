@@ -4,6 +4,7 @@
 #include <string>
 #include "../composite/PlantComponent.h"
 #include "../flyweight/Flyweight.h"
+#include "DecoratorChain.h"
 #include "../singleton/Singleton.h"
 
 /**
@@ -35,19 +36,59 @@
  * - affectWater/Sunlight() modify care requirements
  * - addAttribute() chains decorators together
  *
- * - clone() creates deep copy including all decorators
+ * - clone() copies the plant and shares the decorator layers (see cloneShared())
  *
  * @see PlantComponent (wrapped component)
  * @see Concrete decorators: LargePot, Spring, etc.
  */
 class PlantAttributes : public PlantComponent
 {
+	friend class InventorySnapshot;
+	friend class MemoryReport;
+	friend class CareBatch;
+
 protected:
 	PlantComponent *nextComponent;
 
 	// Name of the attribute
 	Flyweight<std::string *> *name;
 
+	/**
+	 * @brief Constructs a decorator from an already interned name.
+	 */
+	PlantAttributes(Flyweight<std::string *> *name, double price, int waterAffect, int sunAffect);
+
+	/**
+	 * @brief Clones the decorated plant with its layers interned into one SharedDecorator.
+	 *
+	 * Concrete decorators' clone() delegates here, so cloned plants share a
+	 * single DecoratorChain instead of copying every node.
+	 *
+	 * @return The new handle wrapping a clone of the plant (no plant if this decorator has none).
+	 */
+	PlantComponent *cloneShared();
+
+	/**
+	 * @brief Clones the decorated plant like cloneShared() and returns the plant itself.
+	 *
+	 * Used by the season decorators, whose clone() has always handed back the
+	 * plant. cloneBlock() has already linked the copy to its handle, so the plant
+	 * is taken from the handle instead of walking the chain with correctShape().
+	 *
+	 * @return The cloned plant, or the handle if this decorator wraps no plant.
+	 */
+	PlantComponent *cloneSharedPlant();
+
+	/**
+	 * @brief Writes one getInfo() line for a layer.
+	 */
+	static void writeInfoLine(InfoBuffer &out, const DecoratorChain::Attribute &attribute);
+
+	/**
+	 * @brief Drops the cached info of the plant at the end of this chain, after the layers changed.
+	 */
+	void invalidatePlantInfo();
+
 public:
 	/**
 	 * @brief Constructs a plant attribute decorator.
@@ -76,10 +117,10 @@ public:
 	int affectWater();
 
 	/**
-	 * @brief Gets plant information including decorator details.
-	 * @return String containing plant and decorator details.
+	 * @brief Renders plant information followed by this decorator's details.
+	 * @param out Buffer receiving the plant and decorator details.
 	 */
-	std::string getInfo();
+	void writeInfo(InfoBuffer &out);
 
 	/**
 	 * @brief Gets the price including decorator modifications.
@@ -93,6 +134,11 @@ public:
 	 */
 	std::string getName();
 
+	/**
+	 * @brief Gets the interned attribute name without copying it.
+	 */
+	const std::string &getNameView();
+
 	/**
 	 * @brief Waters the plant component.
 	 */
@@ -177,6 +223,24 @@ public:
 	virtual void tick();
 
 	virtual Flyweight<std::string *> *getNameFlyweight() { return this->name; };
+
+	/**
+	 * @brief Collects the layers from this node down to the first non-decorator.
+	 * @param attributes Receives the layers, outermost first.
+	 * @return The component the chain wraps, or nullptr.
+	 */
+	PlantComponent *collectAttributes(std::vector<DecoratorChain::Attribute> &attributes);
+
+	/**
+	 * @brief Gets how many decorator layers this node stands for.
+	 * @return 1, or the length of a shared chain.
+	 */
+	virtual std::size_t getAttributeCount();
+
+	/**
+	 * @brief Gets one of this node's layers (0 is the outermost).
+	 */
+	virtual DecoratorChain::Attribute getAttribute(std::size_t index);
 };
 
 #endif
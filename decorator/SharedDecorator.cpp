@@ -0,0 +1,167 @@
+#include "SharedDecorator.h"
+#include "../prototype/LivingPlant.h"
+#include "../diagnostics/Tracer.h"
+#include <new>
+#include "../composite/InfoBuffer.h"
+
+/*
+ * Every handle is preceded by one word. Stand-alone handles (operator new)
+ * store 0 there. A handle in a cloneBlock() allocation stores its offset from
+ * the start of the block, i.e. from its plant, and sets PLANT_FREES_BLOCK when
+ * the plant's own delete is the one that will release the block.
+ */
+namespace
+{
+    const std::size_t HEADER_SIZE = sizeof(std::size_t);
+    const std::size_t PLANT_FREES_BLOCK = 1;
+
+    std::size_t &headerOf(void *handle)
+    {
+        return *reinterpret_cast<std::size_t *>(static_cast<char *>(handle) - HEADER_SIZE);
+    }
+
+    std::size_t alignUp(std::size_t size)
+    {
+        return (size + HEADER_SIZE - 1) & ~(HEADER_SIZE - 1);
+    }
+}
+
+SharedDecorator::SharedDecorator(DecoratorChain *chain)
+    : PlantAttributes(chain->get(0).name, chain->getPrice(), chain->getAffectWater(), chain->getAffectSun()),
+      chain(chain)
+{
+}
+
+SharedDecorator::SharedDecorator(DecoratorChain *chain, LivingPlant *plant)
+    : PlantAttributes(chain->get(0).name, chain->getPrice(), chain->getAffectWater(), chain->getAffectSun()),
+      chain(chain)
+{
+    this->nextComponent = plant;
+}
+
+SharedDecorator *SharedDecorator::cloneBlock(LivingPlant *plant, DecoratorChain *chain)
+{
+    TRACE_SCOPE("clone", "prototype");
+    std::size_t handleOffset = alignUp(plant->getCloneSize()) + HEADER_SIZE;
+    char *block = static_cast<char *>(::operator new(handleOffset + sizeof(SharedDecorator)));
+
+    LivingPlant *copy = plant->cloneInto(block);
+    headerOf(block + handleOffset) = handleOffset;
+    SharedDecorator *handle = ::new (block + handleOffset) SharedDecorator(chain, copy);
+    copy->correctShape(handle);
+    return handle;
+}
+
+SharedDecorator::~SharedDecorator()
+{
+    chain->release();
+    if (isEmbedded() && nextComponent != nullptr)
+    {
+        if (nextComponent->isDeleted())
+        {
+            // The plant is being deleted and frees the block once it is done
+            headerOf(this) |= PLANT_FREES_BLOCK;
+        }
+        else
+        {
+            // Destroy the plant in place; operator delete then frees the block
+            nextComponent->markDeletion();
+            nextComponent->~PlantComponent();
+        }
+        nextComponent = nullptr;
+    }
+}
+
+void *SharedDecorator::operator new(std::size_t size)
+{
+    char *memory = static_cast<char *>(::operator new(HEADER_SIZE + size));
+    headerOf(memory + HEADER_SIZE) = 0;
+    return memory + HEADER_SIZE;
+}
+
+void SharedDecorator::operator delete(void *memory)
+{
+    std::size_t header = headerOf(memory);
+    if (header == 0)
+        ::operator delete(static_cast<char *>(memory) - HEADER_SIZE);
+    else if ((header & PLANT_FREES_BLOCK) == 0)
+        ::operator delete(static_cast<char *>(memory) - header);
+}
+
+bool SharedDecorator::isEmbedded() const
+{
+    return headerOf(const_cast<SharedDecorator *>(this)) != 0;
+}
+
+void SharedDecorator::writeInfo(InfoBuffer &out)
+{
+    if (nextComponent != nullptr)
+        nextComponent->writeInfo(out);
+    for (std::size_t i = chain->size(); i > 0; i--)
+        writeInfoLine(out, chain->get(i - 1));
+}
+
+void SharedDecorator::addAttribute(PlantComponent *attribute)
+{
+    // Attaching the plant, or an attribute that carries a plant of its own: link as usual
+    std::vector<DecoratorChain::Attribute> added;
+    if (nextComponent == nullptr || attribute->getType() != ComponentType::PLANT_COMPONENT ||
+        static_cast<PlantAttributes *>(attribute)->collectAttributes(added) != nullptr)
+    {
+        // Nothing may sit between a block's handle and its plant
+        if (isEmbedded())
+            throw "Cannot link a decorated component behind a cloned plant's decorator";
+        PlantAttributes::addAttribute(attribute);
+        return;
+    }
+
+    std::vector<DecoratorChain::Attribute> attributes(chain->getAttributes());
+    attributes.insert(attributes.begin() + 1, added.begin(), added.end());
+    DecoratorChain *merged = DecoratorChain::intern(attributes);
+    chain->release();
+    chain = merged;
+
+    this->price = chain->getPrice();
+    this->affectWaterValue = chain->getAffectWater();
+    this->affectSunValue = chain->getAffectSun();
+    delete attribute;
+    invalidatePlantInfo();
+}
+
+PlantComponent *SharedDecorator::clone()
+{
+    // Mixed chains (a concrete decorator below this handle) are flattened into one chain
+    if (nextComponent != nullptr && nextComponent->getType() == ComponentType::PLANT_COMPONENT)
+        return cloneShared();
+
+    if (nextComponent == nullptr)
+        return new SharedDecorator(chain->acquire());
+
+    if (nextComponent->getType() != ComponentType::LIVING_PLANT)
+    {
+        SharedDecorator *clone = new SharedDecorator(chain->acquire());
+        clone->addAttribute(nextComponent->clone());
+        return clone;
+    }
+
+    LivingPlant *plant = static_cast<LivingPlant *>(nextComponent);
+    SharedDecorator *clone = cloneBlock(plant, chain->acquire());
+    if (plant->getDecorator() == this)
+        return clone->nextComponent;
+    return clone;
+}
+
+std::size_t SharedDecorator::getAttributeCount()
+{
+    return chain->size();
+}
+
+DecoratorChain::Attribute SharedDecorator::getAttribute(std::size_t index)
+{
+    return chain->get(index);
+}
+
+DecoratorChain *SharedDecorator::getChain()
+{
+    return chain;
+}
@@ -0,0 +1,115 @@
+#ifndef SharedDecorator_h
+#define SharedDecorator_h
+
+#include "PlantAttributes.h"
+#include "DecoratorChain.h"
+
+class LivingPlant;
+
+/**
+ * @brief A plant's handle onto an interned DecoratorChain.
+ *
+ * Stands in for a whole stack of concrete decorators with a single node: the
+ * layers live in the shared chain, and the node's own price and care values
+ * are the chain's totals, so getPrice() and affectWater()/affectSunlight()
+ * need no walk at all. Cloning a decorated plant produces one of these, and
+ * cloning a handle only copies the plant and takes another chain reference.
+ *
+ * Clones of a plant are laid out by cloneBlock(): the plant copy and its
+ * handle share one allocation, linked as they are constructed. Deleting
+ * either one destroys both and frees the block once. Handles therefore only
+ * live on the heap, created with new or by cloneBlock().
+ *
+ * addAttribute() is copy-on-write: the new layers are inserted behind the
+ * head, exactly where a concrete chain would put them, the result is interned
+ * and the old chain released. The added attribute object is consumed.
+ *
+ * **System Role:**
+ * Keeps a million cloned plants at roughly LivingPlant size instead of one
+ * heap node per decoration. Anything that walks a decorator chain reads the
+ * layers through getAttributeCount()/getAttribute().
+ *
+ * **Pattern Role:** Concrete Decorator (backed by Flyweight state)
+ *
+ * @see DecoratorChain (shared layers)
+ * @see PlantAttributes::cloneShared() (turns a concrete chain into a handle)
+ */
+class SharedDecorator : public PlantAttributes
+{
+	public:
+		/**
+		 * @brief Wraps a chain, taking over one reference the caller holds.
+		 */
+		SharedDecorator(DecoratorChain *chain);
+
+		/**
+		 * @brief Clones a plant together with a handle onto a chain, in one allocation.
+		 *
+		 * The plant is copied with LivingPlant::cloneInto() at the start of the
+		 * block and the handle placed behind it; the plant's decorator and the
+		 * handle's next component are set in the same pass.
+		 *
+		 * @param plant Plant to copy.
+		 * @param chain Layers for the copy; the caller's reference is taken over.
+		 * @return The new handle.
+		 */
+		static SharedDecorator *cloneBlock(LivingPlant *plant, DecoratorChain *chain);
+
+		/**
+		 * @brief Releases the chain. A handle sharing a block with its plant
+		 * also destroys the plant, unless the plant's own deletion got here first.
+		 */
+		virtual ~SharedDecorator();
+
+		/**
+		 * @brief Allocates a stand-alone handle, behind a header marking it as such.
+		 */
+		static void *operator new(std::size_t size);
+
+		/**
+		 * @brief Frees a stand-alone handle, or the block a handle shares with its plant.
+		 */
+		static void operator delete(void *memory);
+
+		/**
+		 * @brief Whether this handle shares its allocation with its plant.
+		 */
+		bool isEmbedded() const;
+
+		/**
+		 * @brief Plant information followed by one line per layer, innermost first.
+		 */
+		void writeInfo(InfoBuffer &out);
+
+		/**
+		 * @brief Adds layers behind the head by interning a new chain.
+		 * @param attribute Decorator(s) to add; deleted once merged.
+		 * @throws const char* if a handle sharing a block with its plant is given a component that carries a plant of its own.
+		 */
+		void addAttribute(PlantComponent *attribute);
+
+		/**
+		 * @brief Clones the plant and shares the chain with the copy.
+		 * @return The cloned plant if this handle is its plant's decorator, else the new handle.
+		 */
+		PlantComponent *clone();
+
+		std::size_t getAttributeCount();
+
+		DecoratorChain::Attribute getAttribute(std::size_t index);
+
+		/**
+		 * @brief Gets the shared chain.
+		 */
+		DecoratorChain *getChain();
+
+	private:
+		/**
+		 * @brief Constructs a handle inside a cloneBlock() allocation.
+		 */
+		SharedDecorator(DecoratorChain *chain, LivingPlant *plant);
+
+		DecoratorChain *chain;
+};
+
+#endif
@@ -48,7 +48,7 @@ class LargePot : public PlantAttributes
 
         /**
          * @brief Clones the decorated plant component (Prototype pattern).
-         * @return Pointer to a new LargePot decorator wrapping a clone of the underlying component.
+         * @return A SharedDecorator holding this chain's layers, wrapping a clone of the underlying component.
          */
         PlantComponent* clone();
 
@@ -33,7 +33,7 @@ class PlantCharm : public PlantAttributes
 
         /**
          * @brief Clones the decorated plant component (Prototype pattern).
-         * @return Pointer to a new PlantCharm decorator wrapping a clone of the underlying component.
+         * @return A SharedDecorator holding this chain's layers, wrapping a clone of the underlying component.
          */
         PlantComponent* clone();
 
@@ -38,10 +38,9 @@ class Autumn : public PlantAttributes
 
         /**
          * @brief Clones the decorated plant component (Prototype pattern).
-         * * Creates a deep copy of this Autumn decorator and the entire wrapped
-         * component chain.
-         * * @return Pointer to a new Autumn decorator wrapping a clone of the 
-         * underlying component.
+         * * Copies the wrapped plant; the decorator layers are interned and
+         * shared with the copy through a SharedDecorator.
+         * * @return The cloned plant, decorated by a SharedDecorator holding this chain's layers.
          */
         PlantComponent* clone();
 
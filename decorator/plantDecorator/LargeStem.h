@@ -33,7 +33,7 @@ class LargeStem : public PlantAttributes
 
         /**
          * @brief Clones the decorated plant component (Prototype pattern).
-         * @return Pointer to a new LargeStem decorator wrapping a clone of the underlying component.
+         * @return A SharedDecorator holding this chain's layers, wrapping a clone of the underlying component.
          */
         PlantComponent* clone();
 
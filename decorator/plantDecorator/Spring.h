@@ -50,7 +50,7 @@ class Spring : public PlantAttributes
 
         /**
          * @brief Clones the decorated plant component (Prototype pattern).
-         * @return Pointer to a new Spring decorator wrapping a clone of the underlying component.
+         * @return The cloned plant, decorated by a SharedDecorator holding this chain's layers.
          */
         PlantComponent* clone();
 
@@ -35,7 +35,7 @@ class Summer : public PlantAttributes
 
         /**
          * @brief Clones the decorated plant component (Prototype pattern).
-         * @return Pointer to a new Summer decorator wrapping a clone of the underlying component.
+         * @return The cloned plant, decorated by a SharedDecorator holding this chain's layers.
          */
         PlantComponent* clone();
 
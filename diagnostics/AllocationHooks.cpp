@@ -0,0 +1,92 @@
+/**
+ * @file AllocationHooks.cpp
+ * @brief Global operator new/delete replacements feeding AllocationTracker.
+ *
+ * Compiled in only with PHOTOSYNTECH_ALLOCATION_HOOKS (`make ALLOCATION_HOOKS=1`,
+ * the default for the test runner and bench_app); otherwise this file is empty
+ * and the standard allocator is untouched. The TUI does not build it.
+ */
+
+#include "AllocationTracker.h"
+
+#ifdef PHOTOSYNTECH_ALLOCATION_HOOKS
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+	void *allocate(std::size_t size)
+	{
+		void *memory = std::malloc(size ? size : 1);
+		if (!memory)
+			throw std::bad_alloc();
+		AllocationTracker::recordAllocation(size);
+		return memory;
+	}
+
+	void release(void *memory)
+	{
+		if (!memory)
+			return;
+		AllocationTracker::recordDeallocation();
+		std::free(memory);
+	}
+}
+
+void *operator new(std::size_t size)
+{
+	return allocate(size);
+}
+
+void *operator new[](std::size_t size)
+{
+	return allocate(size);
+}
+
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept
+{
+	void *memory = std::malloc(size ? size : 1);
+	if (memory)
+		AllocationTracker::recordAllocation(size);
+	return memory;
+}
+
+void *operator new[](std::size_t size, const std::nothrow_t &) noexcept
+{
+	void *memory = std::malloc(size ? size : 1);
+	if (memory)
+		AllocationTracker::recordAllocation(size);
+	return memory;
+}
+
+void operator delete(void *memory) noexcept
+{
+	release(memory);
+}
+
+void operator delete[](void *memory) noexcept
+{
+	release(memory);
+}
+
+void operator delete(void *memory, std::size_t) noexcept
+{
+	release(memory);
+}
+
+void operator delete[](void *memory, std::size_t) noexcept
+{
+	release(memory);
+}
+
+void operator delete(void *memory, const std::nothrow_t &) noexcept
+{
+	release(memory);
+}
+
+void operator delete[](void *memory, const std::nothrow_t &) noexcept
+{
+	release(memory);
+}
+
+#endif
@@ -0,0 +1,133 @@
+#include "AllocationTracker.h"
+#include <atomic>
+
+namespace
+{
+	const int TAG_COUNT = static_cast<int>(AllocationTracker::Tag::COUNT);
+
+	struct SharedCounts
+	{
+		std::atomic<uint64_t> allocations;
+		std::atomic<uint64_t> deallocations;
+		std::atomic<uint64_t> bytes;
+	};
+
+	// Zero-initialised statics: usable by hooks that run before main()
+	SharedCounts totals;
+	SharedCounts tags[TAG_COUNT];
+	std::atomic<bool> installed(false);
+
+	// Plain thread_local PODs need no construction, so the hooks can touch them safely
+	thread_local AllocationTracker::Counts threadCounts;
+	thread_local AllocationTracker::Tag currentTag;
+
+	AllocationTracker::Counts load(const SharedCounts &shared)
+	{
+		AllocationTracker::Counts counts;
+		counts.allocations = shared.allocations.load(std::memory_order_relaxed);
+		counts.deallocations = shared.deallocations.load(std::memory_order_relaxed);
+		counts.bytes = shared.bytes.load(std::memory_order_relaxed);
+		return counts;
+	}
+}
+
+AllocationTracker::Scope::Scope()
+	: start(getThreadCounts())
+{
+}
+
+AllocationTracker::Counts AllocationTracker::Scope::getCounts() const
+{
+	Counts now = getThreadCounts();
+	now.allocations -= start.allocations;
+	now.deallocations -= start.deallocations;
+	now.bytes -= start.bytes;
+	return now;
+}
+
+uint64_t AllocationTracker::Scope::getAllocations() const
+{
+	return getCounts().allocations;
+}
+
+AllocationTracker::TagScope::TagScope(Tag tag)
+	: previous(currentTag)
+{
+	currentTag = tag;
+}
+
+AllocationTracker::TagScope::~TagScope()
+{
+	currentTag = previous;
+}
+
+bool AllocationTracker::isInstalled()
+{
+	return installed.load(std::memory_order_relaxed);
+}
+
+AllocationTracker::Counts AllocationTracker::getThreadCounts()
+{
+	return threadCounts;
+}
+
+AllocationTracker::Counts AllocationTracker::getTotalCounts()
+{
+	return load(totals);
+}
+
+AllocationTracker::Counts AllocationTracker::getTagCounts(Tag tag)
+{
+	return load(tags[static_cast<int>(tag)]);
+}
+
+void AllocationTracker::resetTagCounts()
+{
+	for (SharedCounts &shared : tags)
+	{
+		shared.allocations.store(0, std::memory_order_relaxed);
+		shared.deallocations.store(0, std::memory_order_relaxed);
+		shared.bytes.store(0, std::memory_order_relaxed);
+	}
+}
+
+const char *AllocationTracker::getTagName(Tag tag)
+{
+	switch (tag)
+	{
+	case Tag::TICK:
+		return "tick";
+	case Tag::BUILDER:
+		return "builder";
+	case Tag::FACADE:
+		return "facade";
+	case Tag::SNAPSHOT:
+		return "snapshot";
+	case Tag::JOURNAL:
+		return "journal";
+	default:
+		return "untagged";
+	}
+}
+
+void AllocationTracker::recordAllocation(std::size_t size)
+{
+	if (!installed.load(std::memory_order_relaxed))
+		installed.store(true, std::memory_order_relaxed);
+
+	threadCounts.allocations++;
+	threadCounts.bytes += size;
+	totals.allocations.fetch_add(1, std::memory_order_relaxed);
+	totals.bytes.fetch_add(size, std::memory_order_relaxed);
+
+	SharedCounts &tagged = tags[static_cast<int>(currentTag)];
+	tagged.allocations.fetch_add(1, std::memory_order_relaxed);
+	tagged.bytes.fetch_add(size, std::memory_order_relaxed);
+}
+
+void AllocationTracker::recordDeallocation()
+{
+	threadCounts.deallocations++;
+	totals.deallocations.fetch_add(1, std::memory_order_relaxed);
+	tags[static_cast<int>(currentTag)].deallocations.fetch_add(1, std::memory_order_relaxed);
+}
@@ -0,0 +1,138 @@
+#ifndef PHOTOSYNTECH_ALLOCATIONTRACKER_H
+#define PHOTOSYNTECH_ALLOCATIONTRACKER_H
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Heap allocation counters with per-scope and per-subsystem views.
+ *
+ * Counts operator new/delete calls so benchmarks and tests can assert on
+ * allocation behaviour, e.g. that a steady-state tick allocates nothing or
+ * that getInfo() stays within a budget.
+ *
+ * **System Role:**
+ * Diagnostics layer. The counting hooks (global operator new/delete
+ * replacements) live in AllocationHooks.cpp and are compiled in only with
+ * PHOTOSYNTECH_ALLOCATION_HOOKS: the makefile defines it unless
+ * ALLOCATION_HOOKS=0, and the TUI does not build them. Without the hooks
+ * every counter stays at zero and isInstalled() returns false.
+ *
+ * **Views:**
+ * - Scope: allocations made by the current thread since the scope began;
+ *   other threads (e.g. the ticker) never pollute it
+ * - TagScope: attributes the current thread's allocations to a subsystem
+ *   until it ends; nested tags override outer ones
+ * - getTotalCounts(): every allocation in the process, on any thread
+ *
+ * Counting is a few relaxed increments per allocation; nothing here allocates.
+ *
+ * @see BenchHarness (reports allocations/op from the total counts)
+ */
+class AllocationTracker
+{
+	public:
+		/**
+		 * @brief Subsystems allocations can be attributed to.
+		 */
+		enum class Tag
+		{
+			UNTAGGED,
+			TICK,	  ///< Inventory::tickOnce()
+			BUILDER,  ///< Director::construct()
+			FACADE,	  ///< NurseryFacade plant creation
+			SNAPSHOT, ///< InventorySnapshot save/restore
+			JOURNAL,  ///< InventoryJournal record encoding
+			COUNT
+		};
+
+		/**
+		 * @brief Allocation statistics.
+		 */
+		struct Counts
+		{
+			uint64_t allocations;
+			uint64_t deallocations;
+			uint64_t bytes; ///< Bytes requested by the counted allocations
+		};
+
+		/**
+		 * @brief Measures the current thread's allocations over a lexical scope.
+		 */
+		class Scope
+		{
+			public:
+				Scope();
+
+				/**
+				 * @brief Gets the allocations made by this thread since construction.
+				 */
+				Counts getCounts() const;
+
+				/**
+				 * @brief Shorthand for getCounts().allocations.
+				 */
+				uint64_t getAllocations() const;
+
+			private:
+				Counts start;
+		};
+
+		/**
+		 * @brief Attributes the current thread's allocations to a subsystem while alive.
+		 */
+		class TagScope
+		{
+			public:
+				TagScope(Tag tag);
+				~TagScope();
+
+			private:
+				TagScope(const TagScope &);
+				TagScope &operator=(const TagScope &);
+
+				Tag previous;
+		};
+
+		/**
+		 * @brief Checks whether the counting hooks are linked into this program.
+		 */
+		static bool isInstalled();
+
+		/**
+		 * @brief Gets the current thread's counts since it started.
+		 */
+		static Counts getThreadCounts();
+
+		/**
+		 * @brief Gets the counts for every thread since the program started.
+		 */
+		static Counts getTotalCounts();
+
+		/**
+		 * @brief Gets the counts attributed to a subsystem since the last reset.
+		 */
+		static Counts getTagCounts(Tag tag);
+
+		/**
+		 * @brief Zeroes every subsystem's counts.
+		 */
+		static void resetTagCounts();
+
+		/**
+		 * @brief Gets a subsystem's display name.
+		 */
+		static const char *getTagName(Tag tag);
+
+		/**
+		 * @brief Called by the operator new hooks.
+		 */
+		static void recordAllocation(std::size_t size);
+
+		/**
+		 * @brief Called by the operator delete hooks.
+		 */
+		static void recordDeallocation();
+};
+
+#endif //PHOTOSYNTECH_ALLOCATIONTRACKER_H
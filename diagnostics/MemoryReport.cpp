@@ -0,0 +1,330 @@
+#include "MemoryReport.h"
+#include "../composite/PlantGroup.h"
+#include "../decorator/PlantAttributes.h"
+#include "../decorator/SharedDecorator.h"
+#include "../mediator/Customer.h"
+#include "../mediator/Staff.h"
+#include "../prototype/LivingPlant.h"
+#include "../singleton/Singleton.h"
+#include "../state/MaturityState.h"
+#include <iomanip>
+#include <string>
+#include <type_traits>
+
+namespace
+{
+	const int CATEGORY_COUNT = static_cast<int>(MemoryReport::Category::COUNT);
+
+	/// A std::list node: two links and the value.
+	template <typename T>
+	uint64_t listNodeBytes()
+	{
+		return 2 * sizeof(void *) + sizeof(T);
+	}
+
+	/**
+	 * @brief Bytes a string keeps outside its own object (0 while the short-string buffer is used).
+	 */
+	uint64_t stringHeapBytes(const std::string &text)
+	{
+		const char *data = text.data();
+		const char *self = reinterpret_cast<const char *>(&text);
+		if (data >= self && data < self + sizeof(std::string))
+			return 0;
+		return text.capacity() + 1;
+	}
+
+	uint64_t heapBytes(const std::string &key)
+	{
+		return stringHeapBytes(key);
+	}
+
+	uint64_t heapBytes(int)
+	{
+		return 0;
+	}
+
+	uint64_t heapBytes(std::string *data)
+	{
+		return sizeof(std::string) + stringHeapBytes(*data);
+	}
+
+	template <typename Shared>
+	uint64_t heapBytes(Shared *data)
+	{
+		return sizeof(*data);
+	}
+
+	/**
+	 * @brief Footprint of a flyweight factory: the factory, its map, the buckets,
+	 * the index chunks, the free index list, one node plus one Flyweight per
+	 * entry, and the data the flyweights own.
+	 */
+	template <typename ID, typename T>
+	MemoryReport::Entry measureFactory(const FlyweightFactory<ID, T> *factory)
+	{
+		// libstdc++ caches the hash in the node for keys that are expensive to hash
+		const uint64_t nodeBytes = sizeof(void *) + sizeof(std::pair<const ID, Flyweight<T> *>) +
+								   (std::is_same<ID, std::string>::value ? sizeof(std::size_t) : 0);
+
+		MemoryReport::Entry entry;
+		entry.objects = factory->getSize();
+		entry.allocations = 3 + 3 * entry.objects + factory->getChunkCount() + (factory->getFreeIndexCount() > 0);
+		entry.bytes = sizeof(FlyweightFactory<ID, T>) + sizeof(std::unordered_map<ID, Flyweight<T> *>) +
+					  factory->getBucketCount() * sizeof(void *) +
+					  factory->getChunkCount() * FlyweightFactory<ID, T>::CHUNK_SIZE * sizeof(Flyweight<T> *) +
+					  factory->getFreeIndexCount() * sizeof(uint16_t) +
+					  entry.objects * (nodeBytes + sizeof(Flyweight<T>));
+		factory->forEach([&entry](const ID &id, Flyweight<T> *flyweight)
+						 {
+							 uint64_t keyBytes = heapBytes(id);
+							 entry.allocations += keyBytes > 0;
+							 entry.bytes += keyBytes + heapBytes(flyweight->getState()); });
+		return entry;
+	}
+}
+
+MemoryReport::MemoryReport()
+	: plantCount(0)
+{
+	for (Entry &entry : entries)
+		entry.objects = entry.allocations = entry.bytes = 0;
+}
+
+MemoryReport MemoryReport::measure()
+{
+	Inventory *inv = Inventory::getInstance();
+	MemoryReport report = measure(inv->getInventory());
+	report.measureFlyweights();
+	report.measureDecoratorChains();
+	report.measureUsers();
+	return report;
+}
+
+MemoryReport MemoryReport::measure(PlantGroup *root)
+{
+	MemoryReport report;
+	if (root)
+		report.addGroup(root, Category::COUNT);
+	return report;
+}
+
+void MemoryReport::add(Category category, uint64_t objects, uint64_t allocations, uint64_t bytes)
+{
+	Entry &entry = entries[static_cast<int>(category)];
+	entry.objects += objects;
+	entry.allocations += allocations;
+	entry.bytes += bytes;
+}
+
+/*
+ * charge is Category::COUNT for inventory groups, whose parts are split over
+ * the plant, decorator, group and list categories. Customer baskets pass
+ * Category::CUSTOMERS so their whole subtree is charged to the customer.
+ */
+void MemoryReport::addGroup(PlantGroup *group, Category charge)
+{
+	bool split = charge == Category::COUNT;
+	uint64_t nameBytes = stringHeapBytes(group->groupName);
+	uint64_t displayNameBytes = stringHeapBytes(group->displayName);
+	add(split ? Category::GROUPS : charge, 1, 1 + (nameBytes > 0) + (displayNameBytes > 0),
+		sizeof(PlantGroup) + nameBytes + displayNameBytes);
+	add(split ? Category::GROUP_LISTS : charge, group->plants.size(), group->plants.size(),
+		group->plants.size() * listNodeBytes<PlantComponent *>());
+	add(split ? Category::OBSERVER_LISTS : charge, group->observers.size(), group->observers.size(),
+		group->observers.size() * listNodeBytes<Observer *>());
+
+	for (PlantComponent *component : group->plants)
+	{
+		if (component->getType() == ComponentType::PLANT_GROUP)
+			addGroup(static_cast<PlantGroup *>(component), charge);
+		else
+			addPlant(component, charge);
+	}
+}
+
+void MemoryReport::addPlant(PlantComponent *component, Category charge)
+{
+	bool split = charge == Category::COUNT;
+	LivingPlant *plant = dynamic_cast<LivingPlant *>(component);
+	if (!plant)
+		return;
+
+	plantCount++;
+	add(split ? Category::PLANTS : charge, 1, 1, sizeof(LivingPlant));
+
+	// A shared handle carries a one-word header, and shares its plant's block when cloned
+	uint64_t decorators = 0;
+	uint64_t allocations = 0;
+	uint64_t bytes = 0;
+	for (PlantComponent *c = plant->decorator; c != nullptr && c != plant;
+		 c = static_cast<PlantAttributes *>(c)->nextComponent)
+	{
+		SharedDecorator *shared = dynamic_cast<SharedDecorator *>(c);
+		decorators++;
+		allocations += !(shared && shared->isEmbedded());
+		bytes += shared ? sizeof(std::size_t) + sizeof(SharedDecorator) : sizeof(PlantAttributes);
+	}
+	add(split ? Category::DECORATORS : charge, decorators, allocations, bytes);
+
+	// Held while it is read so a concurrent writeInfo() cannot free it
+	LivingPlant::CachedInfo *info = plant->takeInfo();
+	if (info != nullptr)
+	{
+		uint64_t textBytes = stringHeapBytes(info->text);
+		add(split ? Category::PLANT_INFO : charge, 1, 1 + (textBytes > 0), sizeof(*info) + textBytes);
+	}
+	plant->keepInfo(info);
+}
+
+void MemoryReport::measureFlyweights()
+{
+	Inventory *inv = Inventory::getInstance();
+
+	Entry strings = measureFactory(inv->stringFactory);
+	add(Category::FLYWEIGHT_STRINGS, strings.objects, strings.allocations, strings.bytes);
+
+	Entry water = measureFactory(inv->waterStrategies);
+	Entry sun = measureFactory(inv->sunStrategies);
+	add(Category::FLYWEIGHT_STRATEGIES, water.objects + sun.objects, water.allocations + sun.allocations, water.bytes + sun.bytes);
+
+	Entry states = measureFactory(inv->states);
+	add(Category::FLYWEIGHT_STATES, states.objects, states.allocations, states.bytes);
+}
+
+/*
+ * The pool is a multimap from hash to chain; each chain owns one vector of
+ * attributes. Chains are process-wide, so this is only measured with the
+ * whole inventory.
+ */
+void MemoryReport::measureDecoratorChains()
+{
+	DecoratorChain::PoolStats pool = DecoratorChain::getPoolStats();
+	uint64_t chains = pool.chains;
+	add(Category::DECORATOR_CHAINS, chains, 1 + 3 * chains,
+		pool.buckets * sizeof(void *) +
+			chains * (sizeof(void *) + sizeof(std::pair<const std::size_t, DecoratorChain *>) + sizeof(DecoratorChain)) +
+			pool.attributes * sizeof(DecoratorChain::Attribute));
+}
+
+void MemoryReport::measureUsers()
+{
+	Inventory *inv = Inventory::getInstance();
+
+	std::vector<Staff *> *staff = inv->staffList;
+	add(Category::STAFF, 0, 2, sizeof(*staff) + staff->capacity() * sizeof(Staff *));
+	for (Staff *member : *staff)
+	{
+		uint64_t nameBytes = stringHeapBytes(member->getName());
+		add(Category::STAFF, 1, 1 + (nameBytes > 0), sizeof(Staff) + nameBytes);
+	}
+
+	std::vector<Customer *> *customers = inv->customerList;
+	add(Category::CUSTOMERS, 0, 2, sizeof(*customers) + customers->capacity() * sizeof(Customer *));
+	for (Customer *customer : *customers)
+	{
+		uint64_t nameBytes = stringHeapBytes(customer->getName());
+		add(Category::CUSTOMERS, 1, 1 + (nameBytes > 0), sizeof(Customer) + nameBytes);
+		if (customer->getBasket())
+			addGroup(customer->getBasket(), Category::CUSTOMERS);
+	}
+}
+
+const MemoryReport::Entry &MemoryReport::get(Category category) const
+{
+	return entries[static_cast<int>(category)];
+}
+
+uint64_t MemoryReport::getPlantCount() const
+{
+	return plantCount;
+}
+
+uint64_t MemoryReport::getTotalBytes() const
+{
+	uint64_t total = 0;
+	for (const Entry &entry : entries)
+		total += entry.bytes;
+	return total;
+}
+
+double MemoryReport::getBytesPerPlant() const
+{
+	return plantCount ? (double)getTotalBytes() / plantCount : 0.0;
+}
+
+const char *MemoryReport::getCategoryName(Category category)
+{
+	switch (category)
+	{
+	case Category::PLANTS:
+		return "plants";
+	case Category::DECORATORS:
+		return "decorators";
+	case Category::DECORATOR_CHAINS:
+		return "decorator_chains";
+	case Category::PLANT_INFO:
+		return "plant_info";
+	case Category::GROUPS:
+		return "groups";
+	case Category::GROUP_LISTS:
+		return "group_lists";
+	case Category::OBSERVER_LISTS:
+		return "observer_lists";
+	case Category::FLYWEIGHT_STRINGS:
+		return "flyweight_strings";
+	case Category::FLYWEIGHT_STRATEGIES:
+		return "flyweight_strategies";
+	case Category::FLYWEIGHT_STATES:
+		return "flyweight_states";
+	case Category::STAFF:
+		return "staff";
+	case Category::CUSTOMERS:
+		return "customers";
+	default:
+		return "unknown";
+	}
+}
+
+void MemoryReport::writeText(std::ostream &out) const
+{
+	std::ios::fmtflags flags = out.flags();
+	std::streamsize precision = out.precision();
+
+	out << "Memory footprint: " << plantCount << " plants, " << getTotalBytes() << " bytes ("
+		<< std::fixed << std::setprecision(1) << getBytesPerPlant() << " bytes/plant)\n"
+		<< "  " << std::left << std::setw(22) << "category" << std::right
+		<< std::setw(12) << "objects" << std::setw(14) << "allocations" << std::setw(16) << "bytes" << "\n";
+	for (int c = 0; c < CATEGORY_COUNT; c++)
+	{
+		out << "  " << std::left << std::setw(22) << getCategoryName(static_cast<Category>(c)) << std::right
+			<< std::setw(12) << entries[c].objects
+			<< std::setw(14) << entries[c].allocations
+			<< std::setw(16) << entries[c].bytes << "\n";
+	}
+
+	out.flags(flags);
+	out.precision(precision);
+}
+
+void MemoryReport::writeJson(std::ostream &out) const
+{
+	std::ios::fmtflags flags = out.flags();
+	std::streamsize precision = out.precision();
+
+	out << std::fixed << std::setprecision(1)
+		<< "{\"schema\": 1, \"plants\": " << plantCount
+		<< ", \"total_bytes\": " << getTotalBytes()
+		<< ", \"bytes_per_plant\": " << getBytesPerPlant() << ", \"categories\": {";
+	for (int c = 0; c < CATEGORY_COUNT; c++)
+	{
+		out << (c == 0 ? "" : ", ") << "\"" << getCategoryName(static_cast<Category>(c)) << "\": {"
+			<< "\"objects\": " << entries[c].objects
+			<< ", \"allocations\": " << entries[c].allocations
+			<< ", \"bytes\": " << entries[c].bytes << "}";
+	}
+	out << "}}\n";
+
+	out.flags(flags);
+	out.precision(precision);
+}
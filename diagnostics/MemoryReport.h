@@ -0,0 +1,125 @@
+#ifndef PHOTOSYNTECH_MEMORYREPORT_H
+#define PHOTOSYNTECH_MEMORYREPORT_H
+
+#include <cstdint>
+#include <ostream>
+
+class PlantComponent;
+class PlantGroup;
+
+/**
+ * @brief Memory footprint of the Inventory, broken down by subsystem.
+ *
+ * measure() walks the inventory tree, the flyweight factories and the
+ * staff/customer lists and adds up what each part occupies on the heap:
+ * object sizes, list and hash-map nodes, vector capacity and out-of-line
+ * string storage. Byte counts are requested sizes, the same figure
+ * AllocationTracker reports; allocator overhead is left out but can be
+ * estimated from the allocation counts (roughly 16 bytes each with glibc).
+ *
+ * Shared objects are charged once to the cache that owns them: a plant's
+ * name, season and strategy flyweights cost it a pointer each, and the
+ * strings and strategies themselves appear under the flyweight categories.
+ * Likewise a cloned plant's SharedDecorator is one decorator object, and the
+ * chain it shares appears once under decorator_chains. That split is what
+ * makes the flyweight saving measurable.
+ *
+ * **System Role:**
+ * Diagnostics layer. Works without the allocation hooks, so the TUI can show
+ * it too. Walking the tree is O(plants); do not call it from every tick.
+ *
+ * @see WorkloadGenerator (builds the large nurseries bytes-per-plant is measured on)
+ */
+class MemoryReport
+{
+	public:
+		/**
+		 * @brief Subsystems the footprint is split into.
+		 */
+		enum class Category
+		{
+			PLANTS,				  ///< LivingPlant objects
+			DECORATORS,			  ///< PlantAttributes objects, SharedDecorator handles included
+			DECORATOR_CHAINS,	  ///< Interned DecoratorChains shared by the handles
+			PLANT_INFO,			  ///< Info text cached by plants that have been displayed
+			GROUPS,				  ///< PlantGroup objects and their names
+			GROUP_LISTS,		  ///< Nodes of the groups' child lists
+			OBSERVER_LISTS,		  ///< Nodes of the groups' observer lists
+			FLYWEIGHT_STRINGS,	  ///< Season and name string cache
+			FLYWEIGHT_STRATEGIES, ///< Water and sun strategy caches
+			FLYWEIGHT_STATES,	  ///< Maturity state cache
+			STAFF,				  ///< Staff objects and the staff list
+			CUSTOMERS,			  ///< Customer objects, their baskets and the customer list
+			COUNT
+		};
+
+		/**
+		 * @brief Footprint of one category.
+		 */
+		struct Entry
+		{
+			uint64_t objects;	  ///< Things counted (plants, nodes, cached flyweights...)
+			uint64_t allocations; ///< Heap blocks they occupy
+			uint64_t bytes;		  ///< Bytes requested for those blocks
+		};
+
+		MemoryReport();
+
+		/**
+		 * @brief Measures the whole Inventory.
+		 */
+		static MemoryReport measure();
+
+		/**
+		 * @brief Measures one subtree only; flyweights, staff and customers stay zero.
+		 */
+		static MemoryReport measure(PlantGroup *root);
+
+		/**
+		 * @brief Gets one category's footprint.
+		 */
+		const Entry &get(Category category) const;
+
+		/**
+		 * @brief Gets the number of plants measured.
+		 */
+		uint64_t getPlantCount() const;
+
+		/**
+		 * @brief Sums every category.
+		 */
+		uint64_t getTotalBytes() const;
+
+		/**
+		 * @brief Total bytes divided by the number of plants (0 without plants).
+		 */
+		double getBytesPerPlant() const;
+
+		/**
+		 * @brief Gets a category's display name.
+		 */
+		static const char *getCategoryName(Category category);
+
+		/**
+		 * @brief Writes a human-readable table.
+		 */
+		void writeText(std::ostream &out) const;
+
+		/**
+		 * @brief Writes the report as a single JSON object (schema version 1).
+		 */
+		void writeJson(std::ostream &out) const;
+
+	private:
+		void add(Category category, uint64_t objects, uint64_t allocations, uint64_t bytes);
+		void addGroup(PlantGroup *group, Category category);
+		void addPlant(PlantComponent *plant, Category category);
+		void measureFlyweights();
+		void measureDecoratorChains();
+		void measureUsers();
+
+		Entry entries[static_cast<int>(Category::COUNT)];
+		uint64_t plantCount;
+};
+
+#endif //PHOTOSYNTECH_MEMORYREPORT_H
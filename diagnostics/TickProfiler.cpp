@@ -0,0 +1,281 @@
+#include "TickProfiler.h"
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <vector>
+
+namespace
+{
+	const int PHASE_COUNT = static_cast<int>(TickProfiler::Phase::COUNT);
+	const int NO_PHASE = -1;
+
+	static_assert(sizeof(TickMetrics::phases) / sizeof(TickMetrics::phases[0]) == PHASE_COUNT,
+				  "TickMetrics::phases must have one entry per TickProfiler::Phase");
+
+	/**
+	 * @brief The tick being measured on this thread; plain POD so no construction is needed.
+	 */
+	struct Frame
+	{
+		bool open;
+		int phase;			 ///< Phase being timed, or NO_PHASE
+		uint64_t phaseStart; ///< When the current phase was last entered or resumed
+		uint64_t tickStart;
+		uint64_t spent[PHASE_COUNT];
+		uint64_t transitions;
+		uint64_t notifications;
+	};
+
+	thread_local Frame frame;
+
+	uint64_t now()
+	{
+		return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+				   std::chrono::steady_clock::now().time_since_epoch())
+			.count();
+	}
+
+	/**
+	 * @brief Charges the time since the last switch to the current phase.
+	 */
+	uint64_t settle()
+	{
+		uint64_t at = now();
+		if (frame.phase != NO_PHASE)
+			frame.spent[frame.phase] += at - frame.phaseStart;
+		frame.phaseStart = at;
+		return at;
+	}
+
+	void writePhaseJson(std::ostream &out, const TickMetrics::Phase &phase)
+	{
+		out << "{\"name\": \"" << phase.name << "\""
+			<< ", \"p50_ns\": " << phase.p50Ns
+			<< ", \"p99_ns\": " << phase.p99Ns
+			<< ", \"max_ns\": " << phase.maxNs
+			<< ", \"mean_ns\": " << phase.meanNs << "}";
+	}
+
+	void writePhaseText(std::ostream &out, const TickMetrics::Phase &phase)
+	{
+		out << "  " << std::left << std::setw(10) << phase.name << std::right
+			<< std::setw(12) << phase.p50Ns
+			<< std::setw(12) << phase.p99Ns
+			<< std::setw(12) << phase.maxNs
+			<< std::setw(14) << phase.meanNs << "\n";
+	}
+}
+
+const std::size_t TickProfiler::WINDOW;
+
+TickProfiler::PhaseTimer::PhaseTimer(Phase phase)
+	: previous(NO_PHASE), active(frame.open)
+{
+	if (!active)
+		return;
+	settle();
+	previous = frame.phase;
+	frame.phase = static_cast<int>(phase);
+}
+
+TickProfiler::PhaseTimer::~PhaseTimer()
+{
+	if (!active)
+		return;
+	settle();
+	frame.phase = previous;
+}
+
+TickProfiler::TickProfiler()
+	: dumpOut(nullptr), dumpEvery(0), dumpFormat(Format::TEXT)
+{
+	reset();
+}
+
+void TickProfiler::beginTick()
+{
+	frame.open = true;
+	frame.phase = NO_PHASE;
+	frame.transitions = 0;
+	frame.notifications = 0;
+	for (int p = 0; p < PHASE_COUNT; p++)
+		frame.spent[p] = 0;
+	frame.tickStart = frame.phaseStart = now();
+}
+
+void TickProfiler::endTick()
+{
+	if (!frame.open)
+		return;
+	uint64_t total = settle() - frame.tickStart;
+	frame.open = false;
+
+	std::ostream *out = nullptr;
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		std::size_t slot = ticks % WINDOW;
+		totals[slot] = total;
+		sumTotal += total;
+		maxTotal = std::max(maxTotal, total);
+		for (int p = 0; p < PHASE_COUNT; p++)
+		{
+			samples[p][slot] = frame.spent[p];
+			sumPhase[p] += frame.spent[p];
+			maxPhase[p] = std::max(maxPhase[p], frame.spent[p]);
+		}
+		ticks++;
+
+		lastTransitions = frame.transitions;
+		lastNotifications = frame.notifications;
+		maxTransitions = std::max(maxTransitions, frame.transitions);
+		maxNotifications = std::max(maxNotifications, frame.notifications);
+		totalTransitions += frame.transitions;
+		totalNotifications += frame.notifications;
+
+		if (dumpOut && dumpEvery > 0 && ticks % dumpEvery == 0)
+			out = dumpOut;
+	}
+
+	if (out)
+	{
+		TickMetrics metrics = getMetrics();
+		if (dumpFormat == Format::JSON)
+			metrics.writeJson(*out);
+		else
+			metrics.writeText(*out);
+		out->flush();
+	}
+}
+
+TickMetrics::Phase TickProfiler::summarise(const char *name, const uint64_t *samples, std::size_t count, uint64_t max)
+{
+	TickMetrics::Phase phase;
+	phase.name = name;
+	phase.p50Ns = phase.p99Ns = 0;
+	phase.maxNs = max;
+	phase.meanNs = 0.0;
+	if (count == 0)
+		return phase;
+
+	std::vector<uint64_t> sorted(samples, samples + count);
+	std::sort(sorted.begin(), sorted.end());
+	phase.p50Ns = sorted[(count - 1) / 2];
+	phase.p99Ns = sorted[(count - 1) * 99 / 100];
+	return phase;
+}
+
+TickMetrics TickProfiler::getMetrics() const
+{
+	std::lock_guard<std::mutex> guard(lock);
+	std::size_t count = (std::size_t)std::min<uint64_t>(ticks, WINDOW);
+
+	TickMetrics metrics;
+	metrics.ticks = ticks;
+	metrics.window = count;
+	metrics.total = summarise("total", totals, count, maxTotal);
+	metrics.total.meanNs = ticks ? (double)sumTotal / ticks : 0.0;
+	for (int p = 0; p < PHASE_COUNT; p++)
+	{
+		metrics.phases[p] = summarise(getPhaseName(static_cast<Phase>(p)), samples[p], count, maxPhase[p]);
+		metrics.phases[p].meanNs = ticks ? (double)sumPhase[p] / ticks : 0.0;
+	}
+
+	metrics.lastTransitions = lastTransitions;
+	metrics.lastNotifications = lastNotifications;
+	metrics.maxTransitions = maxTransitions;
+	metrics.maxNotifications = maxNotifications;
+	metrics.totalTransitions = totalTransitions;
+	metrics.totalNotifications = totalNotifications;
+	return metrics;
+}
+
+void TickProfiler::reset()
+{
+	std::lock_guard<std::mutex> guard(lock);
+	ticks = 0;
+	maxTotal = sumTotal = 0;
+	for (int p = 0; p < PHASE_COUNT; p++)
+		maxPhase[p] = sumPhase[p] = 0;
+	lastTransitions = lastNotifications = 0;
+	maxTransitions = maxNotifications = 0;
+	totalTransitions = totalNotifications = 0;
+}
+
+void TickProfiler::setDump(std::ostream *out, int everyTicks, Format format)
+{
+	std::lock_guard<std::mutex> guard(lock);
+	dumpOut = out;
+	dumpEvery = everyTicks;
+	dumpFormat = format;
+}
+
+void TickProfiler::countTransition()
+{
+	if (frame.open)
+		frame.transitions++;
+}
+
+void TickProfiler::countNotifications(std::size_t observers)
+{
+	if (frame.open)
+		frame.notifications += observers;
+}
+
+const char *TickProfiler::getPhaseName(Phase phase)
+{
+	switch (phase)
+	{
+	case Phase::UPDATE:
+		return "update";
+	case Phase::OBSERVERS:
+		return "observers";
+	case Phase::GROW:
+		return "grow";
+	case Phase::SEASON:
+		return "season";
+	default:
+		return "unknown";
+	}
+}
+
+void TickMetrics::writeText(std::ostream &out) const
+{
+	std::ios::fmtflags flags = out.flags();
+	std::streamsize precision = out.precision();
+
+	out << "Tick metrics: " << ticks << " ticks (percentiles over last " << window << ")\n"
+		<< "  " << std::left << std::setw(10) << "phase" << std::right
+		<< std::setw(12) << "p50 ns" << std::setw(12) << "p99 ns"
+		<< std::setw(12) << "max ns" << std::setw(14) << "mean ns" << "\n"
+		<< std::fixed << std::setprecision(0);
+	writePhaseText(out, total);
+	for (const Phase &phase : phases)
+		writePhaseText(out, phase);
+	out << "  state transitions:    last " << lastTransitions << ", max " << maxTransitions << ", total " << totalTransitions << "\n"
+		<< "  observer callbacks:   last " << lastNotifications << ", max " << maxNotifications << ", total " << totalNotifications << "\n";
+
+	out.flags(flags);
+	out.precision(precision);
+}
+
+void TickMetrics::writeJson(std::ostream &out) const
+{
+	std::ios::fmtflags flags = out.flags();
+	std::streamsize precision = out.precision();
+
+	out << std::fixed << std::setprecision(1)
+		<< "{\"schema\": 1, \"ticks\": " << ticks << ", \"window\": " << window << ", \"total\": ";
+	writePhaseJson(out, total);
+	out << ", \"phases\": [";
+	for (std::size_t p = 0; p < sizeof(phases) / sizeof(phases[0]); p++)
+	{
+		if (p > 0)
+			out << ", ";
+		writePhaseJson(out, phases[p]);
+	}
+	out << "], \"transitions\": {\"last\": " << lastTransitions << ", \"max\": " << maxTransitions << ", \"total\": " << totalTransitions << "}"
+		<< ", \"notifications\": {\"last\": " << lastNotifications << ", \"max\": " << maxNotifications << ", \"total\": " << totalNotifications << "}}\n";
+
+	out.flags(flags);
+	out.precision(precision);
+}
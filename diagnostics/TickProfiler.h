@@ -0,0 +1,195 @@
+#ifndef PHOTOSYNTECH_TICKPROFILER_H
+#define PHOTOSYNTECH_TICKPROFILER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+
+/**
+ * @brief Per-phase latency and event statistics for Inventory ticks.
+ *
+ * Returned by value from Inventory::getMetrics(), so it can be read from the
+ * UI thread while the ticker keeps running.
+ */
+struct TickMetrics
+{
+	/**
+	 * @brief Latency distribution of one phase over the recent tick window.
+	 *
+	 * Each sample is the time one tick spent in the phase, in nanoseconds.
+	 */
+	struct Phase
+	{
+		const char *name;
+		uint64_t p50Ns;
+		uint64_t p99Ns;
+		uint64_t maxNs; ///< Worst tick since the last reset, not just the window
+		double meanNs;
+	};
+
+	uint64_t ticks;		 ///< Ticks recorded since the last reset
+	std::size_t window;	 ///< Ticks the percentiles are computed over
+	Phase total;		 ///< Whole tickOnce() duration
+	Phase phases[4];	 ///< Indexed by TickProfiler::Phase
+
+	uint64_t lastTransitions;	   ///< Maturity state changes in the latest tick
+	uint64_t lastNotifications;	   ///< Observer callbacks in the latest tick
+	uint64_t maxTransitions;	   ///< Most state changes in one tick
+	uint64_t maxNotifications;	   ///< Most observer callbacks in one tick
+	uint64_t totalTransitions;
+	uint64_t totalNotifications;
+
+	/**
+	 * @brief Writes a human-readable table.
+	 */
+	void writeText(std::ostream &out) const;
+
+	/**
+	 * @brief Writes the metrics as a single JSON object (schema version 1).
+	 */
+	void writeJson(std::ostream &out) const;
+};
+
+/**
+ * @brief Low-overhead profiler splitting each Inventory tick into phases.
+ *
+ * Inventory::tickOnce() opens a tick frame on the ticking thread; the tick
+ * code marks phases with PhaseTimer. Phase time is exclusive: entering a
+ * nested phase (e.g. observer callbacks inside update()) pauses the outer one,
+ * and nested PlantGroup subtrees pause their parent's grow loop, so the phases
+ * of one tick add up to at most its total.
+ *
+ * **Cost:**
+ * Timers sit on per-group loops, never per plant, so a tick reads the clock a
+ * few times per PlantGroup. Outside a tick frame (e.g. PlantGroup::tick()
+ * called directly) a timer is a single thread-local check. Recording a tick
+ * never allocates: samples go into a fixed window of the last WINDOW ticks.
+ *
+ * **Dumps:**
+ * setDump() makes the profiler write its metrics every N ticks as text or
+ * JSON, for long runs where nobody polls getMetrics().
+ *
+ * @see Inventory::getMetrics()
+ */
+class TickProfiler
+{
+	public:
+		/**
+		 * @brief Tick phases with their own histogram.
+		 */
+		enum class Phase
+		{
+			UPDATE,	   ///< PlantGroup::update(): resource decay per plant
+			OBSERVERS, ///< Observer callbacks (Staff) raised during the tick
+			GROW,	   ///< MaturityState::grow() for every plant
+			SEASON,	   ///< Inventory::changeSeason()
+			COUNT
+		};
+
+		/**
+		 * @brief Dump formats for setDump().
+		 */
+		enum class Format
+		{
+			TEXT,
+			JSON
+		};
+
+		/**
+		 * @brief Times one phase on the current thread while alive.
+		 *
+		 * Does nothing unless the thread is inside beginTick()/endTick().
+		 */
+		class PhaseTimer
+		{
+			public:
+				PhaseTimer(Phase phase);
+				~PhaseTimer();
+
+			private:
+				PhaseTimer(const PhaseTimer &);
+				PhaseTimer &operator=(const PhaseTimer &);
+
+				int previous;
+				bool active;
+		};
+
+		/// Number of recent ticks kept for percentiles.
+		static const std::size_t WINDOW = 1024;
+
+		TickProfiler();
+
+		/**
+		 * @brief Opens a tick frame on the calling thread.
+		 */
+		void beginTick();
+
+		/**
+		 * @brief Closes the tick frame and records its samples.
+		 *
+		 * Writes the periodic dump if one is due.
+		 */
+		void endTick();
+
+		/**
+		 * @brief Gets the statistics recorded so far.
+		 */
+		TickMetrics getMetrics() const;
+
+		/**
+		 * @brief Discards every recorded sample and count.
+		 */
+		void reset();
+
+		/**
+		 * @brief Writes the metrics to out every everyTicks ticks.
+		 * @param out Destination, not owned; nullptr disables dumping.
+		 * @param everyTicks Dump period in ticks (values below 1 disable dumping).
+		 * @param format Text table or JSON object per dump.
+		 */
+		void setDump(std::ostream *out, int everyTicks, Format format);
+
+		/**
+		 * @brief Counts a maturity state change in the current tick.
+		 */
+		static void countTransition();
+
+		/**
+		 * @brief Counts observer callbacks in the current tick.
+		 */
+		static void countNotifications(std::size_t observers);
+
+		/**
+		 * @brief Gets a phase's display name.
+		 */
+		static const char *getPhaseName(Phase phase);
+
+	private:
+		TickProfiler(const TickProfiler &);
+		TickProfiler &operator=(const TickProfiler &);
+
+		static TickMetrics::Phase summarise(const char *name, const uint64_t *samples, std::size_t count, uint64_t max);
+
+		mutable std::mutex lock;
+		uint64_t totals[WINDOW];
+		uint64_t samples[static_cast<int>(Phase::COUNT)][WINDOW];
+		uint64_t maxTotal;
+		uint64_t maxPhase[static_cast<int>(Phase::COUNT)];
+		uint64_t sumTotal;
+		uint64_t sumPhase[static_cast<int>(Phase::COUNT)];
+		uint64_t ticks;
+
+		uint64_t lastTransitions;
+		uint64_t lastNotifications;
+		uint64_t maxTransitions;
+		uint64_t maxNotifications;
+		uint64_t totalTransitions;
+		uint64_t totalNotifications;
+
+		std::ostream *dumpOut;
+		int dumpEvery;
+		Format dumpFormat;
+};
+
+#endif //PHOTOSYNTECH_TICKPROFILER_H
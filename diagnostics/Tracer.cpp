@@ -0,0 +1,246 @@
+#include "Tracer.h"
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <mutex>
+#include <vector>
+
+namespace
+{
+	struct Event
+	{
+		const char *name;
+		const char *category;
+		uint64_t startNs;
+		uint64_t durationNs;
+		uint32_t thread;
+	};
+
+	/**
+	 * @brief One thread's ring. Only the owning thread writes events; written is
+	 * published with release so a reader sees complete entries up to it.
+	 * clear() never touches written: it moves cleared up to it instead, and
+	 * readers skip events below cleared.
+	 */
+	struct Ring
+	{
+		Event events[Tracer::BUFFER_EVENTS];
+		std::atomic<uint64_t> written;
+		uint64_t cleared;
+		bool inUse;
+	};
+
+	/**
+	 * @brief First event index a reader should show; the registry lock is held.
+	 */
+	uint64_t firstKept(const Ring *ring, uint64_t written)
+	{
+		uint64_t begin = written > Tracer::BUFFER_EVENTS ? written - Tracer::BUFFER_EVENTS : 0;
+		return ring->cleared > begin ? ring->cleared : begin;
+	}
+
+	struct ThreadName
+	{
+		uint32_t thread;
+		const char *name;
+	};
+
+	/**
+	 * @brief Rings and thread names; only touched when a thread starts or ends
+	 * tracing, or when the trace is written.
+	 */
+	struct Registry
+	{
+		std::mutex lock;
+		std::vector<Ring *> rings;
+		std::vector<ThreadName> names;
+		std::atomic<uint32_t> nextThread;
+
+		Registry() : nextThread(1) {}
+
+		~Registry()
+		{
+			for (Ring *ring : rings)
+				delete ring;
+		}
+	};
+
+	Registry &registry()
+	{
+		static Registry instance;
+		return instance;
+	}
+
+	/**
+	 * @brief The calling thread's ring, claimed on first use and returned to the
+	 * registry when the thread exits.
+	 */
+	struct ThreadState
+	{
+		Ring *ring;
+		uint32_t thread;
+
+		ThreadState() : ring(nullptr), thread(0) {}
+
+		~ThreadState()
+		{
+			if (!ring)
+				return;
+			std::lock_guard<std::mutex> guard(registry().lock);
+			ring->inUse = false;
+		}
+
+		Ring *claim()
+		{
+			if (ring)
+				return ring;
+
+			Registry &shared = registry();
+			std::lock_guard<std::mutex> guard(shared.lock);
+			if (thread == 0)
+				thread = shared.nextThread++;
+			for (Ring *idle : shared.rings)
+			{
+				if (!idle->inUse)
+				{
+					ring = idle;
+					break;
+				}
+			}
+			if (!ring)
+			{
+				ring = new Ring();
+				ring->written.store(0);
+				ring->cleared = 0;
+				shared.rings.push_back(ring);
+			}
+			ring->inUse = true;
+			return ring;
+		}
+	};
+
+	thread_local ThreadState state;
+
+	const std::chrono::steady_clock::time_point epoch = std::chrono::steady_clock::now();
+
+	void writeEvent(std::ostream &out, const Event &event)
+	{
+		out << "{\"name\": \"" << event.name << "\", \"cat\": \"" << event.category
+			<< "\", \"ph\": \"X\", \"pid\": 1, \"tid\": " << event.thread
+			<< ", \"ts\": " << event.startNs / 1000.0
+			<< ", \"dur\": " << event.durationNs / 1000.0 << "}";
+	}
+}
+
+const std::size_t Tracer::BUFFER_EVENTS;
+
+Tracer::Scope::Scope(const char *name, const char *category)
+	: name(name), category(category), start(Tracer::now())
+{
+}
+
+Tracer::Scope::~Scope()
+{
+	Tracer::record(name, category, start, Tracer::now() - start);
+}
+
+void Tracer::setThreadName(const char *name)
+{
+	state.claim();
+	std::lock_guard<std::mutex> guard(registry().lock);
+	for (ThreadName &entry : registry().names)
+	{
+		if (entry.thread == state.thread)
+		{
+			entry.name = name;
+			return;
+		}
+	}
+	ThreadName entry;
+	entry.thread = state.thread;
+	entry.name = name;
+	registry().names.push_back(entry);
+}
+
+void Tracer::record(const char *name, const char *category, uint64_t startNs, uint64_t durationNs)
+{
+	Ring *ring = state.claim();
+	uint64_t index = ring->written.load(std::memory_order_relaxed);
+	Event &event = ring->events[index % BUFFER_EVENTS];
+	event.name = name;
+	event.category = category;
+	event.startNs = startNs;
+	event.durationNs = durationNs;
+	event.thread = state.thread;
+	ring->written.store(index + 1, std::memory_order_release);
+}
+
+uint64_t Tracer::now()
+{
+	return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - epoch).count();
+}
+
+void Tracer::write(std::ostream &out)
+{
+	Registry &shared = registry();
+	std::lock_guard<std::mutex> guard(shared.lock);
+
+	std::ios::fmtflags flags = out.flags();
+	std::streamsize precision = out.precision();
+	out << std::fixed << std::setprecision(3) << "{\"displayTimeUnit\": \"ns\", \"traceEvents\": [";
+
+	bool first = true;
+	for (const ThreadName &entry : shared.names)
+	{
+		out << (first ? "\n" : ",\n")
+			<< "{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": " << entry.thread
+			<< ", \"args\": {\"name\": \"" << entry.name << "\"}}";
+		first = false;
+	}
+
+	for (const Ring *ring : shared.rings)
+	{
+		uint64_t written = ring->written.load(std::memory_order_acquire);
+		for (uint64_t i = firstKept(ring, written); i < written; i++)
+		{
+			out << (first ? "\n" : ",\n");
+			writeEvent(out, ring->events[i % BUFFER_EVENTS]);
+			first = false;
+		}
+	}
+	out << "\n]}\n";
+
+	out.flags(flags);
+	out.precision(precision);
+}
+
+bool Tracer::writeFile(const char *path)
+{
+	std::ofstream out(path, std::ios::trunc);
+	if (!out)
+		return false;
+	write(out);
+	return (bool)out;
+}
+
+std::size_t Tracer::getEventCount()
+{
+	Registry &shared = registry();
+	std::lock_guard<std::mutex> guard(shared.lock);
+	std::size_t count = 0;
+	for (const Ring *ring : shared.rings)
+	{
+		uint64_t written = ring->written.load(std::memory_order_acquire);
+		count += (std::size_t)(written - firstKept(ring, written));
+	}
+	return count;
+}
+
+void Tracer::clear()
+{
+	Registry &shared = registry();
+	std::lock_guard<std::mutex> guard(shared.lock);
+	for (Ring *ring : shared.rings)
+		ring->cleared = ring->written.load(std::memory_order_acquire);
+}
@@ -0,0 +1,113 @@
+#ifndef PHOTOSYNTECH_TRACER_H
+#define PHOTOSYNTECH_TRACER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+
+/**
+ * @brief Event tracer writing Chrome trace JSON (chrome://tracing, Perfetto).
+ *
+ * Shows where the ticker, the UI thread and traversal workers spend their
+ * time. Each traced scope becomes one complete ("X") event with its start and
+ * duration, which the viewers draw exactly like a begin/end pair.
+ *
+ * **Compile-time switch:**
+ * Call sites use the TRACE_SCOPE and TRACE_THREAD_NAME macros, which compile
+ * to nothing unless PHOTOSYNTECH_TRACING is defined (`make TRACING=1`). A
+ * normal build pays nothing; the Tracer class itself is always linked so
+ * tools and tests can use it directly.
+ *
+ * **Buffers:**
+ * Every thread records into its own fixed ring of BUFFER_EVENTS events, so
+ * recording takes no lock and never allocates after the thread's first event.
+ * When a ring is full the oldest events are overwritten. Rings are recycled
+ * when threads exit, so short-lived worker threads do not grow memory.
+ *
+ * Event names and categories are stored as pointers and must be string
+ * literals. Write the trace while traced threads are quiet; events recorded
+ * during the write may be torn or missing.
+ *
+ * Traced: ticks, per-group tick subtrees, builder construction, plant and
+ * group clones, purchases, observer callbacks and traversal workers.
+ */
+class Tracer
+{
+	public:
+		/// Events kept per thread before the oldest are overwritten.
+		static const std::size_t BUFFER_EVENTS = 16384;
+
+		/**
+		 * @brief Records one event covering its lifetime.
+		 */
+		class Scope
+		{
+			public:
+				Scope(const char *name, const char *category);
+				~Scope();
+
+			private:
+				Scope(const Scope &);
+				Scope &operator=(const Scope &);
+
+				const char *name;
+				const char *category;
+				uint64_t start;
+		};
+
+		/**
+		 * @brief Names the calling thread in the trace (a string literal).
+		 */
+		static void setThreadName(const char *name);
+
+		/**
+		 * @brief Records a finished event on the calling thread.
+		 * @param startNs Start time from now().
+		 * @param durationNs Duration in nanoseconds.
+		 */
+		static void record(const char *name, const char *category, uint64_t startNs, uint64_t durationNs);
+
+		/**
+		 * @brief Gets the trace clock, in nanoseconds since the program started.
+		 */
+		static uint64_t now();
+
+		/**
+		 * @brief Writes every buffered event as a Chrome trace JSON object.
+		 */
+		static void write(std::ostream &out);
+
+		/**
+		 * @brief Writes the trace to a file.
+		 * @return False if the file could not be written.
+		 */
+		static bool writeFile(const char *path);
+
+		/**
+		 * @brief Gets the number of buffered events across all threads.
+		 */
+		static std::size_t getEventCount();
+
+		/**
+		 * @brief Discards every buffered event; thread names are kept.
+		 *
+		 * Safe while threads are recording: an event recorded during the
+		 * call may or may not be discarded.
+		 */
+		static void clear();
+};
+
+#define PHOTOSYNTECH_TRACE_JOIN2(a, b) a##b
+#define PHOTOSYNTECH_TRACE_JOIN(a, b) PHOTOSYNTECH_TRACE_JOIN2(a, b)
+
+#ifdef PHOTOSYNTECH_TRACING
+/// Traces the rest of the enclosing block as one event.
+#define TRACE_SCOPE(name, category) Tracer::Scope PHOTOSYNTECH_TRACE_JOIN(traceScope, __LINE__)(name, category)
+/// Names the calling thread in the trace.
+#define TRACE_THREAD_NAME(name) Tracer::setThreadName(name)
+#else
+#define TRACE_SCOPE(name, category) ((void)0)
+#define TRACE_THREAD_NAME(name) ((void)0)
+#endif
+
+#endif //PHOTOSYNTECH_TRACER_H
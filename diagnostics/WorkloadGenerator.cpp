@@ -0,0 +1,277 @@
+#include "WorkloadGenerator.h"
+#include "../builder/Director.h"
+#include "../builder/SunflowerBuilder.h"
+#include "../builder/RoseBuilder.h"
+#include "../builder/JadePlantBuilder.h"
+#include "../builder/MapleBuilder.h"
+#include "../builder/CactusBuilder.h"
+#include "../builder/CherryBlossomBuilder.h"
+#include "../builder/LavenderBuilder.h"
+#include "../builder/PineBuilder.h"
+#include "../composite/PlantGroup.h"
+#include "../decorator/customerDecorator/PlantDecorationHeader.h"
+#include "../mediator/Customer.h"
+#include "../mediator/SalesFloor.h"
+#include "../mediator/Staff.h"
+#include "../singleton/Singleton.h"
+#include "../singleton/SimulationRandom.h"
+#include <algorithm>
+#include <iterator>
+#include <string>
+
+namespace
+{
+	template <typename ConcreteBuilder>
+	PlantComponent *construct()
+	{
+		ConcreteBuilder builder;
+		Director director(&builder);
+		director.construct();
+		return director.getPlant();
+	}
+
+	/**
+	 * @brief The customer decorator added as a template's n-th extra decorator.
+	 */
+	PlantComponent *extraDecorator(int n)
+	{
+		switch (n % 4)
+		{
+		case 0:
+			return new LargePot();
+		case 1:
+			return new PlantCharm();
+		case 2:
+			return new RedPot();
+		default:
+			return new ShopThemedCharm();
+		}
+	}
+}
+
+const int WorkloadConfig::PLANT_TYPES;
+
+WorkloadConfig::WorkloadConfig()
+	: plants(1000), groupDepth(1), groupFanout(4),
+	  minExtraDecorators(0), maxExtraDecorators(0),
+	  staff(4), observedGroupRatio(1.0),
+	  customers(0), purchaseRate(0.0),
+	  seed(1)
+{
+	for (int t = 0; t < PLANT_TYPES; t++)
+		typeWeights[t] = 1;
+}
+
+WorkloadGenerator::WorkloadGenerator(const WorkloadConfig &config)
+	: config(config), random(config.seed), top(nullptr), salesFloor(new SalesFloor())
+{
+	bool anyType = false;
+	for (int t = 0; t < WorkloadConfig::PLANT_TYPES; t++)
+		anyType = anyType || config.typeWeights[t] > 0;
+	if (!anyType)
+	{
+		delete salesFloor;
+		throw "WorkloadConfig needs at least one plant type with a positive weight";
+	}
+
+	this->config.groupDepth = std::max(0, config.groupDepth);
+	this->config.groupFanout = std::max(1, config.groupFanout);
+	this->config.minExtraDecorators = std::max(0, config.minExtraDecorators);
+	this->config.maxExtraDecorators = std::max(this->config.minExtraDecorators, config.maxExtraDecorators);
+
+	stats.plants = stats.groups = stats.leafGroups = stats.observedGroups = 0;
+	for (int t = 0; t < WorkloadConfig::PLANT_TYPES; t++)
+		stats.plantsPerType[t] = 0;
+	stats.ticks = stats.purchases = 0;
+}
+
+WorkloadGenerator::~WorkloadGenerator()
+{
+	delete salesFloor;
+}
+
+const char *WorkloadGenerator::getTypeName(int type)
+{
+	static const char *const names[WorkloadConfig::PLANT_TYPES] = {
+		"Sunflower", "Rose", "Jade", "Maple Tree", "Cactus", "Cherry Blossom", "Lavender", "Pine Tree"};
+	return type >= 0 && type < WorkloadConfig::PLANT_TYPES ? names[type] : "Unknown";
+}
+
+PlantComponent *WorkloadGenerator::buildTemplate(int type, int extraDecorators)
+{
+	PlantComponent *plant = nullptr;
+	switch (type)
+	{
+	case 0:
+		plant = construct<SunflowerBuilder>();
+		break;
+	case 1:
+		plant = construct<RoseBuilder>();
+		break;
+	case 2:
+		plant = construct<JadePlantBuilder>();
+		break;
+	case 3:
+		plant = construct<MapleBuilder>();
+		break;
+	case 4:
+		plant = construct<CactusBuilder>();
+		break;
+	case 5:
+		plant = construct<CherryBlossomBuilder>();
+		break;
+	case 6:
+		plant = construct<LavenderBuilder>();
+		break;
+	default:
+		plant = construct<PineBuilder>();
+		break;
+	}
+
+	for (int d = 0; d < extraDecorators; d++)
+		plant->addAttribute(extraDecorator(d));
+	return plant;
+}
+
+void WorkloadGenerator::buildGroups(PlantGroup *parent, int depth)
+{
+	if (depth == config.groupDepth)
+	{
+		leaves.push_back(parent);
+		leafSizes.push_back(0);
+		return;
+	}
+
+	for (int c = 0; c < config.groupFanout; c++)
+	{
+		PlantGroup *child = new PlantGroup();
+		parent->addComponent(child);
+		stats.groups++;
+		buildGroups(child, depth + 1);
+	}
+}
+
+PlantGroup *WorkloadGenerator::build()
+{
+	if (top)
+		throw "WorkloadGenerator::build() may only be called once";
+
+	Inventory *inv = Inventory::getInstance();
+	SimulationRandom::seed(config.seed);
+
+	top = new PlantGroup();
+	top->setGroupName("Workload");
+	stats.groups = 1;
+	buildGroups(top, 0);
+	stats.leafGroups = (int)leaves.size();
+
+	// One template per type and decorator count; every plant is a clone of one
+	int variants = config.maxExtraDecorators - config.minExtraDecorators + 1;
+	std::vector<PlantComponent *> templates(WorkloadConfig::PLANT_TYPES * variants, nullptr);
+	std::discrete_distribution<int> pickType(config.typeWeights, config.typeWeights + WorkloadConfig::PLANT_TYPES);
+	std::uniform_int_distribution<int> pickVariant(0, variants - 1);
+
+	for (int p = 0; p < config.plants; p++)
+	{
+		int type = pickType(random);
+		int variant = pickVariant(random);
+		PlantComponent *&plantTemplate = templates[type * variants + variant];
+		if (!plantTemplate)
+			plantTemplate = buildTemplate(type, config.minExtraDecorators + variant);
+
+		std::size_t leaf = (std::size_t)p % leaves.size();
+		leaves[leaf]->addComponent(plantTemplate->getDecorator()->clone());
+		leafSizes[leaf]++;
+		stats.plantsPerType[type]++;
+	}
+	stats.plants = config.plants;
+
+	for (PlantComponent *plantTemplate : templates)
+		delete plantTemplate;
+
+	std::vector<Staff *> staff;
+	for (int s = 0; s < config.staff; s++)
+	{
+		staff.push_back(new Staff("Workload staff " + std::to_string(s)));
+		inv->addStaff(staff.back());
+	}
+
+	if (!staff.empty())
+	{
+		std::vector<std::size_t> order(leaves.size());
+		for (std::size_t l = 0; l < order.size(); l++)
+			order[l] = l;
+		std::shuffle(order.begin(), order.end(), random);
+
+		std::size_t observed = (std::size_t)(config.observedGroupRatio * leaves.size() + 0.5);
+		observed = std::min(observed, leaves.size());
+		for (std::size_t o = 0; o < observed; o++)
+			leaves[order[o]]->attach(staff[o % staff.size()]);
+		stats.observedGroups = (int)observed;
+	}
+
+	for (int c = 0; c < config.customers; c++)
+	{
+		Customer *customer = new Customer("Workload customer " + std::to_string(c));
+		customer->setSalesFloor(salesFloor);
+		inv->addCustomer(customer);
+		customers.push_back(customer);
+	}
+
+	inv->getInventory()->addComponent(top);
+	return top;
+}
+
+bool WorkloadGenerator::sell(Customer *customer)
+{
+	if (stats.plants == 0 || !customer)
+		return false;
+
+	// Pick a plant uniformly: a random position, then the leaf that holds it
+	int position = std::uniform_int_distribution<int>(0, stats.plants - 1)(random);
+	std::size_t leaf = 0;
+	while (position >= leafSizes[leaf])
+	{
+		position -= leafSizes[leaf];
+		leaf++;
+	}
+
+	std::list<PlantComponent *> *plants = leaves[leaf]->getPlants();
+	std::list<PlantComponent *>::iterator it = plants->begin();
+	std::advance(it, position);
+	PlantComponent *plant = *it;
+
+	leaves[leaf]->removeComponent(plant);
+	leafSizes[leaf]--;
+	stats.plants--;
+
+	customer->addPlant(plant);
+	customer->purchasePlants();
+	stats.purchases++;
+	return true;
+}
+
+void WorkloadGenerator::run(int ticks)
+{
+	if (!top)
+		build();
+
+	Inventory *inv = Inventory::getInstance();
+	std::bernoulli_distribution buys(std::max(0.0, std::min(1.0, config.purchaseRate)));
+	for (int t = 0; t < ticks; t++)
+	{
+		inv->tickOnce();
+		stats.ticks++;
+
+		for (Customer *customer : customers)
+		{
+			if (buys(random))
+				sell(customer);
+		}
+	}
+}
+
+WorkloadStats WorkloadGenerator::getStats() const
+{
+	return stats;
+}
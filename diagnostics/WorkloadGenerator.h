@@ -0,0 +1,139 @@
+#ifndef PHOTOSYNTECH_WORKLOADGENERATOR_H
+#define PHOTOSYNTECH_WORKLOADGENERATOR_H
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+class PlantComponent;
+class PlantGroup;
+class Customer;
+class SalesFloor;
+
+/**
+ * @brief Shape and activity of a generated nursery.
+ *
+ * The defaults describe a small, evenly mixed nursery with no sales.
+ */
+struct WorkloadConfig
+{
+	/// Number of plant types, in WorkloadGenerator::getTypeName() order.
+	static const int PLANT_TYPES = 8;
+
+	int plants;
+	int groupDepth;	 ///< Levels of PlantGroup nesting below the workload's top group (0 = flat)
+	int groupFanout; ///< Child groups per group above the leaves
+	int typeWeights[PLANT_TYPES]; ///< Relative share of each builder; all zero is invalid
+
+	int minExtraDecorators; ///< Customer decorators (pots, charms) added on top of the builder's own
+	int maxExtraDecorators;
+
+	int staff;
+	double observedGroupRatio; ///< Fraction of leaf groups with a staff observer attached
+
+	int customers;
+	double purchaseRate; ///< Chance per customer per tick of buying one plant
+
+	uint32_t seed; ///< Seeds the generator and SimulationRandom
+
+	WorkloadConfig();
+};
+
+/**
+ * @brief Counts describing a generated nursery and the activity driven on it.
+ */
+struct WorkloadStats
+{
+	int plants;	   ///< Plants currently in the workload's groups
+	int groups;	   ///< Including the top group
+	int leafGroups;
+	int observedGroups;
+	int plantsPerType[WorkloadConfig::PLANT_TYPES]; ///< As built, before sales
+	long ticks;
+	long purchases;
+};
+
+/**
+ * @brief Builds large synthetic nurseries and drives them through ticks and sales.
+ *
+ * build() adds one top PlantGroup to the Inventory's root holding a balanced
+ * tree of groupDepth levels, with plants spread round-robin over the leaves.
+ * Each plant type is built once per decorator count through its builder and
+ * Director; every other plant is a clone of that template, so a million-plant
+ * nursery builds in seconds while still matching builder output exactly.
+ * Staff and customers are registered with the Inventory, which owns them.
+ *
+ * run() advances the Inventory with tickOnce() and, after each tick, lets
+ * every customer buy a random plant with probability purchaseRate through the
+ * normal Customer -> SalesFloor -> Staff path. The ticker must be stopped.
+ *
+ * Every choice comes from a generator seeded with config.seed, so equal
+ * configs produce equal nurseries and equal sales.
+ *
+ * **System Role:**
+ * Load-testing backbone for stress tests, benchmarks and memory reports.
+ *
+ * @see WorkloadConfig
+ */
+class WorkloadGenerator
+{
+	public:
+		/**
+		 * @throws const char* if the config has no plant type with a positive weight.
+		 */
+		WorkloadGenerator(const WorkloadConfig &config);
+
+		/**
+		 * @brief Deletes the generator's sales floor; the Inventory owns everything else.
+		 *
+		 * Generated customers still point at the sales floor, so do not make
+		 * purchases through them once the generator is gone.
+		 */
+		~WorkloadGenerator();
+
+		/**
+		 * @brief Builds the nursery into the Inventory.
+		 * @return The workload's top group (owned by the Inventory).
+		 * @throws const char* if called twice.
+		 */
+		PlantGroup *build();
+
+		/**
+		 * @brief Runs ticks, each followed by a round of customer purchases.
+		 */
+		void run(int ticks);
+
+		/**
+		 * @brief Sells one random plant to a customer.
+		 * @return False if no plants are left.
+		 */
+		bool sell(Customer *customer);
+
+		/**
+		 * @brief Gets the workload's current counts.
+		 */
+		WorkloadStats getStats() const;
+
+		/**
+		 * @brief Gets the builder name for a type index ("Rose", "Cactus"...).
+		 */
+		static const char *getTypeName(int type);
+
+	private:
+		WorkloadGenerator(const WorkloadGenerator &);
+		WorkloadGenerator &operator=(const WorkloadGenerator &);
+
+		static PlantComponent *buildTemplate(int type, int extraDecorators);
+		void buildGroups(PlantGroup *parent, int depth);
+
+		WorkloadConfig config;
+		std::mt19937 random;
+		PlantGroup *top;
+		std::vector<PlantGroup *> leaves;
+		std::vector<int> leafSizes;
+		std::vector<Customer *> customers;
+		SalesFloor *salesFloor;
+		WorkloadStats stats;
+};
+
+#endif //PHOTOSYNTECH_WORKLOADGENERATOR_H
@@ -0,0 +1,59 @@
+#ifndef PHOTOSYNTECH_LISTINGPAGE_H
+#define PHOTOSYNTECH_LISTINGPAGE_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "../composite/PlantComponent.h"
+
+/**
+ * @brief One window of a NurseryFacade listing.
+ *
+ * Returned by the paged facade calls (getMenuPage(), getPlantGroupPage(),
+ * getPlantGroupContentsPage() and their continue* counterparts) so that menus
+ * over very large inventories only format the rows that are actually shown.
+ *
+ * **Usage:**
+ * - items[i] is the display label for components[i]
+ * - offset is the position of items[0] within the full listing
+ * - nextCursor is an opaque token for the following page, empty when the
+ *   listing has been exhausted or the page was requested with a limit of 0
+ *
+ * A cursor holds the next offset and an id for its listing, which lets the
+ * facade resume where that listing stopped; several listings can be paged at
+ * once. Cursors stay valid across structural changes to the inventory, but a
+ * page fetched after such a change is positioned by offset only and may skip
+ * or repeat rows that moved.
+ *
+ * @see NurseryFacade (producer of listing pages)
+ */
+struct ListingPage
+{
+	/**
+	 * @brief Display labels, in listing order.
+	 */
+	std::vector<std::string> items;
+
+	/**
+	 * @brief Component behind each label.
+	 */
+	std::vector<PlantComponent *> components;
+
+	/**
+	 * @brief Index of the first item within the whole listing.
+	 */
+	std::size_t offset = 0;
+
+	/**
+	 * @brief Token for the next page, or empty if there are no more items.
+	 */
+	std::string nextCursor;
+
+	/**
+	 * @brief Checks whether another page follows this one.
+	 * @return True if nextCursor can be passed to a continue* call.
+	 */
+	bool hasMore() const { return !nextCursor.empty(); }
+};
+
+#endif // PHOTOSYNTECH_LISTINGPAGE_H
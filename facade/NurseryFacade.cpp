@@ -1,4 +1,30 @@
 #include "NurseryFacade.h"
+#include "../memento/InventorySnapshot.h"
+#include "../diagnostics/AllocationTracker.h"
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+namespace
+{
+    // Listing cursors are "<listing id>:<next offset>"; opaque to callers.
+    std::string makeListingCursor(unsigned long listing, size_t offset)
+    {
+        return std::to_string(listing) + ":" + std::to_string(offset);
+    }
+
+    bool parseListingCursor(const std::string &cursor, unsigned long &listing, size_t &offset)
+    {
+        std::istringstream in(cursor);
+        char separator;
+        if (!(in >> listing >> separator >> offset) || separator != ':' || listing == 0)
+            return false;
+        return in.peek() == std::char_traits<char>::eof();
+    }
+}
+
+const size_t NurseryFacade::RESUME_SLOTS;
 
 NurseryFacade::NurseryFacade()
 {
@@ -7,10 +33,15 @@ NurseryFacade::NurseryFacade()
     sales = new SalesFloor();
     suggestionFloor = new SuggestionFloor();
     this->carouselItr = nullptr;
+    journal = nullptr;
+    nextListing = 1;
+    recording = nullptr;
 }
 
 NurseryFacade::~NurseryFacade()
 {
+    disableJournal();
+    delete stopRecording();
     delete director;
 
     delete sales;
@@ -48,26 +79,11 @@ string NurseryFacade::getCurrentSeason()
 
 PlantComponent *NurseryFacade::createPlant(const std::string &type)
 {
-    Builder *selectedBuilder = nullptr;
-
-    if (type == "Sunflower")
-        selectedBuilder = new SunflowerBuilder();
-    else if (type == "Rose")
-        selectedBuilder = new RoseBuilder;
-    else if (type == "Jade")
-        selectedBuilder = new JadePlantBuilder;
-    else if (type == "Maple Tree")
-        selectedBuilder = new MapleBuilder;
-    else if (type == "Cactus")
-        selectedBuilder = new CactusBuilder;
-    else if (type == "Cherry Blossom")
-        selectedBuilder = new CherryBlossomBuilder;
-    else if (type == "Lavender")
-        selectedBuilder = new LavenderBuilder;
-    else if (type == "Pine Tree")
-        selectedBuilder = new PineBuilder;
-    else
+    AllocationTracker::TagScope tag(AllocationTracker::Tag::FACADE);
+    const Species *species = SpeciesCatalog::find(type);
+    if (species == nullptr)
         return nullptr;
+    Builder *selectedBuilder = species->createBuilder();
     if (director)
         delete director;
     Builder *builder = selectedBuilder;
@@ -80,20 +96,51 @@ PlantComponent *NurseryFacade::createPlant(const std::string &type)
     plants.push_back(plant);
 
     Inventory::getInstance()->getInventory()->addComponent(plant);
+    if (journal)
+        journal->recordAttach(plant, Inventory::getInstance()->getInventory());
     delete selectedBuilder;
     return plant;
 }
 
+std::vector<PlantComponent *> NurseryFacade::createPlants(const std::string &type, size_t count, unsigned threadCount)
+{
+    AllocationTracker::TagScope tag(AllocationTracker::Tag::FACADE);
+    const Species *species = SpeciesCatalog::find(type);
+    if (species == nullptr)
+        return std::vector<PlantComponent *>();
+
+    std::vector<PlantComponent *> built = ParallelBuild(threadCount).build(*species, count);
+
+    // Only building is parallel; the inventory and journal are updated here, in order
+    PlantGroup *root = Inventory::getInstance()->getInventory();
+    for (PlantComponent *plant : built)
+    {
+        plants.push_back(plant);
+        root->addComponent(plant);
+        if (journal)
+            journal->recordAttach(plant, root);
+    }
+    return built;
+}
+
 void NurseryFacade::waterPlant(PlantComponent *plant)
 {
     if (plant)
+    {
         plant->water();
+        if (recording)
+            recording->recordWater(plant);
+    }
 }
 
 void NurseryFacade::addSunlight(PlantComponent *plant)
 {
     if (plant)
+    {
         plant->setOutside();
+        if (recording)
+            recording->recordSunlight(plant);
+    }
 }
 
 std::string NurseryFacade::getPlantInfo(PlantComponent *plant)
@@ -110,34 +157,14 @@ PlantComponent *NurseryFacade::getPlantFromBasket(Customer *customer, int index)
             return nullptr;
         }
 
-        AggPlant *agg = new AggPlant(customer->getBasket()->getPlants());
-        Iterator *itr = agg->createIterator();
-        int count = 0;
-
-        while (!itr->isDone() && count != index)
-        {
-            itr->next();
-            count++;
-        }
-
-        PlantComponent *curr = nullptr;
-        if (!itr->isDone())
-        {
-            curr = itr->currentItem();
-        }
-
-        delete agg;
-        delete itr;
-        return curr;
+        return PlantRange(customer->getBasket()->getPlants()).at(index);
     }
     return nullptr;
 }
 
-std::vector<std::string> NurseryFacade::getAvailablePlantTypes()
+const std::vector<std::string> &NurseryFacade::getAvailablePlantTypes()
 {
-    return {
-        "Sunflower", "Rose", "Jade", "Maple Tree",
-        "Cactus", "Cherry Blossom", "Lavender", "Pine Tree"};
+    return SpeciesCatalog::getNames();
 }
 std::vector<std::string> NurseryFacade::getAvailableSeasons()
 {
@@ -181,6 +208,8 @@ void NurseryFacade::addComponentToGroup(PlantComponent *parent, PlantComponent *
     if (group)
     {
         group->addComponent(child);
+        if (journal)
+            journal->recordAttach(child, group);
     }
 }
 
@@ -189,9 +218,9 @@ void NurseryFacade::removeComponentFromInventory(PlantComponent *component)
     PlantComponent *root = Inventory::getInstance()->getInventory();
     PlantGroup *rootGroup = dynamic_cast<PlantGroup *>(root);
 
-    if (rootGroup)
+    if (rootGroup && rootGroup->removeComponent(component) && journal)
     {
-        rootGroup->removeComponent(component);
+        journal->recordDetach(component);
     }
 }
 
@@ -224,6 +253,8 @@ Customer *NurseryFacade::addCustomer(string name)
     Inventory::getInstance()->addCustomer(nCust);
     nCust->setSalesFloor(sales);
     nCust->setSuggestionFloor(suggestionFloor);
+    if (journal)
+        journal->recordCustomer(nCust);
     return nCust;
 }
 
@@ -240,6 +271,8 @@ bool NurseryFacade::addToCustomerBasket(Customer *customer, PlantComponent *nPla
     {
         customer->addPlant(nPlant);
         Inventory::getInstance()->getInventory()->removeComponent(nPlant);
+        if (journal)
+            journal->recordBasketAdd(customer, nPlant);
         return true;
     }
     return false;
@@ -247,7 +280,13 @@ bool NurseryFacade::addToCustomerBasket(Customer *customer, PlantComponent *nPla
 string NurseryFacade::customerPurchase(Customer *customer)
 {
     if (customer)
-        return customer->purchasePlants();
+    {
+        bool hadBasket = customer->getBasket() != nullptr;
+        string receipt = customer->purchasePlants();
+        if (journal && hadBasket && customer->getBasket() == nullptr)
+            journal->recordSale(customer);
+        return receipt;
+    }
     return "";
 }
 
@@ -270,6 +309,8 @@ Staff *NurseryFacade::addStaff(string name)
     Inventory::getInstance()->addStaff(nStaff);
     nStaff->setSalesFloor(sales);
     nStaff->setSuggestionFloor(suggestionFloor);
+    if (journal)
+        journal->recordStaff(nStaff);
     return nStaff;
 }
 
@@ -290,16 +331,11 @@ std::vector<string> NurseryFacade::getCustomerBasketString(Customer *customer)
     if (customer && customer->getBasket() && customer->getBasket()->getPlants())
     {
 
-        AggPlant *agg = new AggPlant(customer->getBasket()->getPlants());
         std::vector<string> plantNames;
-        Iterator *itr = agg->createIterator();
-        while (!itr->isDone())
+        for (LivingPlant *plant : PlantRange(customer->getBasket()->getPlants()))
         {
-            plantNames.push_back(itr->currentItem()->getName());
-            itr->next();
+            plantNames.push_back(plant->getNameView());
         }
-        delete agg;
-        delete itr;
         return plantNames;
     }
     return {};
@@ -307,53 +343,27 @@ std::vector<string> NurseryFacade::getCustomerBasketString(Customer *customer)
 
 std::vector<string> NurseryFacade::getMenuString()
 {
-    AggPlant *agg = new AggPlant(Inventory::getInstance()->getInventory()->getPlants());
     std::vector<string> plantNames;
-    Iterator *itr = agg->createIterator();
-    while (!itr->isDone())
+    for (LivingPlant *plant : PlantRange(Inventory::getInstance()->getInventory()->getPlants()))
     {
-        plantNames.push_back(itr->currentItem()->getName());
-        itr->next();
+        plantNames.push_back(plant->getNameView());
     }
-    delete agg;
-    delete itr;
     return plantNames;
 }
 PlantComponent *NurseryFacade::findPlant(int index)
 {
-    AggPlant *agg = new AggPlant(Inventory::getInstance()->getInventory()->getPlants());
-    Iterator *itr = agg->createIterator();
-    int count = 0;
-    while (!itr->isDone() && count != index)
-    {
-
-        itr->next();
-        count++;
-    }
-    PlantComponent *curr = itr->currentItem();
-    delete agg;
-    delete itr;
-    return curr;
+    return PlantRange(Inventory::getInstance()->getInventory()->getPlants()).at(index);
 }
 
 PlantComponent *NurseryFacade::removeFromCustomer(Customer *customer, int index)
 {
     if (customer && customer->getBasket())
     {
-        AggPlant *agg = new AggPlant(customer->getBasket()->getPlants());
-        Iterator *itr = agg->createIterator();
-        int count = 0;
-        while (!itr->isDone() && count != index)
-        {
-
-            itr->next();
-            count++;
-        }
-        customer->getBasket()->getPlants()->remove(itr->currentItem());
-        PlantComponent *curr = itr->currentItem();
+        PlantComponent *curr = PlantRange(customer->getBasket()->getPlants()).at(index);
+        customer->getBasket()->getPlants()->remove(curr);
         Inventory::getInstance()->getInventory()->addComponent(curr);
-        delete agg;
-        delete itr;
+        if (journal)
+            journal->recordBasketRemove(customer, curr);
         return curr;
     }
     return nullptr;
@@ -396,7 +406,7 @@ Staff *NurseryFacade::findStaff(int index)
 std::vector<string> NurseryFacade::getAllPlantGroups()
 {
 
-    std::list<PlantComponent *> groups = *Inventory::getInstance()->getInventory()->getPlants();
+    std::list<PlantComponent *> &groups = *Inventory::getInstance()->getInventory()->getPlants();
     std::vector<string> groupNames;
     int count = 0;
     auto itr = groups.begin();
@@ -413,7 +423,7 @@ std::vector<string> NurseryFacade::getAllPlantGroups()
 std::vector<PlantComponent *> NurseryFacade::getAllPlantGroupObjects()
 {
 
-    std::list<PlantComponent *> groups = *Inventory::getInstance()->getInventory()->getPlants();
+    std::list<PlantComponent *> &groups = *Inventory::getInstance()->getInventory()->getPlants();
     std::vector<PlantComponent *> groupNames;
     int count = 0;
     auto itr = groups.begin();
@@ -428,7 +438,7 @@ std::vector<PlantComponent *> NurseryFacade::getAllPlantGroupObjects()
     return groupNames;
 }
 
-PlantGroup *NurseryFacade::findPlantGroup(int index, std::vector<PlantComponent *> groups)
+PlantGroup *NurseryFacade::findPlantGroup(int index, const std::vector<PlantComponent *> &groups)
 {
 
     if (groups.size() != 0 && index< groups.size())
@@ -451,18 +461,320 @@ vector<string> NurseryFacade::getPlantGroupContents(PlantGroup *PlantGroup)
         return {};
 
     vector<string> names;
-    AggPlant *agg = new AggPlant(PlantGroup->getPlants());
-    Iterator *itr = agg->createIterator();
+    for (LivingPlant *plant : PlantRange(PlantGroup->getPlants()))
+    {
+        names.push_back(plant->getNameView());
+    }
+    return names;
+}
+
+double NurseryFacade::getStockValuation()
+{
+    // Groups carry no price of their own, so the root's getPrice() is the sum over plants
+    ParallelTraversal traversal(Inventory::getInstance()->getInventory()->getPlants());
+    return traversal.sum([](LivingPlant *plant)
+                         { return plant->getPrice(); });
+}
 
-    while (!itr->isDone())
+std::vector<int> NurseryFacade::getHealthHistogram(int bucketCount)
+{
+    if (bucketCount <= 0)
+        return {};
+
+    ParallelTraversal traversal(Inventory::getInstance()->getInventory()->getPlants());
+    return traversal.reduce(
+        std::vector<int>(bucketCount, 0),
+        [bucketCount](std::vector<int> &buckets, LivingPlant *plant)
+        {
+            int health = std::max(0, std::min(100, plant->getHealth()));
+            buckets[std::min(bucketCount - 1, health * bucketCount / 100)]++;
+        },
+        [](std::vector<int> &total, const std::vector<int> &partial)
+        {
+            for (size_t i = 0; i < total.size(); i++)
+                total[i] += partial[i];
+        });
+}
+
+int NurseryFacade::countPlantsNeedingWater(int threshold)
+{
+    ParallelTraversal traversal(Inventory::getInstance()->getInventory()->getPlants());
+    return (int)traversal.count([threshold](LivingPlant *plant)
+                                { return plant->getWaterValue() <= threshold; });
+}
+
+bool NurseryFacade::saveSnapshot(const std::string &path)
+{
+    try
     {
-        names.push_back(itr->currentItem()->getName());
-        itr->next();
+        // The journal saves under its lock so records the ticker makes meanwhile are kept
+        if (journal)
+            journal->checkpoint(path);
+        else
+            InventorySnapshot::saveToFile(path);
+        return true;
     }
+    catch (const char *error)
+    {
+        std::cerr << "Snapshot save failed: " << error << std::endl;
+        return false;
+    }
+}
 
-    delete agg;
-    delete itr;
-    return names;
+bool NurseryFacade::loadSnapshot(const std::string &path)
+{
+    try
+    {
+        InventorySnapshot::restoreFromFile(path);
+    }
+    catch (const char *error)
+    {
+        std::cerr << "Snapshot load failed: " << error << std::endl;
+        return false;
+    }
+
+    resetAfterRestore();
+    return true;
+}
+
+void NurseryFacade::resetAfterRestore()
+{
+    // Everything the facade cached points into the replaced inventory
+    if (carouselItr)
+    {
+        delete carouselItr;
+        carouselItr = nullptr;
+    }
+    plants.clear();
+    for (ListingResume &resume : resumes)
+        resume = ListingResume();
+
+    for (Staff *staff : *Inventory::getInstance()->getStaff())
+    {
+        staff->setSalesFloor(sales);
+        staff->setSuggestionFloor(suggestionFloor);
+    }
+    for (Customer *customer : *Inventory::getInstance()->getCustomers())
+    {
+        customer->setSalesFloor(sales);
+        customer->setSuggestionFloor(suggestionFloor);
+    }
+}
+
+bool NurseryFacade::enableJournal(const std::string &path, InventoryJournal::SyncPolicy policy, size_t batchSize)
+{
+    disableJournal();
+    try
+    {
+        journal = new InventoryJournal(path, policy, batchSize);
+    }
+    catch (const char *error)
+    {
+        std::cerr << "Journal open failed: " << error << std::endl;
+        return false;
+    }
+    Inventory::getInstance()->setJournal(journal);
+    return true;
+}
+
+void NurseryFacade::disableJournal()
+{
+    if (!journal)
+        return;
+
+    if (Inventory::getInstance()->getJournal() == journal)
+        Inventory::getInstance()->setJournal(nullptr);
+    delete journal;
+    journal = nullptr;
+}
+
+bool NurseryFacade::commitJournal()
+{
+    if (!journal)
+        return true;
+
+    try
+    {
+        journal->commit();
+        return true;
+    }
+    catch (const char *error)
+    {
+        std::cerr << "Journal commit failed: " << error << std::endl;
+        return false;
+    }
+}
+
+bool NurseryFacade::recover(const std::string &snapshotPath, const std::string &journalPath)
+{
+    try
+    {
+        if (std::ifstream(snapshotPath.c_str()).good())
+            InventorySnapshot::restoreFromFile(snapshotPath);
+        InventoryJournal::replay(journalPath);
+    }
+    catch (const char *error)
+    {
+        std::cerr << "Recovery failed: " << error << std::endl;
+        return false;
+    }
+
+    resetAfterRestore();
+    return true;
+}
+
+NurseryFacade::ListingResume *NurseryFacade::findResume(unsigned long listing)
+{
+    ListingResume &resume = resumes[listing % RESUME_SLOTS];
+    return listing != 0 && resume.listing == listing ? &resume : nullptr;
+}
+
+NurseryFacade::ListingResume &NurseryFacade::claimResume(unsigned long listing)
+{
+    if (ListingResume *resume = findResume(listing))
+        return *resume;
+
+    // Ids rotate through the slots, so a new listing takes over the oldest one
+    ListingResume &resume = resumes[nextListing % RESUME_SLOTS];
+    resume = ListingResume();
+    resume.listing = nextListing++;
+    return resume;
+}
+
+ListingPage NurseryFacade::pagePlants(std::list<PlantComponent *> *source, size_t offset, size_t limit, unsigned long listing)
+{
+    ListingPage page;
+    page.offset = offset;
+    if (limit == 0)
+        return page;
+
+    PlantRange range(source);
+    PlantRange::iterator itr;
+    unsigned long version = PlantGroup::getStructureVersion();
+    ListingResume *saved = findResume(listing);
+
+    if (saved && !saved->groups && saved->source == source && saved->version == version && saved->offset == offset)
+    {
+        itr = saved->plantPosition;
+    }
+    else
+    {
+        itr = range.begin();
+        for (size_t skipped = 0; skipped < offset && itr != range.end(); skipped++)
+            ++itr;
+    }
+
+    for (; itr != range.end() && page.items.size() < limit; ++itr)
+    {
+        page.items.push_back((*itr)->getNameView());
+        page.components.push_back(*itr);
+    }
+
+    if (itr != range.end())
+    {
+        size_t next = offset + page.items.size();
+        ListingResume &resume = claimResume(listing);
+        page.nextCursor = makeListingCursor(resume.listing, next);
+        resume.source = source;
+        resume.groups = false;
+        resume.version = version;
+        resume.offset = next;
+        resume.plantPosition = itr;
+    }
+    return page;
+}
+
+ListingPage NurseryFacade::getMenuPage(size_t offset, size_t limit)
+{
+    return pagePlants(Inventory::getInstance()->getInventory()->getPlants(), offset, limit, 0);
+}
+
+ListingPage NurseryFacade::continueMenuPage(const std::string &cursor, size_t limit)
+{
+    unsigned long listing;
+    size_t offset;
+    if (!parseListingCursor(cursor, listing, offset))
+        return ListingPage();
+    return pagePlants(Inventory::getInstance()->getInventory()->getPlants(), offset, limit, listing);
+}
+
+ListingPage NurseryFacade::getPlantGroupContentsPage(PlantGroup *group, size_t offset, size_t limit)
+{
+    if (group == nullptr)
+        return ListingPage();
+    return pagePlants(group->getPlants(), offset, limit, 0);
+}
+
+ListingPage NurseryFacade::continuePlantGroupContentsPage(PlantGroup *group, const std::string &cursor, size_t limit)
+{
+    unsigned long listing;
+    size_t offset;
+    if (group == nullptr || !parseListingCursor(cursor, listing, offset))
+        return ListingPage();
+    return pagePlants(group->getPlants(), offset, limit, listing);
+}
+
+ListingPage NurseryFacade::pageGroups(size_t offset, size_t limit, unsigned long listing)
+{
+    ListingPage page;
+    page.offset = offset;
+    if (limit == 0)
+        return page;
+
+    std::list<PlantComponent *> *root = Inventory::getInstance()->getInventory()->getPlants();
+    unsigned long version = PlantGroup::getStructureVersion();
+    std::list<PlantComponent *>::iterator itr = root->begin();
+    size_t groupIndex = 0;
+    ListingResume *saved = findResume(listing);
+
+    if (saved && saved->groups && saved->source == root && saved->version == version && saved->offset == offset)
+    {
+        itr = saved->groupPosition;
+        groupIndex = saved->groupIndex;
+    }
+
+    for (; itr != root->end(); itr++)
+    {
+        if (!*itr || (*itr)->getType() != ComponentType::PLANT_GROUP)
+            continue;
+
+        if (groupIndex >= offset)
+        {
+            if (page.items.size() == limit)
+                break;
+            page.items.push_back("Plant Group " + to_string(groupIndex));
+            page.components.push_back(*itr);
+        }
+        groupIndex++;
+    }
+
+    if (itr != root->end())
+    {
+        size_t next = offset + page.items.size();
+        ListingResume &resume = claimResume(listing);
+        page.nextCursor = makeListingCursor(resume.listing, next);
+        resume.source = root;
+        resume.groups = true;
+        resume.version = version;
+        resume.offset = next;
+        resume.groupIndex = groupIndex;
+        resume.groupPosition = itr;
+    }
+    return page;
+}
+
+ListingPage NurseryFacade::getPlantGroupPage(size_t offset, size_t limit)
+{
+    return pageGroups(offset, limit, 0);
+}
+
+ListingPage NurseryFacade::continuePlantGroupPage(const std::string &cursor, size_t limit)
+{
+    unsigned long listing;
+    size_t offset;
+    if (!parseListingCursor(cursor, listing, offset))
+        return ListingPage();
+    return pageGroups(offset, limit, listing);
 }
 
 bool NurseryFacade::setAsObserver(Staff *staff, PlantGroup *PG)
@@ -563,3 +875,57 @@ LivingPlant *NurseryFacade::back()
     else
         return nullptr;
 }
+
+bool NurseryFacade::startRecording(uint32_t seed)
+{
+    if (Inventory::isTickerRunning())
+        return false;
+
+    delete stopRecording();
+    try
+    {
+        recording = new SimulationRecording(seed);
+    }
+    catch (const char *error)
+    {
+        std::cerr << "Recording failed: " << error << std::endl;
+        return false;
+    }
+    Inventory::getInstance()->setRecording(recording);
+    return true;
+}
+
+SimulationRecording *NurseryFacade::stopRecording()
+{
+    SimulationRecording *finished = recording;
+    if (finished && Inventory::getInstance()->getRecording() == finished)
+        Inventory::getInstance()->setRecording(nullptr);
+    recording = nullptr;
+    return finished;
+}
+
+void NurseryFacade::simulateTicks(int count)
+{
+    for (int i = 0; i < count; i++)
+        Inventory::getInstance()->tickOnce();
+}
+
+long NurseryFacade::replayRecording(SimulationRecording *recording, size_t maxTicks)
+{
+    if (!recording)
+        return -1;
+
+    long ticks;
+    try
+    {
+        ticks = (long)recording->replay(maxTicks);
+    }
+    catch (const char *error)
+    {
+        std::cerr << "Replay failed: " << error << std::endl;
+        return -1;
+    }
+
+    resetAfterRestore();
+    return ticks;
+}
@@ -17,6 +17,8 @@
 #include "../builder/CherryBlossomBuilder.h"
 #include "../builder/LavenderBuilder.h"
 #include "../builder/PineBuilder.h"
+#include "../builder/SpeciesCatalog.h"
+#include "../builder/ParallelBuild.h"
 #include "../composite/PlantGroup.h"
 #include "../decorator/plantDecorator/PlantAttributesHeader.h"
 #include "../decorator/plantDecorator/LargeStem.h"
@@ -41,6 +43,11 @@
 #include "../iterator/AggPlant.h"
 #include "../iterator/AggSeason.h"
 #include "../iterator/AggPlantName.h"
+#include "../iterator/PlantRange.h"
+#include "../iterator/ParallelTraversal.h"
+#include "ListingPage.h"
+#include "../memento/InventoryJournal.h"
+#include "../memento/SimulationRecording.h"
 /**
  * @brief Unified facade interface for the nursery management system.
  *
@@ -95,6 +102,50 @@ private:
     SalesFloor *sales;
     SuggestionFloor *suggestionFloor;
     Iterator *carouselItr;
+    InventoryJournal *journal;
+    SimulationRecording *recording;
+
+    /**
+     * @brief Where a paged listing's previous page stopped.
+     *
+     * Lets sequential paging resume in O(limit) instead of re-walking the
+     * first offset rows, as long as the structure version is unchanged.
+     * Each cursor names its listing's slot, so listings paged side by side
+     * keep their own positions until RESUME_SLOTS newer listings reuse it.
+     */
+    struct ListingResume
+    {
+        unsigned long listing = 0; ///< Id carried by the listing's cursors; 0 for a free slot
+        std::list<PlantComponent *> *source = nullptr;
+        bool groups = false; ///< Top-level group listing rather than a plant listing
+        unsigned long version = 0;
+        size_t offset = 0;
+        PlantRange::iterator plantPosition;
+        size_t groupIndex = 0;
+        std::list<PlantComponent *>::iterator groupPosition;
+    };
+
+    static const size_t RESUME_SLOTS = 8;
+    ListingResume resumes[RESUME_SLOTS];
+    unsigned long nextListing;
+
+    /**
+     * @brief Gets the slot a cursor's listing saved its position in, or nullptr if it was reused.
+     */
+    ListingResume *findResume(unsigned long listing);
+
+    /**
+     * @brief Gets the slot to save a listing's position in, claiming the oldest one for a new listing.
+     */
+    ListingResume &claimResume(unsigned long listing);
+
+    ListingPage pagePlants(std::list<PlantComponent *> *source, size_t offset, size_t limit, unsigned long listing);
+    ListingPage pageGroups(size_t offset, size_t limit, unsigned long listing);
+
+    /**
+     * @brief Drops cached iterators and listings and reconnects users to the floors after a restore.
+     */
+    void resetAfterRestore();
 
 public:
     NurseryFacade();
@@ -102,6 +153,13 @@ public:
 
     PlantComponent *createPlant(const std::string &type);
 
+    /**
+     * @brief Builds count plants of one species across threads and adds them to the inventory.
+     * @param threadCount Maximum number of builder threads, or 0 for the hardware core count.
+     * @return The new plants, or an empty vector if type is not a species.
+     */
+    std::vector<PlantComponent *> createPlants(const std::string &type, size_t count, unsigned threadCount = 0);
+
     string getCurrentSeason();
 
     void waterPlant(PlantComponent *plant);
@@ -110,7 +168,10 @@ public:
 
     std::string getPlantInfo(PlantComponent *plant);
 
-    std::vector<std::string> getAvailablePlantTypes();
+    /**
+     * @brief Gets the species createPlant() accepts, in catalog order.
+     */
+    const std::vector<std::string> &getAvailablePlantTypes();
     std::vector<std::string> getAvailableSeasons();
 
     PlantComponent *getInventoryRoot();
@@ -172,6 +233,18 @@ public:
 
     std::vector<string> getMenuString();
 
+    /**
+     * @brief Returns up to limit plant names from the inventory, starting at offset.
+     * @note Cost is proportional to offset + limit, or to limit when continuing with a cursor.
+     * A limit of 0 returns an empty page with no cursor.
+     */
+    ListingPage getMenuPage(size_t offset, size_t limit);
+
+    /**
+     * @brief Returns the menu page following a previous page's nextCursor.
+     */
+    ListingPage continueMenuPage(const std::string &cursor, size_t limit);
+
     PlantComponent *findPlant(int index);
 
     std::vector<string> getCustomerBasketString(Customer *customer);
@@ -185,15 +258,134 @@ public:
 
     std::vector<PlantComponent*> getAllPlantGroupObjects();
 
-    PlantGroup *findPlantGroup(int index,  std::vector<PlantComponent*>);
+    /**
+     * @brief Returns up to limit top-level plant groups ("Plant Group N"), starting at offset.
+     */
+    ListingPage getPlantGroupPage(size_t offset, size_t limit);
+
+    /**
+     * @brief Returns the plant group page following a previous page's nextCursor.
+     */
+    ListingPage continuePlantGroupPage(const std::string &cursor, size_t limit);
+
+    PlantGroup *findPlantGroup(int index, const std::vector<PlantComponent *> &groups);
     vector<string> getPlantGroupContents(PlantGroup *PlantGroup);
 
+    /**
+     * @brief Returns up to limit plant names from a group's hierarchy, starting at offset.
+     */
+    ListingPage getPlantGroupContentsPage(PlantGroup *group, size_t offset, size_t limit);
+
+    /**
+     * @brief Returns the group contents page following a previous page's nextCursor.
+     * @param group The same group the cursor was produced for.
+     */
+    ListingPage continuePlantGroupContentsPage(PlantGroup *group, const std::string &cursor, size_t limit);
+
     bool setAsObserver(Staff *staff, PlantGroup *PG);
 
     bool RemoveObserver(Staff *staff, PlantGroup *PG);
 
     vector<string> getObservers(PlantGroup *pg);
 
+    /**
+     * @brief Total value of all stock, equal to getPrice() on the inventory root.
+     * @note Summed in parallel chunks over every plant in the inventory.
+     */
+    double getStockValuation();
+
+    /**
+     * @brief Counts inventory plants per health band (0-100 split into equal buckets).
+     * @param bucketCount Number of buckets; the last bucket also holds health 100.
+     */
+    std::vector<int> getHealthHistogram(int bucketCount = 10);
+
+    /**
+     * @brief Counts inventory plants at or below a water level (staff alert threshold by default).
+     */
+    int countPlantsNeedingWater(int threshold = 50);
+
+    /**
+     * @brief Saves the whole nursery (plants, groups, staff, customers, season) to a binary file.
+     *
+     * With journalling enabled the journal saves it and checkpoints, so
+     * records the ticker makes during the save are not lost.
+     * @param path Snapshot file to create or replace.
+     * @return True on success, false if the inventory could not be written.
+     */
+    bool saveSnapshot(const std::string &path);
+
+    /**
+     * @brief Replaces the nursery with a snapshot written by saveSnapshot().
+     *
+     * Restored staff and customers are connected to this facade's sales and
+     * suggestion floors. The ticker must be stopped first.
+     * @param path Snapshot file to read.
+     * @return True on success; on failure the current nursery is left unchanged.
+     */
+    bool loadSnapshot(const std::string &path);
+
+    /**
+     * @brief Starts journalling inventory changes so they survive a crash.
+     *
+     * Every later plant creation, move, removal, basket change, sale, new user,
+     * maturity transition and season change is appended to the journal.
+     * saveSnapshot() checkpoints (empties) it.
+     * @param path Journal file; existing records are kept and appended to.
+     * @param policy When committed batches are fsync'ed.
+     * @param batchSize Records buffered before they are written.
+     * @return True if the journal was opened.
+     */
+    bool enableJournal(const std::string &path, InventoryJournal::SyncPolicy policy = InventoryJournal::SyncPolicy::BATCH, size_t batchSize = 64);
+
+    /**
+     * @brief Commits outstanding records and stops journalling.
+     */
+    void disableJournal();
+
+    /**
+     * @brief Writes buffered journal records now.
+     * @return True if there is no journal or the commit succeeded.
+     */
+    bool commitJournal();
+
+    /**
+     * @brief Rebuilds the nursery after a crash: loads the snapshot, then replays the journal.
+     *
+     * A missing snapshot file starts from the current inventory. The ticker
+     * must be stopped first, and journalling should be enabled afterwards.
+     * @return True on success.
+     */
+    bool recover(const std::string &snapshotPath, const std::string &journalPath);
+
+    /**
+     * @brief Switches to deterministic mode and starts recording the simulation.
+     *
+     * Captures the current nursery, seeds every random stream with seed, then
+     * logs ticks and water/sunlight actions until stopRecording().
+     * @return True if recording started (the ticker must be stopped).
+     */
+    bool startRecording(uint32_t seed);
+
+    /**
+     * @brief Stops recording.
+     * @return The recording (owned by the caller), or nullptr if none was active.
+     */
+    SimulationRecording *stopRecording();
+
+    /**
+     * @brief Runs ticks immediately on the calling thread instead of the timed ticker.
+     * @param count Number of ticks to run.
+     */
+    void simulateTicks(int count);
+
+    /**
+     * @brief Restores a recording's starting nursery and replays it at full speed.
+     * @param maxTicks Stop after this many ticks (for bisecting a run).
+     * @return Number of ticks replayed, or -1 on failure.
+     */
+    long replayRecording(SimulationRecording *recording, size_t maxTicks = SIZE_MAX);
+
     LivingPlant *createItr(string filter = "", bool seasonFilter= false);
     LivingPlant *next(string filter = "", bool seasonFilter= false);
     LivingPlant *back();
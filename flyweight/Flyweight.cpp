@@ -1,14 +1,65 @@
 #include "Flyweight.h"
 template <class T>
-Flyweight<T>::Flyweight(T data)
+Flyweight<T>::Flyweight(T data, uint16_t index)
 {
     this->data = data;
+    this->index = index;
+    this->references.store(0, std::memory_order_relaxed);
+    this->lastUsed = 0;
 }
 template <class T>
 T Flyweight<T>::getState()
 {
     return data;
 }
+template <class T>
+uint16_t Flyweight<T>::getIndex() const
+{
+    return index;
+}
+
+template <class T>
+const uint32_t Flyweight<T>::PERMANENT_REFERENCES;
+
+template <class T>
+const uint32_t Flyweight<T>::PINNED;
+
+template <class T>
+void Flyweight<T>::retain()
+{
+    if (references.load(std::memory_order_relaxed) & PINNED)
+        return;
+    if (references.fetch_add(1, std::memory_order_relaxed) + 1 >= PERMANENT_REFERENCES)
+        pin();
+}
+
+template <class T>
+void Flyweight<T>::release()
+{
+    // A release racing pin() may still land; the count cannot reach zero either way
+    if (references.load(std::memory_order_relaxed) & PINNED)
+        return;
+    references.fetch_sub(1, std::memory_order_relaxed);
+}
+
+template <class T>
+void Flyweight<T>::pin()
+{
+    references.fetch_or(PINNED, std::memory_order_relaxed);
+}
+
+template <class T>
+bool Flyweight<T>::isPinned() const
+{
+    return (references.load(std::memory_order_relaxed) & PINNED) != 0;
+}
+
+template <class T>
+uint32_t Flyweight<T>::getReferences() const
+{
+    return references.load(std::memory_order_relaxed) & ~PINNED;
+}
+
 template <class T>
 Flyweight<T>::~Flyweight()
 {
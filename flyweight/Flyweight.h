@@ -1,6 +1,9 @@
 #ifndef Flyweight_h
 #define Flyweight_h
 
+#include <atomic>
+#include <cstdint>
+
 /**
  * @brief Template class for sharing immutable data objects.
  *
@@ -39,15 +42,25 @@
 template <class T>
 class Flyweight
 {
+	template <class ID, class U>
+	friend class FlyweightFactory;
+
 	private:
 		T data;
+		uint16_t index;
+		// Holder count; PINNED marks a permanent flyweight
+		std::atomic<uint32_t> references;
+		static const uint32_t PINNED = 0x80000000u;
+		// Factory epoch this flyweight was last handed out in; see FlyweightFactory::reclaim()
+		std::atomic<uint32_t> lastUsed;
 
 	public:
 		/**
 		 * @brief Constructs a Flyweight with the given data.
 		 * @param data Pointer to the shared data object.
+		 * @param index Dense position in the owning factory (see FlyweightFactory::at()).
 		 */
-		Flyweight(T data);
+		Flyweight(T data, uint16_t index = 0);
 
 		/**
 		 * @brief Gets the shared state data.
@@ -55,6 +68,49 @@ class Flyweight
 		 */
 		T getState();
 
+		/**
+		 * @brief Gets this flyweight's dense index in its factory.
+		 *
+		 * Lets plants store a small integer instead of a pointer.
+		 */
+		uint16_t getIndex() const;
+
+		/**
+		 * @brief Holder count at which a flyweight becomes permanent (see pin()).
+		 */
+		static const uint32_t PERMANENT_REFERENCES = 1024;
+
+		/**
+		 * @brief Records one more long-lived holder (a plant, decorator or chain).
+		 *
+		 * Only factories that reclaim (FlyweightFactory::reclaim()) look at the
+		 * count; an entry nobody has retained may be freed by the next reclaim.
+		 * A flyweight with PERMANENT_REFERENCES holders is pinned, after which
+		 * retain() and release() are a plain load: widely shared names stop
+		 * paying for an atomic add on every clone.
+		 */
+		void retain();
+
+		/**
+		 * @brief Drops a reference taken with retain(). Never frees the flyweight itself.
+		 */
+		void release();
+
+		/**
+		 * @brief Makes this flyweight permanent: it is never reclaimed and no longer counted.
+		 */
+		void pin();
+
+		/**
+		 * @brief Whether pin() was called or the holder count reached PERMANENT_REFERENCES.
+		 */
+		bool isPinned() const;
+
+		/**
+		 * @brief Gets the number of holders that retained this flyweight (before it was pinned).
+		 */
+		uint32_t getReferences() const;
+
 		/**
 		 * @brief Destructor for cleanup.
 		 */
@@ -1,17 +1,27 @@
 #include "FlyweightFactory.h"
+template <class ID, class T>
+const std::size_t FlyweightFactory<ID, T>::CHUNK_SIZE;
+
+template <class ID, class T>
+const std::size_t FlyweightFactory<ID, T>::MAX_SIZE;
+
 template <class ID, class T>
 FlyweightFactory<ID, T>::FlyweightFactory()
 {
     cache = new unordered_map<ID, Flyweight<T> *>;
+    nextIndex = 0;
+    epoch = 0;
+    for (Flyweight<T> **&chunk : chunks)
+        chunk = nullptr;
 }
 
 template <class ID, class T>
 Flyweight<T> *FlyweightFactory<ID, T>::getFlyweight(ID id, T data)
 {
 
-    if (cache->find(id) != cache->end())
+    if (Flyweight<T> *cached = find(id))
     {
-        return (*cache)[id];
+        return cached;
     }
     else
     {
@@ -24,10 +34,117 @@ Flyweight<T> *FlyweightFactory<ID, T>::getFlyweight(ID id, T data)
         }
         else
         {
-            (*cache)[id] = new Flyweight<T>(data);
+            std::size_t index;
+            if (!freeIndices.empty())
+            {
+                index = freeIndices.back();
+                freeIndices.pop_back();
+            }
+            else
+            {
+                if (nextIndex >= MAX_SIZE)
+                {
+                    throw "Flyweight factory is full";
+                }
+                index = nextIndex++;
+            }
+            if (!chunks[index / CHUNK_SIZE])
+            {
+                chunks[index / CHUNK_SIZE] = new Flyweight<T> *[CHUNK_SIZE];
+            }
+            Flyweight<T> *fly = new Flyweight<T>(data, static_cast<uint16_t>(index));
+            fly->lastUsed.store(epoch, std::memory_order_relaxed);
+            chunks[index / CHUNK_SIZE][index % CHUNK_SIZE] = fly;
+            (*cache)[id] = fly;
+            return fly;
+        }
+    }
+}
+
+template <class ID, class T>
+Flyweight<T> *FlyweightFactory<ID, T>::find(const ID &id)
+{
+    typename unordered_map<ID, Flyweight<T> *>::iterator it = cache->find(id);
+    if (it == cache->end())
+    {
+        return nullptr;
+    }
+    // Lookups of shared strategies run on every thread; only write when the epoch has moved on
+    Flyweight<T> *fly = it->second;
+    if (fly->lastUsed.load(std::memory_order_relaxed) != epoch)
+        fly->lastUsed.store(epoch, std::memory_order_relaxed);
+    return fly;
+}
+
+template <class ID, class T>
+std::size_t FlyweightFactory<ID, T>::reclaim()
+{
+    std::size_t freed = 0;
+    auto itr = cache->begin();
+    while (itr != cache->end())
+    {
+        Flyweight<T> *fly = itr->second;
+        if (!fly->isPinned() && fly->getReferences() == 0 && fly->lastUsed.load(std::memory_order_relaxed) != epoch)
+        {
+            uint16_t index = fly->getIndex();
+            chunks[index / CHUNK_SIZE][index % CHUNK_SIZE] = nullptr;
+            freeIndices.push_back(index);
+            itr = cache->erase(itr);
+            delete fly;
+            freed++;
+        }
+        else
+        {
+            itr++;
         }
+    }
+    epoch++;
+    return freed;
+}
+
+template <class ID, class T>
+Flyweight<T> *FlyweightFactory<ID, T>::at(std::size_t index) const
+{
+    return chunks[index / CHUNK_SIZE][index % CHUNK_SIZE];
+}
+
+template <class ID, class T>
+std::size_t FlyweightFactory<ID, T>::getChunkCount() const
+{
+    return (nextIndex + CHUNK_SIZE - 1) / CHUNK_SIZE;
+}
+
+template <class ID, class T>
+std::size_t FlyweightFactory<ID, T>::getFreeIndexCount() const
+{
+    return freeIndices.size();
+}
+
+template <class ID, class T>
+uint32_t FlyweightFactory<ID, T>::getEpoch() const
+{
+    return epoch;
+}
 
-        return (*cache)[id];
+template <class ID, class T>
+std::size_t FlyweightFactory<ID, T>::getSize() const
+{
+    return cache->size();
+}
+
+template <class ID, class T>
+std::size_t FlyweightFactory<ID, T>::getBucketCount() const
+{
+    return cache->bucket_count();
+}
+
+template <class ID, class T>
+template <typename Visit>
+void FlyweightFactory<ID, T>::forEach(Visit visit) const
+{
+    for (const auto &entry : *cache)
+    {
+        visit(entry.first, entry.second);
     }
 }
 
@@ -45,4 +162,6 @@ FlyweightFactory<ID, T>::~FlyweightFactory()
     }
     cache->clear();
     delete cache;
+    for (Flyweight<T> **chunk : chunks)
+        delete[] chunk;
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 #define FlyweightFactory_h
 
 #include <unordered_map>
+#include <vector>
 #include "Flyweight.h"
 #include <iostream>
 using namespace std;
@@ -17,7 +18,19 @@ using namespace std;
  * This template factory class is the creator and manager of flyweight instances.
  * Three instances (managed by Singleton) handle caching of water strategies,
  * sun strategies, and season names. Cache lookups are O(log n), enabling efficient
- * access to shared data across thousands of plant instances.
+ * access to shared data across thousands of plant instances. Every flyweight
+ * also gets a dense 16-bit index, so plants can hold a small id and resolve
+ * it with at() instead of keeping a pointer.
+ *
+ * A factory whose entries come and go (the string pool) can call reclaim()
+ * to free entries nobody has retained or looked up for a whole epoch; their
+ * indices are handed out again by later getFlyweight() calls.
+ *
+ * Looking up existing entries (find(), getFlyweight() of a known id, at())
+ * is safe from several threads at once, which is how the strategy and state
+ * factories are used after Inventory construction. Adding or reclaiming
+ * entries needs the caller to exclude every other use, as Inventory's string
+ * pool lock does.
  *
  * **Pattern Role:** Factory (creates and manages Flyweight instances)
  *
@@ -48,7 +61,29 @@ class FlyweightFactory
 private:
 	unordered_map<ID, Flyweight<T> *> * cache;
 
+	// Flyweights by index, in fixed-size chunks so lookups never see a reallocation
+	Flyweight<T> **chunks[256];
+
+	// One past the highest index ever handed out
+	std::size_t nextIndex;
+
+	// Indices of reclaimed flyweights, reused before nextIndex grows
+	std::vector<uint16_t> freeIndices;
+
+	uint32_t epoch;
+
 public:
+	/**
+	 * @brief Number of flyweight pointers in one index chunk.
+	 */
+	static const std::size_t CHUNK_SIZE = 256;
+
+	/**
+	 * @brief Largest number of flyweights one factory holds; the last 16-bit
+	 * index is left free so callers can use it as "none".
+	 */
+	static const std::size_t MAX_SIZE = 0xFFFF;
+
 	FlyweightFactory();
 	/**
 	 * @brief Gets or creates a flyweight for the given identifier.
@@ -57,6 +92,69 @@ public:
 	 */
 	Flyweight<T> *getFlyweight(ID id, T data = NULL);
 
+	/**
+	 * @brief Gets the flyweight for an identifier without creating one.
+	 *
+	 * For lookups that should not grow the cache, such as query filters.
+	 * Like getFlyweight(), counts as a use for reclaim().
+	 *
+	 * @return The cached flyweight, or nullptr if there is none.
+	 */
+	Flyweight<T> *find(const ID &id);
+
+	/**
+	 * @brief Frees flyweights that have been idle for a whole epoch, then starts a new one.
+	 *
+	 * A flyweight is idle when it is not pinned, nothing holds a retain() on
+	 * it, and neither getFlyweight() nor find() returned it since the
+	 * previous reclaim(). The grace epoch keeps a flyweight that was just handed out alive until its
+	 * caller has had the chance to retain it. Freed indices are reused, so
+	 * only call this on factories whose long-lived holders retain what they
+	 * keep; at() returns nullptr for a freed index until it is reused.
+	 *
+	 * @return Number of flyweights freed.
+	 */
+	std::size_t reclaim();
+
+	/**
+	 * @brief Gets a flyweight by its dense index (Flyweight::getIndex()).
+	 *
+	 * O(1) and safe while another thread adds flyweights, as long as the
+	 * index itself was obtained from an existing flyweight.
+	 */
+	Flyweight<T> *at(std::size_t index) const;
+
+	/**
+	 * @brief Gets the number of cached flyweights.
+	 */
+	std::size_t getSize() const;
+
+	/**
+	 * @brief Gets the number of hash buckets the cache has allocated.
+	 */
+	std::size_t getBucketCount() const;
+
+	/**
+	 * @brief Gets the number of index chunks allocated (CHUNK_SIZE pointers each).
+	 */
+	std::size_t getChunkCount() const;
+
+	/**
+	 * @brief Gets the number of freed indices waiting to be reused.
+	 */
+	std::size_t getFreeIndexCount() const;
+
+	/**
+	 * @brief Gets the number of reclaim() calls so far.
+	 */
+	uint32_t getEpoch() const;
+
+	/**
+	 * @brief Calls visit(id, flyweight) for every cached flyweight, in no particular order.
+	 */
+	template <typename Visit>
+	void forEach(Visit visit) const;
+
 	/**
 	 * @brief Destructor that cleans up cached flyweights.
 	 */
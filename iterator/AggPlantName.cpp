@@ -3,14 +3,27 @@
 
 AggPlantName::AggPlantName(std::list<PlantComponent*>* plants, const std::string& name) : Aggregate(plants)
 {
-	// Convert string to Flyweight pointer via Singleton
-	targetName = Inventory::getInstance()->getString(name);
+	// Look the string up without interning it; an unknown one matches no plant
+	targetName = Inventory::getInstance()->findAndRetainString(name);
+	if (targetName == nullptr)
+	{
+		targetName = Inventory::getMissingString();
+		targetName->retain();
+	}
 }
 
 AggPlantName::AggPlantName(std::list<PlantComponent*>* plants, Flyweight<std::string*>* name) : Aggregate(plants)
 {
-	// Directly assign the Flyweight pointer
+	// Held for the aggregate's lifetime so a reclaim cannot free it
 	targetName = name;
+	if (targetName)
+		targetName->retain();
+}
+
+AggPlantName::~AggPlantName()
+{
+	if (targetName)
+		targetName->release();
 }
 
 Iterator* AggPlantName::createIterator()
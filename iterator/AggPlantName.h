@@ -35,7 +35,7 @@
  * - createIterator() creates bidirectional PlantNameIterator
  * - Returns iterator pre-configured for name filtering with next()/back()
  * - Used by plant search/browsing commands
- * - Converts name strings to Flyweight pointers for O(1) comparison
+ * - Looks name strings up as Flyweight pointers (never interning them) for O(1) comparison
  *
  * @see Aggregate (abstract factory)
  * @see PlantNameIterator (concrete bidirectional iterator created, has friend access)
@@ -51,10 +51,13 @@ class AggPlantName : public Aggregate
 		 */
 		Flyweight<std::string*>* targetName;
 
+		AggPlantName(const AggPlantName &);
+		AggPlantName &operator=(const AggPlantName &);
+
 	public:
 		/**
 		 * @brief Constructor that initializes the aggregate with a plant collection and target name string.
-		 * Converts the name string to a Flyweight internally.
+		 * Looks the name up without interning it; an unknown name matches no plant.
 		 * @param plants Pointer to the list of PlantComponents to manage.
 		 * @param name The target plant name string for filtering (e.g., "Rose", "Succulent", "Oak").
 		 */
@@ -74,9 +77,9 @@ class AggPlantName : public Aggregate
 		Iterator* createIterator();
 
 		/**
-		 * @brief Virtual destructor for proper cleanup.
+		 * @brief Releases the target name flyweight.
 		 */
-		virtual ~AggPlantName() {}
+		virtual ~AggPlantName();
 };
 
 #endif //PHOTOSYNTECH_AGGPLANTNAME_H
@@ -3,14 +3,27 @@
 
 AggSeason::AggSeason(std::list<PlantComponent*>* plants, const std::string& season) : Aggregate(plants)
 {
-	// Convert string to Flyweight pointer via Singleton
-	targetSeason = Inventory::getInstance()->getString(season);
+	// Look the string up without interning it; an unknown one matches no plant
+	targetSeason = Inventory::getInstance()->findAndRetainString(season);
+	if (targetSeason == nullptr)
+	{
+		targetSeason = Inventory::getMissingString();
+		targetSeason->retain();
+	}
 }
 
 AggSeason::AggSeason(std::list<PlantComponent*>* plants, Flyweight<std::string*>* season) : Aggregate(plants)
 {
-	// Directly assign the Flyweight pointer
+	// Held for the aggregate's lifetime so a reclaim cannot free it
 	targetSeason = season;
+	if (targetSeason)
+		targetSeason->retain();
+}
+
+AggSeason::~AggSeason()
+{
+	if (targetSeason)
+		targetSeason->release();
 }
 
 Iterator* AggSeason::createIterator()
@@ -52,10 +52,13 @@ class AggSeason : public Aggregate
 		 */
 		Flyweight<std::string*>* targetSeason;
 
+		AggSeason(const AggSeason &);
+		AggSeason &operator=(const AggSeason &);
+
 	public:
 		/**
 		 * @brief Constructor that initializes the aggregate with a plant collection and target season string.
-		 * Converts the season string to a Flyweight internally.
+		 * Looks the season up without interning it; an unknown season matches no plant.
 		 * @param plants Pointer to the list of PlantComponents to manage.
 		 * @param season The target season string for filtering (e.g., "Spring", "Summer", "Autumn", "Winter").
 		 */
@@ -75,9 +78,9 @@ class AggSeason : public Aggregate
 		Iterator* createIterator();
 
 		/**
-		 * @brief Virtual destructor for proper cleanup.
+		 * @brief Releases the target season flyweight.
 		 */
-		virtual ~AggSeason() {}
+		virtual ~AggSeason();
 };
 
 #endif //PHOTOSYNTECH_AGGSEASON_H
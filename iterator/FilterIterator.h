@@ -0,0 +1,133 @@
+#ifndef PHOTOSYNTECH_FILTERITERATOR_H
+#define PHOTOSYNTECH_FILTERITERATOR_H
+
+#include "Iterator.h"
+#include "StackFrame.h"
+#include "../prototype/LivingPlant.h"
+#include "../composite/PlantComponent.h"
+#include "../composite/PlantGroup.h"
+#include <list>
+#include <stack>
+
+/**
+ * @brief Shared bidirectional traversal for all filtering plant iterators.
+ *
+ * Implements the stack-based depth-first walk over nested PlantGroup hierarchies
+ * once, and defers the per-plant decision to matches(). Concrete iterators only
+ * describe which plants they accept; the traversal itself (first(), next(), back(),
+ * empty groups, composite boundaries) lives here.
+ *
+ * **System Role:**
+ * Common engine behind PlantIterator, SeasonIterator, PlantNameIterator and
+ * QueryIterator. Keeps O(1) amortized next() and back() by remembering the
+ * position at every level of the hierarchy in StackFrame entries.
+ *
+ * **Pattern Role:** Abstract Iterator with Template Method (matches() is the hook)
+ *
+ * **Related Patterns:**
+ * - Iterator: Implements the abstract bidirectional traversal interface
+ * - Template Method: matches() customises filtering without touching traversal
+ * - Composite: Descends into PlantGroup children in both directions
+ *
+ * **Implementation Details:**
+ * - Uses std::stack<StackFrame> for iterative tree traversal
+ * - Derived constructors must call first() once their filter state is set,
+ *   since matches() cannot be dispatched from this constructor
+ *
+ * @see PlantIterator, SeasonIterator, PlantNameIterator, QueryIterator
+ * @see StackFrame (traversal state structure)
+ */
+class FilterIterator : public Iterator
+{
+	public:
+		/**
+		 * @brief Virtual destructor for proper cleanup.
+		 */
+		virtual ~FilterIterator() {}
+
+		/**
+		 * @brief Positions the iterator at the first matching plant.
+		 */
+		virtual void first();
+
+		/**
+		 * @brief Advances the iterator to the next matching plant.
+		 */
+		virtual void next();
+
+		/**
+		 * @brief Moves the iterator back to the previous matching plant.
+		 */
+		virtual void back();
+
+		/**
+		 * @brief Checks if iteration is complete.
+		 * @return True if no more matching plants to iterate, false otherwise.
+		 */
+		virtual bool isDone();
+
+		/**
+		 * @brief Returns the current matching plant.
+		 * @return Pointer to the current matching LivingPlant.
+		 */
+		virtual LivingPlant* currentItem();
+
+	protected:
+		/**
+		 * @brief Constructor storing the root collection to traverse.
+		 * @param plants Pointer to the root list of PlantComponents.
+		 */
+		FilterIterator(std::list<PlantComponent*>* plants);
+
+		/**
+		 * @brief Filtering hook evaluated for every LivingPlant reached by the traversal.
+		 * @param plant The plant under consideration (never nullptr).
+		 * @return True if the plant should be returned by the iterator.
+		 */
+		virtual bool matches(LivingPlant* plant) = 0;
+
+		/**
+		 * @brief Cached pointer to the current matching plant, or nullptr if not found.
+		 */
+		LivingPlant* currentPlant;
+
+	private:
+		/**
+		 * @brief Root list this iterator walks.
+		 */
+		std::list<PlantComponent*>* rootPlants;
+
+		/**
+		 * @brief Stack tracking current position in nested plant groups.
+		 * Enables O(1) next() by avoiding re-traversal from root.
+		 */
+		std::stack<StackFrame> traversalStack;
+
+		/**
+		 * @brief Flag indicating if currently inside a PlantGroup composite.
+		 */
+		bool inComposite;
+
+		/**
+		 * @brief Flag indicating if we moved past the end (true) vs before beginning (false).
+		 * Used to determine behavior when stack is empty and currentPlant is nullptr.
+		 */
+		bool pastEnd;
+
+		/**
+		 * @brief Advances to the next matching plant using iterative stack-based traversal.
+		 */
+		void advanceToNextPlant();
+
+		/**
+		 * @brief Moves back to the previous matching plant using iterative stack-based traversal.
+		 */
+		void moveToPreviousPlant();
+
+		/**
+		 * @brief Positions iterator at the last matching plant (for back() from end position).
+		 */
+		void findLastPlant();
+};
+
+#endif //PHOTOSYNTECH_FILTERITERATOR_H
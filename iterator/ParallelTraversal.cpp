@@ -0,0 +1,41 @@
+#include "ParallelTraversal.h"
+#include "PlantRange.h"
+
+const std::size_t ParallelTraversal::MIN_PLANTS_PER_THREAD;
+
+ParallelTraversal::ParallelTraversal(std::list<PlantComponent*>* plants, unsigned threadCount,
+									 std::size_t minPlantsPerThread)
+{
+	// Counting first sizes the array once instead of regrowing it for large inventories
+	std::size_t count = 0;
+	PlantRange range(plants);
+	for (PlantRange::iterator it = range.begin(); it != range.end(); ++it) {
+		count++;
+	}
+	this->plants.reserve(count);
+	for (LivingPlant* plant : range) {
+		this->plants.push_back(plant);
+	}
+
+	unsigned maxWorkers = threadCount != 0 ? threadCount : std::thread::hardware_concurrency();
+	if (maxWorkers == 0) {
+		maxWorkers = 1;
+	}
+
+	// Never split below the per-thread minimum, but always keep at least one worker
+	std::size_t byWork = this->plants.size() / (minPlantsPerThread != 0 ? minPlantsPerThread : 1);
+	workers = byWork < maxWorkers ? (unsigned)byWork : maxWorkers;
+	if (workers == 0) {
+		workers = 1;
+	}
+}
+
+std::size_t ParallelTraversal::size() const
+{
+	return plants.size();
+}
+
+unsigned ParallelTraversal::workerCount() const
+{
+	return workers;
+}
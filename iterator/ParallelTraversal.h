@@ -0,0 +1,228 @@
+#ifndef PHOTOSYNTECH_PARALLELTRAVERSAL_H
+#define PHOTOSYNTECH_PARALLELTRAVERSAL_H
+
+#include "../prototype/LivingPlant.h"
+#include "../composite/PlantComponent.h"
+#include "../diagnostics/Tracer.h"
+#include <cstddef>
+#include <exception>
+#include <list>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Chunked, multi-threaded map-reduce over every LivingPlant in a composite.
+ *
+ * Flattens the PlantGroup hierarchy once into a contiguous array of plant pointers,
+ * splits it into equally sized chunks (one per worker) and folds each chunk on its
+ * own std::thread into a worker-local accumulator. Per-thread partial results are
+ * stored once and combined on the caller's thread, so accumulators never need
+ * locks and workers do not write to shared cache lines while folding.
+ *
+ * **System Role:**
+ * Backs inventory-wide reporting in NurseryFacade (stock valuation, health
+ * histograms, plants needing water). Balanced chunks mean a lopsided tree (one
+ * huge group next to many small ones) still spreads evenly across cores.
+ *
+ * **Pattern Role:** Internal Iterator over the Composite structure
+ *
+ * **Related Patterns:**
+ * - Composite: The flattening pass visits PlantGroup children depth-first
+ * - Iterator: Visits plants in the same order as PlantIterator / PlantRange
+ *
+ * **Implementation Details:**
+ * - Inventories with fewer than minPlantsPerThread plants per worker are folded
+ *   on the calling thread; spawning threads would cost more than the walk itself
+ * - Worker count defaults to std::thread::hardware_concurrency()
+ * - Plants are only read; concurrent structural changes to the inventory while a
+ *   reduction runs are not supported (same contract as the other iterators)
+ * - An exception from a callable, or a thread that fails to start, is rethrown to
+ *   the caller once every started worker has been joined
+ *
+ * @see PlantRange (single-threaded allocation-free traversal)
+ */
+class ParallelTraversal
+{
+	public:
+		/**
+		 * @brief Smallest chunk worth handing to its own thread.
+		 */
+		static const std::size_t MIN_PLANTS_PER_THREAD = 4096;
+
+		/**
+		 * @brief Joins every started worker when the spawning scope exits, even by an exception.
+		 *
+		 * Also used by ParallelBuild.
+		 */
+		class JoinAll
+		{
+			public:
+				explicit JoinAll(std::vector<std::thread>& threads) : threads(threads) {}
+
+				~JoinAll()
+				{
+					for (std::thread& thread : threads) {
+						if (thread.joinable()) {
+							thread.join();
+						}
+					}
+				}
+
+			private:
+				JoinAll(const JoinAll&);
+				JoinAll& operator=(const JoinAll&);
+
+				std::vector<std::thread>& threads;
+		};
+
+		/**
+		 * @brief Snapshots the plants below a collection for parallel folding.
+		 * @param plants Root list of PlantComponents (may be nullptr).
+		 * @param threadCount Maximum number of workers, or 0 for the hardware core count.
+		 * @param minPlantsPerThread Smallest chunk handed to a worker.
+		 */
+		ParallelTraversal(std::list<PlantComponent*>* plants, unsigned threadCount = 0,
+						  std::size_t minPlantsPerThread = MIN_PLANTS_PER_THREAD);
+
+		/**
+		 * @brief Number of plants captured by the traversal.
+		 * @return Count of LivingPlant leaves in the hierarchy.
+		 */
+		std::size_t size() const;
+
+		/**
+		 * @brief Number of workers a reduction over this traversal will use.
+		 * @return Thread count actually used, including the calling thread.
+		 */
+		unsigned workerCount() const;
+
+		/**
+		 * @brief Folds every plant into a result using one accumulator per worker.
+		 *
+		 * Each worker starts from a copy of @p identity, calls accumulate(partial, plant)
+		 * for every plant in its chunk, and the partials are merged in chunk order with
+		 * combine(result, partial).
+		 *
+		 * If accumulate throws on any worker, or a worker thread cannot be started, the
+		 * first exception in chunk order is rethrown after all workers have finished.
+		 *
+		 * @param identity Neutral starting value for every partial result.
+		 * @param accumulate Callable void(T&, LivingPlant*), invoked concurrently on distinct partials.
+		 * @param combine Callable void(T&, const T&), invoked on the calling thread only.
+		 * @return The combined result.
+		 */
+		template <typename T, typename Accumulate, typename Combine>
+		T reduce(const T& identity, Accumulate accumulate, Combine combine) const;
+
+		/**
+		 * @brief Counts the plants satisfying a predicate.
+		 * @param predicate Callable bool(LivingPlant*), invoked concurrently.
+		 * @return Number of plants for which predicate returned true.
+		 */
+		template <typename Predicate>
+		std::size_t count(Predicate predicate) const;
+
+		/**
+		 * @brief Sums a numeric projection over all plants.
+		 * @param projection Callable double(LivingPlant*), invoked concurrently.
+		 * @return Sum of projection over every plant.
+		 */
+		template <typename Projection>
+		double sum(Projection projection) const;
+
+	private:
+		/**
+		 * @brief Plants in depth-first order.
+		 */
+		std::vector<LivingPlant*> plants;
+
+		/**
+		 * @brief Resolved number of workers.
+		 */
+		unsigned workers;
+};
+
+template <typename T, typename Accumulate, typename Combine>
+T ParallelTraversal::reduce(const T& identity, Accumulate accumulate, Combine combine) const
+{
+	std::vector<T> partials(workers, identity);
+	std::vector<std::exception_ptr> errors(workers);
+	std::exception_ptr failure;
+	std::size_t chunk = (plants.size() + workers - 1) / workers;
+
+	{
+		std::vector<std::thread> threads;
+		threads.reserve(workers - 1);
+		JoinAll joinAll(threads);
+		try {
+			for (unsigned w = 0; w < workers; w++) {
+				std::size_t begin = w * chunk;
+				std::size_t end = begin + chunk < plants.size() ? begin + chunk : plants.size();
+				T* partial = &partials[w];
+				std::exception_ptr* error = &errors[w];
+
+				// Partials sit side by side; folding into them directly would share cache lines between workers.
+				// Anything escaping a worker thread would terminate the process; the caller rethrows it
+				auto fold = [this, begin, end, partial, error, &identity, &accumulate]() {
+					TRACE_SCOPE("fold", "traversal");
+					try {
+						T local = identity;
+						for (std::size_t i = begin; i < end; i++) {
+							accumulate(local, plants[i]);
+						}
+						*partial = std::move(local);
+					} catch (...) {
+						*error = std::current_exception();
+					}
+				};
+
+				// The calling thread takes the last chunk instead of idling in join()
+				if (w + 1 < workers) {
+					threads.push_back(std::thread([fold]() {
+						TRACE_THREAD_NAME("worker");
+						fold();
+					}));
+				} else {
+					fold();
+				}
+			}
+		} catch (...) {
+			// A thread could not be started; the ones that were still finish their chunks
+			failure = std::current_exception();
+		}
+	}
+
+	for (std::size_t w = 0; w < errors.size() && !failure; w++) {
+		failure = errors[w];
+	}
+	if (failure) {
+		std::rethrow_exception(failure);
+	}
+
+	T result = identity;
+	for (const T& partial : partials) {
+		combine(result, partial);
+	}
+	return result;
+}
+
+template <typename Predicate>
+std::size_t ParallelTraversal::count(Predicate predicate) const
+{
+	return reduce<std::size_t>(
+		0,
+		[&predicate](std::size_t& total, LivingPlant* plant) { total += predicate(plant) ? 1 : 0; },
+		[](std::size_t& total, const std::size_t& partial) { total += partial; });
+}
+
+template <typename Projection>
+double ParallelTraversal::sum(Projection projection) const
+{
+	return reduce<double>(
+		0.0,
+		[&projection](double& total, LivingPlant* plant) { total += projection(plant); },
+		[](double& total, const double& partial) { total += partial; });
+}
+
+#endif //PHOTOSYNTECH_PARALLELTRAVERSAL_H
@@ -1,12 +1,10 @@
 #ifndef PlantIterator_h
 #define PlantIterator_h
 
-#include "Iterator.h"
-#include "StackFrame.h"
+#include "FilterIterator.h"
 #include "../prototype/LivingPlant.h"
 #include "../composite/PlantComponent.h"
 #include "../composite/PlantGroup.h"
-#include <stack>
 
 /**
  * @brief Concrete bidirectional iterator for unfiltered plant traversal.
@@ -41,17 +39,17 @@
  * - Used when customers browse entire inventory
  *
  * **Implementation Details:**
- * - Uses std::stack<StackFrame> for iterative tree traversal
+ * - Traversal (std::stack<StackFrame>) inherited from FilterIterator; only matches() is defined here
  * - Maintains O(1) amortized complexity for next() and back()
  * - Handles empty groups and composite boundaries gracefully
  *
- * @see Iterator (abstract interface)
+ * @see FilterIterator (shared traversal)
  * @see AggPlant (creates this iterator)
  * @see StackFrame (traversal state structure)
  */
 class AggPlant;
 
-class PlantIterator : public Iterator
+class PlantIterator : public FilterIterator
 {
 	public:
 		/**
@@ -65,73 +63,13 @@ class PlantIterator : public Iterator
 		 */
 		virtual ~PlantIterator() {}
 
+	protected:
 		/**
-		 * @brief Positions the iterator at the first plant.
+		 * @brief Accepts every plant (no filtering).
+		 * @param plant The plant reached by the traversal.
+		 * @return Always true.
 		 */
-		void first();
-
-		/**
-		 * @brief Advances the iterator to the next plant.
-		 */
-		void next();
-
-		/**
-		 * @brief Moves the iterator back to the previous plant.
-		 */
-		void back();
-
-		/**
-		 * @brief Checks if iteration is complete.
-		 * @return True if no more plants to iterate, false otherwise.
-		 */
-		bool isDone();
-
-		/**
-		 * @brief Returns the current plant.
-		 * @return Pointer to the current LivingPlant.
-		 */
-		LivingPlant* currentItem();
-
-	private:
-		/**
-		 * @brief Cached pointer to the current plant, or nullptr if not found.
-		 */
-		LivingPlant* currentPlant;
-
-		/**
-		 * @brief Stack tracking current position in nested plant groups.
-		 * Enables O(1) next() by avoiding re-traversal from root.
-		 * Uses shared StackFrame struct for iterative tree traversal.
-		 */
-		std::stack<StackFrame> traversalStack;
-
-		/**
-		 * @brief Flag indicating if currently inside a PlantGroup composite.
-		 */
-		bool inComposite;
-
-		/**
-		 * @brief Flag indicating if we moved past the end (true) vs before beginning (false).
-		 * Used to determine behavior when stack is empty and currentPlant is nullptr.
-		 */
-		bool pastEnd;
-
-		/**
-		 * @brief Advances to the next plant using iterative stack-based traversal.
-		 * Replaces recursive findNextMatch with O(1) amortized complexity.
-		 */
-		void advanceToNextPlant();
-
-		/**
-		 * @brief Moves back to the previous plant using iterative stack-based traversal.
-		 * Handles composite hierarchy traversal in reverse direction.
-		 */
-		void moveToPreviousPlant();
-
-		/**
-		 * @brief Positions iterator at the last plant (for back() from end position).
-		 */
-		void findLastPlant();
+		bool matches(LivingPlant* plant);
 };
 
 #endif
@@ -0,0 +1,216 @@
+#include "PlantQuery.h"
+#include "../singleton/Singleton.h"
+#include <algorithm>
+
+PlantQuery::PlantQuery(std::list<PlantComponent*>* plants)
+	: Aggregate(plants),
+	  targetSeason(nullptr),
+	  targetName(nullptr),
+	  targetState(nullptr),
+	  minHealth(INT_MIN), maxHealth(INT_MAX),
+	  minWater(INT_MIN), maxWater(INT_MAX),
+	  minSun(INT_MIN), maxSun(INT_MAX),
+	  maxResults(0)
+{
+}
+
+PlantQuery::PlantQuery(const PlantQuery& other)
+	: Aggregate(other.plants),
+	  targetSeason(nullptr),
+	  targetName(nullptr),
+	  targetState(other.targetState),
+	  minHealth(other.minHealth), maxHealth(other.maxHealth),
+	  minWater(other.minWater), maxWater(other.maxWater),
+	  minSun(other.minSun), maxSun(other.maxSun),
+	  maxResults(other.maxResults),
+	  predicates(other.predicates)
+{
+	hold(targetSeason, other.targetSeason);
+	hold(targetName, other.targetName);
+}
+
+PlantQuery& PlantQuery::operator=(const PlantQuery& other)
+{
+	if (this != &other)
+	{
+		plants = other.plants;
+		hold(targetSeason, other.targetSeason);
+		hold(targetName, other.targetName);
+		targetState = other.targetState;
+		minHealth = other.minHealth;
+		maxHealth = other.maxHealth;
+		minWater = other.minWater;
+		maxWater = other.maxWater;
+		minSun = other.minSun;
+		maxSun = other.maxSun;
+		maxResults = other.maxResults;
+		predicates = other.predicates;
+	}
+	return *this;
+}
+
+PlantQuery::~PlantQuery()
+{
+	hold(targetSeason, nullptr);
+	hold(targetName, nullptr);
+}
+
+void PlantQuery::hold(Flyweight<std::string*>*& target, Flyweight<std::string*>* string)
+{
+	// Retain first: the new string may be the one currently held
+	if (string)
+		string->retain();
+	if (target)
+		target->release();
+	target = string;
+}
+
+PlantQuery& PlantQuery::season(const std::string& season)
+{
+	Flyweight<std::string*>* interned = Inventory::getInstance()->findAndRetainString(season);
+	this->season(interned ? interned : Inventory::getMissingString());
+	if (interned)
+		interned->release();
+	return *this;
+}
+
+PlantQuery& PlantQuery::season(Flyweight<std::string*>* season)
+{
+	hold(targetSeason, season);
+	return *this;
+}
+
+PlantQuery& PlantQuery::name(const std::string& name)
+{
+	Flyweight<std::string*>* interned = Inventory::getInstance()->findAndRetainString(name);
+	this->name(interned ? interned : Inventory::getMissingString());
+	if (interned)
+		interned->release();
+	return *this;
+}
+
+PlantQuery& PlantQuery::name(Flyweight<std::string*>* name)
+{
+	hold(targetName, name);
+	return *this;
+}
+
+PlantQuery& PlantQuery::state(int stateId)
+{
+	targetState = Inventory::getInstance()->getStates(stateId);
+	return *this;
+}
+
+PlantQuery& PlantQuery::healthBelow(int value)
+{
+	maxHealth = std::min(maxHealth, value - 1LL);
+	return *this;
+}
+
+PlantQuery& PlantQuery::healthAbove(int value)
+{
+	minHealth = std::max(minHealth, value + 1LL);
+	return *this;
+}
+
+PlantQuery& PlantQuery::waterBelow(int value)
+{
+	maxWater = std::min(maxWater, value - 1LL);
+	return *this;
+}
+
+PlantQuery& PlantQuery::waterAbove(int value)
+{
+	minWater = std::max(minWater, value + 1LL);
+	return *this;
+}
+
+PlantQuery& PlantQuery::sunBelow(int value)
+{
+	maxSun = std::min(maxSun, value - 1LL);
+	return *this;
+}
+
+PlantQuery& PlantQuery::sunAbove(int value)
+{
+	minSun = std::max(minSun, value + 1LL);
+	return *this;
+}
+
+PlantQuery& PlantQuery::where(std::function<bool(LivingPlant*)> predicate)
+{
+	if (predicate)
+		predicates.push_back(predicate);
+	return *this;
+}
+
+PlantQuery& PlantQuery::limit(std::size_t count)
+{
+	maxResults = count;
+	return *this;
+}
+
+bool PlantQuery::matches(LivingPlant* plant) const
+{
+	// Flyweight pointer comparisons first - cheapest and most selective
+	if (targetSeason && plant->getSeason() != targetSeason)
+		return false;
+	if (targetName && plant->getNameFlyweight() != targetName)
+		return false;
+	if (targetState && plant->getMaturity() != targetState)
+		return false;
+
+	int health = plant->getHealth();
+	if (health < minHealth || health > maxHealth)
+		return false;
+
+	int water = plant->getWaterLevel();
+	if (water < minWater || water > maxWater)
+		return false;
+
+	int sun = plant->getSunExposure();
+	if (sun < minSun || sun > maxSun)
+		return false;
+
+	for (const std::function<bool(LivingPlant*)>& predicate : predicates)
+	{
+		if (!predicate(plant))
+			return false;
+	}
+	return true;
+}
+
+Iterator* PlantQuery::createIterator()
+{
+	return new QueryIterator(this);
+}
+
+std::vector<LivingPlant*> PlantQuery::execute()
+{
+	std::vector<LivingPlant*> results;
+	QueryIterator itr(this);
+	while (!itr.isDone())
+	{
+		results.push_back(itr.currentItem());
+		itr.next();
+	}
+	return results;
+}
+
+std::size_t PlantQuery::count()
+{
+	std::size_t total = 0;
+	QueryIterator itr(this);
+	while (!itr.isDone())
+	{
+		total++;
+		itr.next();
+	}
+	return total;
+}
+
+LivingPlant* PlantQuery::firstMatch()
+{
+	QueryIterator itr(this);
+	return itr.currentItem();
+}
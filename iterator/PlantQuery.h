@@ -0,0 +1,221 @@
+#ifndef PHOTOSYNTECH_PLANTQUERY_H
+#define PHOTOSYNTECH_PLANTQUERY_H
+
+#include "Aggregate.h"
+#include "QueryIterator.h"
+#include <climits>
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <string>
+#include <vector>
+#include "../composite/PlantComponent.h"
+#include "../flyweight/Flyweight.h"
+
+/**
+ * @brief Composable predicate query over a plant hierarchy.
+ *
+ * Collects filtering criteria through chained calls and evaluates all of them in a
+ * single lazy traversal, e.g.
+ * `Inventory::getInstance()->query().season("Spring Season").state(Mature::getID()).healthBelow(30).limit(100)`.
+ * Nothing is scanned until an iterator is requested or the query is executed, and
+ * traversal stops as soon as the limit is reached.
+ *
+ * **System Role:**
+ * Replaces hard-wired filter iterators for operational questions
+ * ("which mature plants are dehydrated?"). Criteria are AND-ed together; range
+ * criteria on the same vital intersect (healthAbove(20).healthBelow(60)).
+ *
+ * **Pattern Role:** Concrete Aggregate (creates QueryIterator instances)
+ *
+ * **Related Patterns:**
+ * - Aggregate: Implements the iterator factory interface
+ * - Iterator: QueryIterator reuses FilterIterator's traversal (declared as friend)
+ * - Flyweight: Name, season and state criteria are compared by flyweight pointer
+ * - Singleton: Inventory::query() starts a query at the inventory root
+ *
+ * **System Interactions:**
+ * - Criteria setters return *this for chaining
+ * - matches() checks cheap pointer criteria first, then vitals, then custom predicates
+ * - createIterator() returns a bidirectional QueryIterator (caller deletes)
+ * - execute()/count()/firstMatch() run the query eagerly with early termination
+ *
+ * @see QueryIterator (iterator created by this aggregate)
+ * @see FilterIterator (shared traversal)
+ */
+class PlantQuery : public Aggregate
+{
+	friend class QueryIterator;
+
+	private:
+		Flyweight<std::string*>* targetSeason;
+		Flyweight<std::string*>* targetName;
+		Flyweight<MaturityState*>* targetState;
+
+		/**
+		 * @brief Inclusive bounds for the plant vitals (INT_MIN/INT_MAX when unbounded).
+		 *
+		 * Wider than int so that healthBelow(INT_MIN) and healthAbove(INT_MAX)
+		 * become empty ranges instead of overflowing.
+		 */
+		long long minHealth, maxHealth;
+		long long minWater, maxWater;
+		long long minSun, maxSun;
+
+		/**
+		 * @brief Maximum number of results produced in forward order (0 = unlimited).
+		 */
+		std::size_t maxResults;
+
+		/**
+		 * @brief Custom predicates, evaluated last and only when every built-in criterion matched.
+		 */
+		std::vector<std::function<bool(LivingPlant*)> > predicates;
+
+		/**
+		 * @brief Retains string and releases what target held, so reclaims never free a filter's string.
+		 */
+		static void hold(Flyweight<std::string*>*& target, Flyweight<std::string*>* string);
+
+	public:
+		/**
+		 * @brief Constructs an unrestricted query over a plant collection.
+		 * @param plants Pointer to the list of PlantComponents to query.
+		 */
+		PlantQuery(std::list<PlantComponent*>* plants);
+
+		/**
+		 * @brief Copies the criteria, taking its own references on the season and name.
+		 */
+		PlantQuery(const PlantQuery& other);
+		PlantQuery& operator=(const PlantQuery& other);
+
+		/**
+		 * @brief Restricts results to plants of the given season.
+		 * @param season Season string (e.g. "Spring Season"), looked up without interning it; an unknown string matches nothing.
+		 * @return This query for chaining.
+		 */
+		PlantQuery& season(const std::string& season);
+
+		/**
+		 * @brief Restricts results to plants of the given season flyweight.
+		 * @param season Season flyweight pointer.
+		 * @return This query for chaining.
+		 */
+		PlantQuery& season(Flyweight<std::string*>* season);
+
+		/**
+		 * @brief Restricts results to plants with the given name.
+		 * @param name Plant name (e.g. "Rose"), looked up without interning it; an unknown string matches nothing.
+		 * @return This query for chaining.
+		 */
+		PlantQuery& name(const std::string& name);
+
+		/**
+		 * @brief Restricts results to plants with the given name flyweight.
+		 * @param name Name flyweight pointer.
+		 * @return This query for chaining.
+		 */
+		PlantQuery& name(Flyweight<std::string*>* name);
+
+		/**
+		 * @brief Restricts results to plants in the given maturity state.
+		 * @param stateId State ID (e.g. Mature::getID()).
+		 * @return This query for chaining.
+		 */
+		PlantQuery& state(int stateId);
+
+		/**
+		 * @brief Restricts results to plants with health strictly below a value.
+		 * @param value Exclusive upper bound.
+		 * @return This query for chaining.
+		 */
+		PlantQuery& healthBelow(int value);
+
+		/**
+		 * @brief Restricts results to plants with health strictly above a value.
+		 * @param value Exclusive lower bound.
+		 * @return This query for chaining.
+		 */
+		PlantQuery& healthAbove(int value);
+
+		/**
+		 * @brief Restricts results to plants with a water level strictly below a value.
+		 * @param value Exclusive upper bound.
+		 * @return This query for chaining.
+		 */
+		PlantQuery& waterBelow(int value);
+
+		/**
+		 * @brief Restricts results to plants with a water level strictly above a value.
+		 * @param value Exclusive lower bound.
+		 * @return This query for chaining.
+		 */
+		PlantQuery& waterAbove(int value);
+
+		/**
+		 * @brief Restricts results to plants with sun exposure strictly below a value.
+		 * @param value Exclusive upper bound.
+		 * @return This query for chaining.
+		 */
+		PlantQuery& sunBelow(int value);
+
+		/**
+		 * @brief Restricts results to plants with sun exposure strictly above a value.
+		 * @param value Exclusive lower bound.
+		 * @return This query for chaining.
+		 */
+		PlantQuery& sunAbove(int value);
+
+		/**
+		 * @brief Adds a custom predicate that must also hold.
+		 * @param predicate Callable returning true for accepted plants.
+		 * @return This query for chaining.
+		 */
+		PlantQuery& where(std::function<bool(LivingPlant*)> predicate);
+
+		/**
+		 * @brief Stops the query after a number of results.
+		 * @param count Maximum number of results (0 = unlimited).
+		 * @return This query for chaining.
+		 */
+		PlantQuery& limit(std::size_t count);
+
+		/**
+		 * @brief Evaluates every criterion against a single plant.
+		 * @param plant Plant to test.
+		 * @return True if the plant satisfies the query.
+		 */
+		bool matches(LivingPlant* plant) const;
+
+		/**
+		 * @brief Creates a lazy bidirectional iterator over the matching plants.
+		 * @return Pointer to a new QueryIterator (caller takes ownership).
+		 */
+		Iterator* createIterator();
+
+		/**
+		 * @brief Runs the query and collects the matching plants in traversal order.
+		 * @return Matching plants, at most limit() of them.
+		 */
+		std::vector<LivingPlant*> execute();
+
+		/**
+		 * @brief Counts matching plants, stopping early at the limit.
+		 * @return Number of matching plants.
+		 */
+		std::size_t count();
+
+		/**
+		 * @brief Returns the first matching plant without scanning further.
+		 * @return First matching plant, or nullptr if none matched.
+		 */
+		LivingPlant* firstMatch();
+
+		/**
+		 * @brief Releases the season and name flyweights.
+		 */
+		virtual ~PlantQuery();
+};
+
+#endif //PHOTOSYNTECH_PLANTQUERY_H
@@ -0,0 +1,237 @@
+#ifndef PHOTOSYNTECH_PLANTRANGE_H
+#define PHOTOSYNTECH_PLANTRANGE_H
+
+#include "../prototype/LivingPlant.h"
+#include "../composite/PlantComponent.h"
+#include "../composite/PlantGroup.h"
+#include <cstddef>
+#include <iterator>
+#include <list>
+#include <vector>
+
+/**
+ * @brief Allocation-free forward range over every LivingPlant in a composite.
+ *
+ * Value-type counterpart of AggPlant + PlantIterator for read-only forward walks.
+ * The range and its iterator live on the caller's stack: no aggregate, no heap
+ * iterator and no std::stack (deque) allocation per traversal, so a loop such as
+ *
+ * @code
+ * for (LivingPlant* plant : PlantRange(group->getPlants())) { ... }
+ * @endcode
+ *
+ * compiles down to a tight depth-first walk over the std::list nodes.
+ *
+ * **System Role:**
+ * Used by NurseryFacade helpers that only need to visit or count plants in order
+ * (menu strings, basket contents, index lookups). The virtual Iterator API stays
+ * the right tool when back() or filtering through an Aggregate is required.
+ *
+ * **Pattern Role:** External Iterator (value-semantics, forward only)
+ *
+ * **Related Patterns:**
+ * - Iterator: Same visiting order as PlantIterator (pre-order, depth-first)
+ * - Composite: Descends into PlantGroup children, skipping empty groups
+ *
+ * **Implementation Details:**
+ * - Traversal frames are kept in an inline array of INLINE_DEPTH entries;
+ *   hierarchies nested deeper than that spill into a std::vector, which is the
+ *   only case that touches the heap
+ * - Like the other iterators, the range must not outlive structural changes
+ *   to the lists it walks
+ *
+ * @see PlantIterator (bidirectional virtual equivalent)
+ * @see StackFrame (frame layout used by the virtual iterators)
+ */
+class PlantRange
+{
+	public:
+		/**
+		 * @brief Number of hierarchy levels tracked without heap allocation.
+		 */
+		static const std::size_t INLINE_DEPTH = 16;
+
+		/**
+		 * @brief Forward iterator yielding LivingPlant pointers.
+		 */
+		class iterator
+		{
+			public:
+				typedef std::forward_iterator_tag iterator_category;
+				typedef LivingPlant* value_type;
+				typedef std::ptrdiff_t difference_type;
+				typedef LivingPlant* const* pointer;
+				typedef LivingPlant* const& reference;
+
+				/**
+				 * @brief Constructs the past-the-end iterator.
+				 */
+				iterator() : depth(0), current(nullptr) {}
+
+				/**
+				 * @brief Constructs an iterator positioned at the first plant of a list.
+				 * @param plants Root list to walk (may be nullptr or empty).
+				 */
+				explicit iterator(std::list<PlantComponent*>* plants) : depth(0), current(nullptr)
+				{
+					if (plants != nullptr) {
+						push(plants);
+						advance();
+					}
+				}
+
+				/**
+				 * @brief Returns the current plant.
+				 * @return Reference to the current LivingPlant pointer.
+				 */
+				reference operator*() const { return current; }
+
+				/**
+				 * @brief Advances to the next plant in depth-first order.
+				 * @return Reference to this iterator.
+				 */
+				iterator& operator++()
+				{
+					++top().position;
+					advance();
+					return *this;
+				}
+
+				/**
+				 * @brief Post-increment; advances and returns the previous position.
+				 * @return Copy of the iterator before advancing.
+				 */
+				iterator operator++(int)
+				{
+					iterator previous(*this);
+					++(*this);
+					return previous;
+				}
+
+				/**
+				 * @brief Two iterators are equal when they point at the same plant.
+				 */
+				bool operator==(const iterator& other) const { return current == other.current; }
+
+				/**
+				 * @brief Inequality counterpart of operator==.
+				 */
+				bool operator!=(const iterator& other) const { return current != other.current; }
+
+			private:
+				/**
+				 * @brief Position within one level of the hierarchy.
+				 */
+				struct Frame
+				{
+					std::list<PlantComponent*>::iterator position;
+					std::list<PlantComponent*>::iterator end;
+				};
+
+				Frame& top()
+				{
+					return depth <= INLINE_DEPTH ? frames[depth - 1] : overflow[depth - INLINE_DEPTH - 1];
+				}
+
+				void push(std::list<PlantComponent*>* plants)
+				{
+					Frame frame;
+					frame.position = plants->begin();
+					frame.end = plants->end();
+					if (depth < INLINE_DEPTH) {
+						frames[depth] = frame;
+					} else {
+						overflow.push_back(frame);
+					}
+					++depth;
+				}
+
+				void pop()
+				{
+					if (depth > INLINE_DEPTH) {
+						overflow.pop_back();
+					}
+					--depth;
+				}
+
+				/**
+				 * @brief Moves forward from the current frame position to the next plant.
+				 */
+				void advance()
+				{
+					while (depth > 0) {
+						Frame& frame = top();
+
+						if (frame.position == frame.end) {
+							pop();
+							continue;
+						}
+
+						PlantComponent* component = *frame.position;
+						ComponentType type = component->getType();
+
+						if (type == ComponentType::LIVING_PLANT) {
+							current = static_cast<LivingPlant*>(component);
+							return;
+						}
+
+						// Step past the group in the parent before descending into it
+						++frame.position;
+						if (type == ComponentType::PLANT_GROUP) {
+							push(static_cast<PlantGroup*>(component)->getPlants());
+						}
+					}
+
+					current = nullptr;
+				}
+
+				Frame frames[INLINE_DEPTH];
+				std::vector<Frame> overflow;
+				std::size_t depth;
+				LivingPlant* current;
+		};
+
+		/**
+		 * @brief Constructs a range over a plant collection.
+		 * @param plants Pointer to the root list of PlantComponents (may be nullptr).
+		 */
+		explicit PlantRange(std::list<PlantComponent*>* plants) : plants(plants) {}
+
+		/**
+		 * @brief Returns an iterator at the first plant.
+		 * @return Iterator to the first LivingPlant, or end() if there is none.
+		 */
+		iterator begin() const { return iterator(plants); }
+
+		/**
+		 * @brief Returns the past-the-end iterator.
+		 * @return Iterator compared against to detect the end of traversal.
+		 */
+		iterator end() const { return iterator(); }
+
+		/**
+		 * @brief Returns the plant at a traversal position without building a container.
+		 * @param index Zero-based position in depth-first order.
+		 * @return Pointer to the plant, or nullptr if index is out of range.
+		 */
+		LivingPlant* at(int index) const
+		{
+			if (index < 0) {
+				return nullptr;
+			}
+			for (LivingPlant* plant : *this) {
+				if (index-- == 0) {
+					return plant;
+				}
+			}
+			return nullptr;
+		}
+
+	private:
+		/**
+		 * @brief Root list this range walks.
+		 */
+		std::list<PlantComponent*>* plants;
+};
+
+#endif //PHOTOSYNTECH_PLANTRANGE_H
@@ -0,0 +1,51 @@
+#include "QueryIterator.h"
+#include "PlantQuery.h"
+
+QueryIterator::QueryIterator(PlantQuery* aggregate) : FilterIterator(aggregate->plants), produced(0), lastResult(nullptr)
+{
+	this->aggregate = aggregate;
+	first();
+}
+
+void QueryIterator::first()
+{
+	lastResult = nullptr;
+	FilterIterator::first();
+	produced = isDone() ? 0 : 1;
+}
+
+void QueryIterator::next()
+{
+	std::size_t limit = static_cast<PlantQuery*>(aggregate)->maxResults;
+
+	// Early termination: stop without walking the rest of the hierarchy. The
+	// traversal stays on the last result, so back() returns to it like it
+	// returns to the last match after natural exhaustion.
+	if (limit != 0 && produced >= limit) {
+		if (currentPlant != nullptr) {
+			lastResult = currentPlant;
+			currentPlant = nullptr;
+		}
+		return;
+	}
+
+	FilterIterator::next();
+	if (!isDone()) {
+		produced++;
+	}
+}
+
+void QueryIterator::back()
+{
+	if (lastResult != nullptr) {
+		currentPlant = lastResult;
+		lastResult = nullptr;
+		return;
+	}
+	FilterIterator::back();
+}
+
+bool QueryIterator::matches(LivingPlant* plant)
+{
+	return static_cast<PlantQuery*>(aggregate)->matches(plant);
+}
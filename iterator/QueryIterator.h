@@ -0,0 +1,76 @@
+#ifndef PHOTOSYNTECH_QUERYITERATOR_H
+#define PHOTOSYNTECH_QUERYITERATOR_H
+
+#include "FilterIterator.h"
+#include <cstddef>
+
+/**
+ * @brief Lazy bidirectional iterator over the results of a PlantQuery.
+ *
+ * Evaluates the query's criteria while traversing, so each next() only walks as
+ * far as the following match. Forward iteration ends once the query's limit has
+ * been produced, without visiting the rest of the hierarchy.
+ *
+ * **Pattern Role:** Concrete Iterator (criteria-driven filtering)
+ *
+ * **Implementation Details:**
+ * - Traversal inherited from FilterIterator; matches() delegates to PlantQuery::matches()
+ * - The limit applies to results produced by first()/next(); back() is unrestricted
+ * - back() after the limit was reached returns to the last result, as back()
+ *   after natural exhaustion returns to the last match
+ *
+ * @see PlantQuery (creates this iterator)
+ * @see FilterIterator (shared traversal)
+ */
+class PlantQuery;
+
+class QueryIterator : public FilterIterator
+{
+	public:
+		/**
+		 * @brief Constructor that initializes the iterator with a query.
+		 * @param aggregate Pointer to the PlantQuery describing the criteria.
+		 */
+		QueryIterator(PlantQuery* aggregate);
+
+		/**
+		 * @brief Virtual destructor for proper cleanup.
+		 */
+		virtual ~QueryIterator() {}
+
+		/**
+		 * @brief Positions the iterator at the first result and resets the limit count.
+		 */
+		void first();
+
+		/**
+		 * @brief Advances to the next result, or finishes once the limit is reached.
+		 */
+		void next();
+
+		/**
+		 * @brief Steps back one result; after the limit was reached, returns to the last result.
+		 */
+		void back();
+
+	protected:
+		/**
+		 * @brief Accepts plants satisfying every criterion of the query.
+		 * @param plant The plant reached by the traversal.
+		 * @return True if PlantQuery::matches() accepts the plant.
+		 */
+		bool matches(LivingPlant* plant);
+
+	private:
+		/**
+		 * @brief Number of results produced in forward order since first().
+		 */
+		std::size_t produced;
+
+		/**
+		 * @brief Result the traversal stopped on when the limit ended it, or nullptr.
+		 */
+		LivingPlant* lastResult;
+};
+
+#endif //PHOTOSYNTECH_QUERYITERATOR_H
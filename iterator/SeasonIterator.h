@@ -1,12 +1,10 @@
 #ifndef PHOTOSYNTECH_SEASONITERATOR_H
 #define PHOTOSYNTECH_SEASONITERATOR_H
 
-#include "Iterator.h"
-#include "StackFrame.h"
+#include "FilterIterator.h"
 #include "../prototype/LivingPlant.h"
 #include "../composite/PlantComponent.h"
 #include "../composite/PlantGroup.h"
-#include <stack>
 
 /**
  * @brief Generic bidirectional concrete iterator for filtering plants by season.
@@ -43,19 +41,19 @@
  * - Supports bidirectional navigation through filtered results
  *
  * **Implementation Details:**
- * - Uses std::stack<StackFrame> for iterative tree traversal
+ * - Traversal (std::stack<StackFrame>) inherited from FilterIterator; only matches() is defined here
  * - Maintains O(1) amortized complexity for next() and back() operations
  * - Filtering applied consistently in both traversal directions
  * - Handles empty groups and composite boundaries gracefully
  *
- * @see Iterator (abstract interface)
+ * @see FilterIterator (shared traversal)
  * @see AggSeason (creates this iterator)
  * @see LivingPlant::getSeason() (method used for filtering)
  * @see StackFrame (traversal state structure)
  */
 class AggSeason;
 
-class SeasonIterator : public Iterator
+class SeasonIterator : public FilterIterator
 {
 	public:
 		/**
@@ -69,73 +67,13 @@ class SeasonIterator : public Iterator
 		 */
 		virtual ~SeasonIterator() {}
 
+	protected:
 		/**
-		 * @brief Positions the iterator at the first plant matching the target season.
+		 * @brief Accepts plants whose season flyweight is the target season.
+		 * @param plant The plant reached by the traversal.
+		 * @return True if plant->getSeason() is the aggregate's target season flyweight.
 		 */
-		void first();
-
-		/**
-		 * @brief Advances the iterator to the next plant matching the target season.
-		 */
-		void next();
-
-		/**
-		 * @brief Moves the iterator back to the previous plant matching the target season.
-		 */
-		void back();
-
-		/**
-		 * @brief Checks if iteration is complete.
-		 * @return True if no more matching plants to iterate, false otherwise.
-		 */
-		bool isDone();
-
-		/**
-		 * @brief Returns the current matching plant.
-		 * @return Pointer to the current matching LivingPlant.
-		 */
-		LivingPlant* currentItem();
-
-	private:
-		/**
-		 * @brief Cached pointer to the current matching plant, or nullptr if not found.
-		 */
-		LivingPlant* currentPlant;
-
-		/**
-		 * @brief Stack tracking current position in nested plant groups.
-		 * Enables O(1) next() by avoiding re-traversal from root.
-		 * Uses shared StackFrame struct for iterative tree traversal.
-		 */
-		std::stack<StackFrame> traversalStack;
-
-		/**
-		 * @brief Flag indicating if currently inside a PlantGroup composite.
-		 */
-		bool inComposite;
-
-		/**
-		 * @brief Flag indicating if we moved past the end (true) vs before beginning (false).
-		 * Used to determine behavior when stack is empty and currentPlant is nullptr.
-		 */
-		bool pastEnd;
-
-		/**
-		 * @brief Advances to the next matching plant using iterative stack-based traversal.
-		 * Filters by season while traversing. Replaces recursive findNextMatch.
-		 */
-		void advanceToNextPlant();
-
-		/**
-		 * @brief Moves back to the previous matching plant using iterative stack-based traversal.
-		 * Filters by season while traversing backwards.
-		 */
-		void moveToPreviousPlant();
-
-		/**
-		 * @brief Positions iterator at the last matching plant (for back() from end position).
-		 */
-		void findLastPlant();
+		bool matches(LivingPlant* plant);
 };
 
 #endif //PHOTOSYNTECH_SEASONITERATOR_H
@@ -1,6 +1,9 @@
 #include "Customer.h"
 #include "Mediator.h"
 #include "../composite/PlantGroup.h"
+#include "../diagnostics/Tracer.h"
+#include "../composite/InfoSink.h"
+#include <cstring>
 #include <iostream>
 
 /**
@@ -58,27 +61,37 @@ string Customer::askForSuggestion()
  */
 string Customer::purchasePlants()
 {
+    string receipt;
+    StringInfoSink sink(receipt);
+    purchasePlants(sink);
+    return receipt;
+}
+
+void Customer::purchasePlants(InfoSink &receipt)
+{
+    TRACE_SCOPE("purchase", "mediator");
+    const char *message;
     if (salesFloor != nullptr)
     {
         if (basket != nullptr)
         {
 
             std::cout << "Customer: Initiating plant purchase" << std::endl;
-            string output = salesFloor->getAssistance(this);
+            salesFloor->getAssistance(this, receipt);
             basket = nullptr;
-            return output;
+            return;
         }
         else
         {
-            std::cout << "Customer: Cannot purchase - basket is empty" << std::endl;
-            return "Customer: Cannot purchase - basket is empty";
+            message = "Customer: Cannot purchase - basket is empty";
         }
     }
     else
     {
-        std::cout << "Customer: No sales floor available" << std::endl;
-        return "Customer: No sales floor available";
+        message = "Customer: No sales floor available";
     }
+    std::cout << message << std::endl;
+    receipt.write(message, std::strlen(message));
 }
 
 /**
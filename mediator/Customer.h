@@ -36,8 +36,11 @@
  * @see SalesFloor, SuggestionFloor (mediators)
  */
 class PlantComponent;  // Forward declaration to prevent circular dependency
+class InfoSink;
 class Customer : public User
 {
+	friend class InventorySnapshot;
+
 	private:
 		PlantGroup* basket;
 
@@ -55,6 +58,12 @@ class Customer : public User
 		 */
 		string purchasePlants();
 
+		/**
+		 * @brief Purchases the basket, streaming the receipt into a sink.
+		 * @param receipt Destination for the receipt, or the reason there is none.
+		 */
+		void purchasePlants(InfoSink &receipt);
+
 		/**
 		 * @brief Adds a plant to the customer's shopping basket.
 		 * @param plant Pointer to the PlantComponent to add.
@@ -1,5 +1,6 @@
 #include "Mediator.h"
 #include "../singleton/Singleton.h"
+#include "../composite/InfoSink.h"
 #include <iostream>
 
 /**
@@ -10,3 +11,8 @@
  * lists directly from the Singleton instance.
  */
 
+void Mediator::getAssistance(Customer *customer, InfoSink &reply)
+{
+    string text = getAssistance(customer);
+    reply.write(text.data(), text.size());
+}
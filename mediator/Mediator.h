@@ -5,6 +5,8 @@
 #include "User.h"
 #include "Staff.h"
 
+class InfoSink;
+
 /**
  * @brief Abstract mediator interface for coordinating colleague interactions.
  *
@@ -50,6 +52,17 @@ class Mediator
 		 */
 		virtual string getAssistance(Customer* customer) = 0;
 
+		/**
+		 * @brief Routes a customer's request and streams the reply into a sink.
+		 *
+		 * Writes getAssistance()'s reply by default; mediators whose replies
+		 * can be large (receipts) produce them incrementally instead.
+		 *
+		 * @param customer Pointer to the customer requesting assistance.
+		 * @param reply Destination for the reply.
+		 */
+		virtual void getAssistance(Customer* customer, InfoSink &reply);
+
 		/**
 		 * @brief Coordinates staff assistance operations.
 		 */
@@ -2,30 +2,47 @@
 #include "Staff.h"
 #include "Customer.h"
 #include "../singleton/Singleton.h"
+#include "../singleton/SimulationRandom.h"
+#include "../composite/InfoSink.h"
+#include <cstring>
 #include <iostream>
-#include <cstdlib>
-#include <ctime>
 
 /**
  * @brief Constructs a new SalesFloor mediator.
  */
 SalesFloor::SalesFloor()
 {
-    std::srand(std::time(0));
     std::cout << "SalesFloor: Sales floor mediator initialized" << std::endl;
 }
 
+namespace
+{
+    void reply(InfoSink &sink, const char *message)
+    {
+        std::cout << message << std::endl;
+        sink.write(message, std::strlen(message));
+    }
+}
+
 /**
  * @brief Routes customer assistance requests to available sales staff.
  * @param customer Pointer to the User requesting sales assistance.
  */
 string SalesFloor::getAssistance(Customer *customer)
+{
+    string receipt;
+    StringInfoSink sink(receipt);
+    getAssistance(customer, sink);
+    return receipt;
+}
+
+void SalesFloor::getAssistance(Customer *customer, InfoSink &sink)
 {
 
     if (customer == 0)
     {
-        std::cout << "SalesFloor: Invalid customer type for sales assistance" << std::endl;
-        return "SalesFloor: Invalid customer type for sales assistance";
+        reply(sink, "SalesFloor: Invalid customer type for sales assistance");
+        return;
     }
 
     std::cout << "SalesFloor: Routing purchase request from customer" << std::endl;
@@ -35,12 +52,12 @@ string SalesFloor::getAssistance(Customer *customer)
 
     if (staffList.empty())
     {
-        std::cout << "SalesFloor: No staff available, customer must wait" << std::endl;
-        return "SalesFloor: No staff available, customer must wait";
+        reply(sink, "SalesFloor: No staff available, customer must wait");
+        return;
     }
 
     // random staff selection
-    int randomIndex = std::rand() % staffList.size();
+    int randomIndex = (int)SimulationRandom::pick(SimulationRandom::Stream::SALES_FLOOR, staffList.size());
     Staff *availableStaff = staffList[randomIndex];
 
     std::cout << "SalesFloor: Assigning customer to staff member " << randomIndex << std::endl;
@@ -48,12 +65,11 @@ string SalesFloor::getAssistance(Customer *customer)
     PlantGroup *basket = customer->getBasket();
     if (basket != 0)
     {
-        return availableStaff->assistPurchases(basket);
+        availableStaff->assistPurchases(basket, sink);
     }
     else
     {
-        std::cout << "SalesFloor: Customer basket is empty - no purchase to process" << std::endl;
-        return "SalesFloor: Customer basket is empty - no purchase to process";
+        reply(sink, "SalesFloor: Customer basket is empty - no purchase to process");
     }
 }
 
@@ -24,6 +24,13 @@ public:
      */
     virtual string getAssistance(Customer* customer) ;
 
+    /**
+     * @brief Routes a purchase to available sales staff, streaming the receipt.
+     * @param customer Pointer to the customer making the purchase.
+     * @param reply Receives the receipt, or the reason there is none.
+     */
+    virtual void getAssistance(Customer* customer, InfoSink &reply) ;
+
     /**
      * @brief Coordinates staff assistance for sales operations.
      */
@@ -1,8 +1,11 @@
 #include "Staff.h"
 #include "../composite/PlantGroup.h"
 #include "../singleton/Singleton.h"
-#include <cstdlib>
-#include <ctime>
+#include "../singleton/SimulationRandom.h"
+#include "../builder/SpeciesCatalog.h"
+#include "../composite/InfoBuffer.h"
+#include "../composite/InfoSink.h"
+#include <cstring>
 #include <sstream>
 #include <iostream>
 
@@ -26,6 +29,56 @@
  * any object or interact with customer baskets. Can be extended post-MVP
  * to integrate with Flyweight and plant builders.
  */
+namespace
+{
+    struct Keyword
+    {
+        const char *text;
+        SpeciesCatalog::Id species;
+    };
+
+    // Baseline classification order for names that are not exact catalog
+    // entries: trees, then flowering plants, then succulents
+    const Keyword KEYWORDS[] = {
+        {"Maple", SpeciesCatalog::MAPLE},
+        {"Pine", SpeciesCatalog::PINE},
+        {"Cherry", SpeciesCatalog::CHERRY_BLOSSOM},
+        {"Rose", SpeciesCatalog::ROSE},
+        {"Sunflower", SpeciesCatalog::SUNFLOWER},
+        {"Lavender", SpeciesCatalog::LAVENDER},
+        {"Cactus", SpeciesCatalog::CACTUS},
+        {"Jade", SpeciesCatalog::JADE},
+    };
+
+    /**
+     * @brief Finds the category and advice staff give for a plant name.
+     *
+     * Exact species names resolve through the catalog; any other name falls
+     * back to the first species keyword it contains, then to "Succulent".
+     * @return False if the name matches nothing.
+     */
+    bool classifyPlant(const std::string &name, PlantCategory &category, const char *&advice)
+    {
+        const Species *species = SpeciesCatalog::find(name);
+        for (std::size_t i = 0; species == nullptr && i < sizeof(KEYWORDS) / sizeof(KEYWORDS[0]); i++) {
+            if (name.find(KEYWORDS[i].text) != std::string::npos)
+                species = &SpeciesCatalog::get(KEYWORDS[i].species);
+        }
+
+        if (species != nullptr) {
+            category = species->category;
+            advice = species->advice;
+            return true;
+        }
+        if (name.find("Succulent") != std::string::npos) {
+            category = PlantCategory::SUCCULENT;
+            advice = "Succulents are great for beginners - they're hardy and don't need constant attention.";
+            return true;
+        }
+        return false;
+    }
+}
+
 Staff::Staff() : User()
 {
     this->name = "Staff member";
@@ -61,51 +114,35 @@ string Staff::assistSuggestion()
         return "We have plants in inventory, but none are available for recommendations at the moment.\n";
     }
 
-    std::srand(static_cast<unsigned int>(std::time(nullptr)));
-    int idx = std::rand() % availablePlants.size();
+    int idx = (int)SimulationRandom::pick(SimulationRandom::Stream::STAFF_RECOMMENDATION, availablePlants.size());
     PlantComponent* selectedPlant = availablePlants[idx];
-    std::string plantType = selectedPlant->getName();
+    const std::string &plantType = selectedPlant->getNameView();
 
     std::string recommendation = "\nYou know, based on what we have in stock right now, I'd really recommend our " + plantType + ".\n";
     
-    if (plantType.find("Maple") != std::string::npos || 
-        plantType.find("Pine") != std::string::npos || 
-        plantType.find("Cherry") != std::string::npos) {
-        recommendation += "It's a tree, so it's more of a long-term investment for your garden. ";
-        if (plantType.find("Maple") != std::string::npos) 
-            recommendation += "The Maple gives you those gorgeous fall colors - really transforms your yard in autumn.";
-        else if (plantType.find("Pine") != std::string::npos)
-            recommendation += "The Pine stays green all year round and doesn't need much maintenance, which is great if you're busy.";
-        else if (plantType.find("Cherry") != std::string::npos)
-            recommendation += "The Cherry Blossom puts on an amazing show in spring - the flowers are just spectacular.";
-        recommendation += " Just keep in mind it'll need regular watering and plenty of space to grow.\n";
-        
-    } else if (plantType.find("Rose") != std::string::npos || 
-               plantType.find("Sunflower") != std::string::npos || 
-               plantType.find("Lavender") != std::string::npos) {
-        recommendation += "This is one of our flowering plants - perfect if you want some seasonal color. ";
-        if (plantType.find("Rose") != std::string::npos)
-            recommendation += "Roses are classic, though watch out for the thorns when you're pruning them.";
-        else if (plantType.find("Sunflower") != std::string::npos) 
-            recommendation += "Sunflowers grow really fast and the bees absolutely love them - great for your garden ecosystem.";
-        else if (plantType.find("Lavender") != std::string::npos)
-            recommendation += "Lavender smells amazing, doesn't need much water, and the purple flowers are just lovely.";
-        recommendation += " They do best with regular watering and lots of sunlight.\n";
-        
-    } else if (plantType.find("Cactus") != std::string::npos || 
-               plantType.find("Jade") != std::string::npos ||
-               plantType.find("Succulent") != std::string::npos) {
-        recommendation += "If you're looking for something low-maintenance, this is perfect. ";
-        if (plantType.find("Cactus") != std::string::npos)
-            recommendation += "Cacti are practically indestructible - they store water so you can't really overwater them.";
-        else if (plantType.find("Jade") != std::string::npos)
-            recommendation += "Jade plants are supposed to bring good luck, and they're super easy to grow from cuttings.";
-        else
-            recommendation += "Succulents are great for beginners - they're hardy and don't need constant attention.";
-        recommendation += " They don't need much attention and do great indoors or in sunny spots.\n";
-    } else {
+    PlantCategory category;
+    const char *advice;
+    if (!classifyPlant(plantType, category, advice)) {
         recommendation += "This is one of our quality plants that's been growing well in our nursery. ";
         recommendation += "It's a great choice that should adapt well to most home environments.\n";
+    } else {
+        switch (category) {
+        case PlantCategory::TREE:
+            recommendation += "It's a tree, so it's more of a long-term investment for your garden. ";
+            recommendation += advice;
+            recommendation += " Just keep in mind it'll need regular watering and plenty of space to grow.\n";
+            break;
+        case PlantCategory::FLOWERING:
+            recommendation += "This is one of our flowering plants - perfect if you want some seasonal color. ";
+            recommendation += advice;
+            recommendation += " They do best with regular watering and lots of sunlight.\n";
+            break;
+        case PlantCategory::SUCCULENT:
+            recommendation += "If you're looking for something low-maintenance, this is perfect. ";
+            recommendation += advice;
+            recommendation += " They don't need much attention and do great indoors or in sunny spots.\n";
+            break;
+        }
     }
 
     recommendation += "This particular " + plantType + " is priced at R" + 
@@ -121,7 +158,7 @@ string Staff::assistSuggestion()
         "This variety has been particularly popular with our customers lately."
     };
     
-    int commentIdx = std::rand() % expertiseComments.size();
+    int commentIdx = (int)SimulationRandom::pick(SimulationRandom::Stream::STAFF_COMMENT, expertiseComments.size());
     recommendation += expertiseComments[commentIdx] + " Would you like me to show you where we keep them?\n";
     
     return recommendation;
@@ -136,16 +173,28 @@ string Staff::assistSuggestion()
  * @param plants Pointer to the PlantGroup being purchased.
  */
 string Staff::assistPurchases(PlantGroup *basket)
+{
+    string receipt;
+    StringInfoSink sink(receipt);
+    assistPurchases(basket, sink);
+    return receipt;
+}
+
+void Staff::assistPurchases(PlantGroup *basket, InfoSink &receipt)
 {
     if (!basket)
-        return "Invalid basket provided";
+    {
+        const char *message = "Invalid basket provided";
+        receipt.write(message, std::strlen(message));
+        return;
+    }
 
-    std::ostringstream receipt;
-    receipt << "Purchase Receipt:\n";
-    receipt << basket->getInfo();
-    receipt << "Total price: " << basket->getPrice() << "\n";
+    InfoBuffer out(&receipt);
+    out.append("Purchase Receipt:\n");
+    basket->writeInfo(out);
+    out.append("Total price: ").general(basket->getPrice()).append("\n");
+    out.flush();
     delete basket;
-    return receipt.str();
 }
 
 /**
@@ -55,6 +55,18 @@ class Staff : public User, public Observer
 		 */
 		string assistPurchases(PlantGroup* plants);
 
+		/**
+		 * @brief Processes a purchase, streaming the receipt as the basket is itemised.
+		 *
+		 * Only about one InfoBuffer chunk of the receipt is held at a time, so
+		 * wholesale baskets do not need the whole receipt in memory. The basket
+		 * is deleted afterwards, as with the string version.
+		 *
+		 * @param plants Pointer to the PlantGroup being purchased.
+		 * @param receipt Destination for the receipt.
+		 */
+		void assistPurchases(PlantGroup* plants, InfoSink &receipt);
+
 		/**
 		 * @brief Receives notification that a plant needs water.
 		 * @param plant Pointer to the LivingPlant requiring water.
@@ -2,16 +2,14 @@
 #include "Staff.h"
 #include "Customer.h"
 #include "../singleton/Singleton.h"
+#include "../singleton/SimulationRandom.h"
 #include <iostream>
-#include <cstdlib>
-#include <ctime>
 
 /**
  * @brief Constructs a new SuggestionFloor mediator.
  */
 SuggestionFloor::SuggestionFloor()
 {
-    std::srand(std::time(0));
     std::cout << "SuggestionFloor: Suggestion floor mediator initialized" << std::endl;
 }
 
@@ -30,7 +28,7 @@ string SuggestionFloor::getAssistance(Customer *customer)
     }
 
     // Random staff selection
-    int randomIndex = std::rand() % staffList.size();
+    int randomIndex = (int)SimulationRandom::pick(SimulationRandom::Stream::SUGGESTION_FLOOR, staffList.size());
     Staff *availableStaff = staffList[randomIndex];
 
     // Use the existing assistSuggestion() method
@@ -0,0 +1,740 @@
+#include "InventoryJournal.h"
+#include "InventorySnapshot.h"
+#include "SnapshotFormat.h"
+#include "../singleton/Singleton.h"
+#include "../diagnostics/AllocationTracker.h"
+#include "../composite/PlantGroup.h"
+#include "../prototype/LivingPlant.h"
+#include "../mediator/Customer.h"
+#include "../mediator/Staff.h"
+#include "../state/Dead.h"
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <fstream>
+#include <iterator>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+	const char JOURNAL_MAGIC[8] = {'P', 'H', 'O', 'T', 'O', 'J', 'N', 'L'};
+	const uint32_t JOURNAL_VERSION = 1;
+	const std::size_t JOURNAL_HEADER_SIZE = sizeof(JOURNAL_MAGIC) + 2 * sizeof(uint32_t);
+	const std::size_t FRAME_HEADER_SIZE = 2 * sizeof(uint32_t);
+
+	/**
+	 * @brief Root group marker; the root's own id differs between runs without a snapshot.
+	 */
+	const uint32_t ROOT_GROUP = 0;
+
+	enum JournalOp
+	{
+		OP_ATTACH = 1,
+		OP_DETACH = 2,
+		OP_BASKET_ADD = 3,
+		OP_BASKET_REMOVE = 4,
+		OP_SALE = 5,
+		OP_STATE = 6,
+		OP_SEASON = 7,
+		OP_CUSTOMER = 8,
+		OP_STAFF = 9
+	};
+
+	enum ComponentTag
+	{
+		TAG_PLANT = 0,
+		TAG_GROUP = 1
+	};
+
+	uint32_t checksum(const char *data, std::size_t size)
+	{
+		uint32_t hash = 2166136261u;
+		for (std::size_t i = 0; i < size; i++)
+		{
+			hash ^= static_cast<unsigned char>(data[i]);
+			hash *= 16777619u;
+		}
+		return hash;
+	}
+
+	void putBytes(std::string &out, const void *data, std::size_t size)
+	{
+		out.append(static_cast<const char *>(data), size);
+	}
+
+	void putU8(std::string &out, uint8_t value)
+	{
+		putBytes(out, &value, sizeof(value));
+	}
+
+	void putU32(std::string &out, uint32_t value)
+	{
+		putBytes(out, &value, sizeof(value));
+	}
+
+	void putString(std::string &out, const std::string &value)
+	{
+		putU32(out, static_cast<uint32_t>(value.size()));
+		out.append(value);
+	}
+
+	void writeAll(int fd, const char *data, std::size_t size)
+	{
+		while (size > 0)
+		{
+			ssize_t written = write(fd, data, size);
+			if (written < 0)
+			{
+				if (errno == EINTR)
+					continue;
+				throw "Failed to write inventory journal";
+			}
+			data += written;
+			size -= static_cast<std::size_t>(written);
+		}
+	}
+
+	uint32_t parentId(PlantGroup *parent)
+	{
+		return parent == Inventory::getInstance()->getInventory() ? ROOT_GROUP : parent->getId();
+	}
+
+	void deleteComponent(PlantComponent *component)
+	{
+		PlantComponent *decorator = component->getDecorator();
+		delete (decorator ? decorator : component);
+	}
+
+	Customer *findCustomer(const std::string &name)
+	{
+		for (Customer *customer : *Inventory::getInstance()->getCustomers())
+		{
+			if (customer->getName() == name)
+				return customer;
+		}
+		return nullptr;
+	}
+}
+
+/**
+ * @brief Bounds-checked reader over one frame's payload.
+ */
+struct InventoryJournal::PayloadReader
+{
+	const char *data;
+	std::size_t size;
+	std::size_t position;
+
+	void get(void *target, std::size_t count)
+	{
+		if (size - position < count)
+			throw "Journal record is malformed";
+		std::memcpy(target, data + position, count);
+		position += count;
+	}
+
+	uint8_t u8()
+	{
+		uint8_t value;
+		get(&value, sizeof(value));
+		return value;
+	}
+
+	uint32_t u32()
+	{
+		uint32_t value;
+		get(&value, sizeof(value));
+		return value;
+	}
+
+	std::string string()
+	{
+		uint32_t length = u32();
+		if (size - position < length)
+			throw "Journal record is malformed";
+		std::string value(data + position, length);
+		position += length;
+		return value;
+	}
+};
+
+/**
+ * @brief Replay-side lookup of live inventory components by id.
+ */
+struct InventoryJournal::ComponentIndex
+{
+	std::unordered_map<uint32_t, PlantComponent *> components;
+
+	void add(PlantComponent *component)
+	{
+		components[component->getId()] = component;
+		if (component->getType() == ComponentType::PLANT_GROUP)
+		{
+			for (PlantComponent *child : *static_cast<PlantGroup *>(component)->getPlants())
+			{
+				add(child);
+			}
+		}
+	}
+
+	void remove(PlantComponent *component)
+	{
+		components.erase(component->getId());
+		if (component->getType() == ComponentType::PLANT_GROUP)
+		{
+			for (PlantComponent *child : *static_cast<PlantGroup *>(component)->getPlants())
+			{
+				remove(child);
+			}
+		}
+	}
+
+	PlantComponent *find(uint32_t id)
+	{
+		std::unordered_map<uint32_t, PlantComponent *>::iterator it = components.find(id);
+		return it == components.end() ? nullptr : it->second;
+	}
+};
+
+InventoryJournal::InventoryJournal(const std::string &path, SyncPolicy policy, std::size_t batchSize,
+								   std::chrono::milliseconds maxDelay)
+	: fd(-1), policy(policy), batchSize(batchSize > 0 ? batchSize : 1), maxDelay(maxDelay), pendingCount(0),
+	  committedSize(0)
+{
+	fd = open(path.c_str(), O_RDWR | O_CREAT | O_APPEND, 0644);
+	if (fd < 0)
+	{
+		throw "Could not open inventory journal";
+	}
+
+	struct stat info;
+	if (fstat(fd, &info) != 0)
+	{
+		close(fd);
+		throw "Could not open inventory journal";
+	}
+
+	if (info.st_size == 0)
+	{
+		std::string header(JOURNAL_MAGIC, sizeof(JOURNAL_MAGIC));
+		putU32(header, JOURNAL_VERSION);
+		putU32(header, SnapshotFormat::BYTE_ORDER_MARK);
+		try
+		{
+			writeAll(fd, header.data(), header.size());
+		}
+		catch (const char *)
+		{
+			close(fd);
+			throw;
+		}
+		if (policy != SyncPolicy::NONE)
+		{
+			fsync(fd);
+		}
+		committedSize = JOURNAL_HEADER_SIZE;
+		return;
+	}
+
+	char header[JOURNAL_HEADER_SIZE];
+	uint32_t version = 0;
+	uint32_t byteOrder = 0;
+	if (info.st_size < (off_t)JOURNAL_HEADER_SIZE || pread(fd, header, sizeof(header), 0) != (ssize_t)sizeof(header))
+	{
+		close(fd);
+		throw "Not an inventory journal";
+	}
+	std::memcpy(&version, header + sizeof(JOURNAL_MAGIC), sizeof(version));
+	std::memcpy(&byteOrder, header + sizeof(JOURNAL_MAGIC) + sizeof(version), sizeof(byteOrder));
+	if (std::memcmp(header, JOURNAL_MAGIC, sizeof(JOURNAL_MAGIC)) != 0 || version != JOURNAL_VERSION ||
+		byteOrder != SnapshotFormat::BYTE_ORDER_MARK)
+	{
+		close(fd);
+		throw "Not an inventory journal";
+	}
+	committedSize = info.st_size;
+}
+
+InventoryJournal::~InventoryJournal()
+{
+	try
+	{
+		commit();
+	}
+	catch (const char *)
+	{
+		// Nothing more can be done for records that failed to reach the file
+	}
+	close(fd);
+}
+
+void InventoryJournal::append(const std::string &payload)
+{
+	AllocationTracker::TagScope tag(AllocationTracker::Tag::JOURNAL);
+	std::lock_guard<std::mutex> guard(lock);
+
+	std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+	if (pending.empty())
+	{
+		pendingSince = now;
+	}
+	putU32(pending, static_cast<uint32_t>(payload.size()));
+	putU32(pending, checksum(payload.data(), payload.size()));
+	pending.append(payload);
+	pendingCount++;
+
+	if (policy == SyncPolicy::EVERY_RECORD || pendingCount >= batchSize || now - pendingSince >= maxDelay)
+	{
+		writePending();
+	}
+}
+
+void InventoryJournal::writePending()
+{
+	if (pending.empty())
+	{
+		return;
+	}
+
+	try
+	{
+		writeAll(fd, pending.data(), pending.size());
+	}
+	catch (const char *)
+	{
+		// Drop the partial frame; the whole batch stays pending and is written again
+		if (ftruncate(fd, committedSize) != 0)
+		{
+			throw "Failed to write inventory journal and could not remove the partial record";
+		}
+		throw;
+	}
+	committedSize += static_cast<off_t>(pending.size());
+	pending.clear();
+	pendingCount = 0;
+
+	if (policy != SyncPolicy::NONE && fsync(fd) != 0)
+	{
+		throw "Failed to sync inventory journal";
+	}
+}
+
+void InventoryJournal::commit()
+{
+	std::lock_guard<std::mutex> guard(lock);
+	writePending();
+}
+
+void InventoryJournal::commitIfDue()
+{
+	std::lock_guard<std::mutex> guard(lock);
+	if (!pending.empty() && std::chrono::steady_clock::now() - pendingSince >= maxDelay)
+	{
+		writePending();
+	}
+}
+
+void InventoryJournal::checkpoint(const std::string &snapshotPath)
+{
+	// Held across the save: a record made meanwhile would otherwise be truncated away
+	std::lock_guard<std::mutex> guard(lock);
+	InventorySnapshot::saveToFile(snapshotPath);
+
+	// The snapshot must be durable before the records it replaces are dropped
+	int snapshot = open(snapshotPath.c_str(), O_RDONLY);
+	if (snapshot < 0 || fsync(snapshot) != 0)
+	{
+		if (snapshot >= 0)
+			close(snapshot);
+		throw "Could not sync snapshot for journal checkpoint";
+	}
+	close(snapshot);
+
+	pending.clear();
+	pendingCount = 0;
+	if (ftruncate(fd, JOURNAL_HEADER_SIZE) != 0)
+	{
+		throw "Failed to truncate inventory journal";
+	}
+	committedSize = JOURNAL_HEADER_SIZE;
+	if (policy != SyncPolicy::NONE)
+	{
+		fsync(fd);
+	}
+}
+
+std::size_t InventoryJournal::getPendingCount()
+{
+	std::lock_guard<std::mutex> guard(lock);
+	return pendingCount;
+}
+
+InventoryJournal::SyncPolicy InventoryJournal::getSyncPolicy() const
+{
+	return policy;
+}
+
+void InventoryJournal::describe(std::string &out, PlantComponent *component, const InventorySnapshot::FlyweightIds &ids)
+{
+	if (component->getType() == ComponentType::PLANT_GROUP)
+	{
+		PlantGroup *group = static_cast<PlantGroup *>(component);
+		putU8(out, TAG_GROUP);
+		putU32(out, group->getId());
+		putString(out, group->getGroupName());
+		putU32(out, static_cast<uint32_t>(group->getPlants()->size()));
+		for (PlantComponent *child : *group->getPlants())
+		{
+			describe(out, child, ids);
+		}
+		return;
+	}
+
+	if (component->getType() != ComponentType::LIVING_PLANT)
+	{
+		throw "Unsupported component in inventory journal";
+	}
+
+	LivingPlant *plant = static_cast<LivingPlant *>(component);
+	SnapshotFormat::PlantRecord record = InventorySnapshot::describePlant(plant, ids);
+	std::vector<std::string> decorators;
+	InventorySnapshot::decoratorNames(plant, decorators);
+
+	putU8(out, TAG_PLANT);
+	putBytes(out, &record, sizeof(record));
+	putString(out, plant->getNameView());
+	putU8(out, plant->getSeason() != nullptr);
+	if (plant->getSeason() != nullptr)
+	{
+		putString(out, *plant->getSeason()->getState());
+	}
+	for (const std::string &name : decorators)
+	{
+		putString(out, name);
+	}
+}
+
+void InventoryJournal::recordAttach(PlantComponent *component, PlantGroup *parent)
+{
+	AllocationTracker::TagScope tag(AllocationTracker::Tag::JOURNAL);
+	std::string payload;
+	putU8(payload, OP_ATTACH);
+	putU32(payload, parentId(parent));
+	describe(payload, component, InventorySnapshot::FlyweightIds());
+	append(payload);
+}
+
+void InventoryJournal::recordDetach(PlantComponent *component)
+{
+	std::string payload;
+	putU8(payload, OP_DETACH);
+	putU32(payload, component->getId());
+	append(payload);
+}
+
+void InventoryJournal::recordBasketAdd(Customer *customer, PlantComponent *component)
+{
+	std::string payload;
+	putU8(payload, OP_BASKET_ADD);
+	putString(payload, customer->getName());
+	putU32(payload, component->getId());
+	append(payload);
+}
+
+void InventoryJournal::recordBasketRemove(Customer *customer, PlantComponent *component)
+{
+	std::string payload;
+	putU8(payload, OP_BASKET_REMOVE);
+	putString(payload, customer->getName());
+	putU32(payload, component->getId());
+	append(payload);
+}
+
+void InventoryJournal::recordSale(Customer *customer)
+{
+	std::string payload;
+	putU8(payload, OP_SALE);
+	putString(payload, customer->getName());
+	append(payload);
+}
+
+void InventoryJournal::recordStateChange(LivingPlant *plant, int stateId)
+{
+	std::string payload;
+	putU8(payload, OP_STATE);
+	putU32(payload, plant->getId());
+	putU8(payload, static_cast<uint8_t>(stateId));
+	append(payload);
+}
+
+void InventoryJournal::recordSeasonChange(const std::string &season)
+{
+	std::string payload;
+	putU8(payload, OP_SEASON);
+	putString(payload, season);
+	append(payload);
+}
+
+void InventoryJournal::recordCustomer(Customer *customer)
+{
+	std::string payload;
+	putU8(payload, OP_CUSTOMER);
+	putString(payload, customer->getName());
+	append(payload);
+}
+
+void InventoryJournal::recordStaff(Staff *staff)
+{
+	std::string payload;
+	putU8(payload, OP_STAFF);
+	putString(payload, staff->getName());
+	append(payload);
+}
+
+PlantComponent *InventoryJournal::build(PayloadReader &reader)
+{
+	Inventory *inv = Inventory::getInstance();
+	uint8_t tag = reader.u8();
+
+	if (tag == TAG_GROUP)
+	{
+		uint32_t id = reader.u32();
+		std::string name = reader.string();
+		uint32_t childCount = reader.u32();
+
+		PlantGroup *group = new PlantGroup(name);
+		try
+		{
+			for (uint32_t c = 0; c < childCount; c++)
+			{
+				group->addComponent(build(reader));
+			}
+		}
+		catch (const char *)
+		{
+			delete group;
+			throw;
+		}
+		InventorySnapshot::assignId(group, id);
+		return group;
+	}
+
+	if (tag != TAG_PLANT)
+	{
+		throw "Journal record is malformed";
+	}
+
+	SnapshotFormat::PlantRecord record;
+	reader.get(&record, sizeof(record));
+	std::string name = reader.string();
+	bool hasSeason = reader.u8() != 0;
+	std::string season = hasSeason ? reader.string() : std::string();
+
+	// Strings travel inline, so check the record against a one-string table
+	SnapshotFormat::Header limits;
+	std::memset(&limits, 0, sizeof(limits));
+	limits.stringCount = 1;
+	limits.decoratorCount = record.decoratorCount;
+	record.name = 0;
+	record.season = SnapshotFormat::NONE;
+	record.firstDecorator = 0;
+	if (!InventorySnapshot::isValidPlantRecord(record, limits))
+	{
+		throw "Journal record is malformed";
+	}
+
+	std::vector<PlantComponent *> chain;
+	try
+	{
+		for (uint32_t d = 0; d < record.decoratorCount; d++)
+		{
+			PlantComponent *decorator = InventorySnapshot::createDecorator(reader.string());
+			if (decorator == nullptr)
+				throw "Unknown decorator in inventory journal";
+			chain.push_back(decorator);
+		}
+	}
+	catch (const char *)
+	{
+		for (PlantComponent *created : chain)
+			delete created;
+		throw;
+	}
+
+	return InventorySnapshot::createPlant(record, inv->getString(name),
+										  hasSeason ? inv->getString(season) : nullptr, chain);
+}
+
+bool InventoryJournal::apply(PayloadReader &reader, ComponentIndex &index)
+{
+	Inventory *inv = Inventory::getInstance();
+	PlantGroup *root = inv->getInventory();
+
+	switch (reader.u8())
+	{
+	case OP_ATTACH:
+	{
+		uint32_t parent = reader.u32();
+		PlantComponent *component = build(reader);
+		PlantComponent *group = parent == ROOT_GROUP ? root : index.find(parent);
+		// Contents of a group that was never attached arrive again with the group itself
+		if (group == nullptr || group->getType() != ComponentType::PLANT_GROUP)
+		{
+			deleteComponent(component);
+			return false;
+		}
+		static_cast<PlantGroup *>(group)->addComponent(component);
+		index.add(component);
+		return true;
+	}
+	case OP_DETACH:
+	{
+		PlantComponent *component = index.find(reader.u32());
+		if (component == nullptr || !root->removeComponent(component))
+			return false;
+		index.remove(component);
+		deleteComponent(component);
+		return true;
+	}
+	case OP_BASKET_ADD:
+	{
+		Customer *customer = findCustomer(reader.string());
+		PlantComponent *component = index.find(reader.u32());
+		if (customer == nullptr || component == nullptr || !root->removeComponent(component))
+			return false;
+		index.remove(component);
+		customer->addPlant(component);
+		return true;
+	}
+	case OP_BASKET_REMOVE:
+	{
+		Customer *customer = findCustomer(reader.string());
+		uint32_t id = reader.u32();
+		if (customer == nullptr || customer->getBasket() == nullptr)
+			return false;
+		for (PlantComponent *component : *customer->getBasket()->getPlants())
+		{
+			if (component->getId() == id)
+			{
+				customer->getBasket()->removeComponent(component);
+				root->addComponent(component);
+				index.add(component);
+				return true;
+			}
+		}
+		return false;
+	}
+	case OP_SALE:
+	{
+		Customer *customer = findCustomer(reader.string());
+		if (customer == nullptr || customer->getBasket() == nullptr)
+			return false;
+		customer->clearBasket();
+		return true;
+	}
+	case OP_STATE:
+	{
+		PlantComponent *component = index.find(reader.u32());
+		uint8_t state = reader.u8();
+		if (state > Dead::getID())
+			throw "Journal record is malformed";
+		if (component == nullptr || component->getType() != ComponentType::LIVING_PLANT)
+			return false;
+		static_cast<LivingPlant *>(component)->setMaturity(state);
+		return true;
+	}
+	case OP_SEASON:
+		inv->currentSeason = inv->getString(reader.string());
+		return true;
+	case OP_CUSTOMER:
+	{
+		std::string name = reader.string();
+		if (findCustomer(name) != nullptr)
+			return false;
+		inv->addCustomer(new Customer(name));
+		return true;
+	}
+	case OP_STAFF:
+	{
+		std::string name = reader.string();
+		for (Staff *staff : *inv->getStaff())
+		{
+			if (staff->getName() == name)
+				return false;
+		}
+		inv->addStaff(new Staff(name));
+		return true;
+	}
+	default:
+		throw "Journal record is malformed";
+	}
+}
+
+std::size_t InventoryJournal::replay(const std::string &path)
+{
+	std::ifstream in(path.c_str(), std::ios::binary);
+	if (!in)
+	{
+		return 0;
+	}
+	std::vector<char> data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+
+	uint32_t version = 0;
+	uint32_t byteOrder = 0;
+	if (data.size() < JOURNAL_HEADER_SIZE || std::memcmp(data.data(), JOURNAL_MAGIC, sizeof(JOURNAL_MAGIC)) != 0)
+	{
+		throw "Not an inventory journal";
+	}
+	std::memcpy(&version, data.data() + sizeof(JOURNAL_MAGIC), sizeof(version));
+	std::memcpy(&byteOrder, data.data() + sizeof(JOURNAL_MAGIC) + sizeof(version), sizeof(byteOrder));
+	if (version != JOURNAL_VERSION || byteOrder != SnapshotFormat::BYTE_ORDER_MARK)
+	{
+		throw "Not an inventory journal";
+	}
+
+	Inventory *inv = Inventory::getInstance();
+	ComponentIndex index;
+	index.add(inv->getInventory());
+
+	// Replayed transitions must not be journalled again
+	InventoryJournal *active = inv->getJournal();
+	inv->setJournal(nullptr);
+
+	std::size_t applied = 0;
+	std::size_t position = JOURNAL_HEADER_SIZE;
+	try
+	{
+		while (data.size() - position >= FRAME_HEADER_SIZE)
+		{
+			uint32_t length;
+			uint32_t sum;
+			std::memcpy(&length, data.data() + position, sizeof(length));
+			std::memcpy(&sum, data.data() + position + sizeof(length), sizeof(sum));
+			const char *payload = data.data() + position + FRAME_HEADER_SIZE;
+
+			// A torn or corrupt frame marks the end of what reached the disk
+			if (data.size() - position - FRAME_HEADER_SIZE < length || checksum(payload, length) != sum)
+			{
+				break;
+			}
+
+			PayloadReader reader = {payload, length, 0};
+			if (apply(reader, index))
+			{
+				applied++;
+			}
+			position += FRAME_HEADER_SIZE + length;
+		}
+	}
+	catch (const char *)
+	{
+		inv->setJournal(active);
+		throw;
+	}
+
+	inv->setJournal(active);
+	return applied;
+}
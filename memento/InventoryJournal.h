@@ -0,0 +1,213 @@
+#ifndef PHOTOSYNTECH_INVENTORYJOURNAL_H
+#define PHOTOSYNTECH_INVENTORYJOURNAL_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <sys/types.h>
+#include "InventorySnapshot.h"
+
+class PlantComponent;
+class PlantGroup;
+class LivingPlant;
+class Customer;
+class Staff;
+
+/**
+ * @brief Append-only write-ahead journal of Inventory mutations.
+ *
+ * Records every change made since the last InventorySnapshot so the nursery can
+ * be recovered after a crash: restore the snapshot, then replay() the journal.
+ *
+ * **System Role:**
+ * Durability layer between snapshots. NurseryFacade records plant creation,
+ * moves, removals, basket changes, sales and new users; plants record their
+ * maturity transitions and the ticker records season changes through
+ * Inventory::getJournal().
+ *
+ * **Pattern Role:** Command log for the Memento (incremental mementos)
+ *
+ * **Related Patterns:**
+ * - Memento: Replayed on top of an InventorySnapshot
+ * - Singleton: The Inventory exposes the active journal to plants and the ticker
+ * - Facade: NurseryFacade owns the journal and records user-level operations
+ *
+ * **Group commit:**
+ * Records are buffered and written with one write() per batch. commit() flushes
+ * the batch early, and a batch older than the maximum delay is written by the
+ * next record or by commitIfDue(), which the ticker calls every tick. A write
+ * that fails partway is truncated away so no torn frame is left before the
+ * retry. The SyncPolicy controls when the file is fsync'ed:
+ * - NONE: never (the OS decides; fastest, a crash may lose recent batches)
+ * - BATCH: once per committed batch
+ * - EVERY_RECORD: each record is committed and synced before record*() returns
+ *
+ * **Format:** "PHOTOJNL" magic, version and byte-order marker, then frames of
+ * [payload length, FNV-1a checksum, payload]. Replay stops at the first torn
+ * or corrupt frame, which is what a crash in the middle of a write leaves.
+ *
+ * Components are identified by PlantComponent::getId(), customers and staff by
+ * name. A component attached to a group is recorded with its full contents, so
+ * a move is a detach followed by an attach.
+ *
+ * @see InventorySnapshot (checkpoint the journal replays on top of)
+ * @see NurseryFacade::enableJournal()
+ */
+class InventoryJournal
+{
+	public:
+		/**
+		 * @brief When committed batches are forced to stable storage.
+		 */
+		enum class SyncPolicy
+		{
+			NONE,		 ///< Leave flushing to the operating system
+			BATCH,		 ///< fsync once per committed batch
+			EVERY_RECORD ///< Commit and fsync every record
+		};
+
+		/**
+		 * @brief Opens (or creates) a journal file for appending.
+		 * @param path Journal file.
+		 * @param policy Durability policy.
+		 * @param batchSize Records buffered before an automatic commit.
+		 * @param maxDelay Longest a buffered record waits before an automatic commit.
+		 * @throws const char* if the file cannot be opened or is not a journal.
+		 */
+		InventoryJournal(const std::string &path, SyncPolicy policy = SyncPolicy::BATCH, std::size_t batchSize = 64,
+						 std::chrono::milliseconds maxDelay = std::chrono::milliseconds(1000));
+
+		/**
+		 * @brief Commits any buffered records and closes the file.
+		 */
+		~InventoryJournal();
+
+		/**
+		 * @brief Records a component (and its contents) being added to a group.
+		 */
+		void recordAttach(PlantComponent *component, PlantGroup *parent);
+
+		/**
+		 * @brief Records a component being removed from the inventory tree.
+		 */
+		void recordDetach(PlantComponent *component);
+
+		/**
+		 * @brief Records a plant moving from the inventory into a customer's basket.
+		 */
+		void recordBasketAdd(Customer *customer, PlantComponent *component);
+
+		/**
+		 * @brief Records a plant moving from a customer's basket back into the inventory.
+		 */
+		void recordBasketRemove(Customer *customer, PlantComponent *component);
+
+		/**
+		 * @brief Records a completed sale (the customer's basket is gone).
+		 */
+		void recordSale(Customer *customer);
+
+		/**
+		 * @brief Records a plant's maturity state transition.
+		 */
+		void recordStateChange(LivingPlant *plant, int stateId);
+
+		/**
+		 * @brief Records the new current season.
+		 */
+		void recordSeasonChange(const std::string &season);
+
+		/**
+		 * @brief Records a new customer.
+		 */
+		void recordCustomer(Customer *customer);
+
+		/**
+		 * @brief Records a new staff member.
+		 */
+		void recordStaff(Staff *staff);
+
+		/**
+		 * @brief Writes buffered records now, syncing according to the policy.
+		 * @throws const char* if writing fails.
+		 */
+		void commit();
+
+		/**
+		 * @brief Commits the buffered records if the oldest has waited longer than the maximum delay.
+		 * @throws const char* if writing fails.
+		 */
+		void commitIfDue();
+
+		/**
+		 * @brief Saves a snapshot and empties the journal it replaces.
+		 *
+		 * Records from other threads wait while the snapshot is written, so
+		 * every record made after it stays in the journal.
+		 * @param snapshotPath Snapshot file; it is synced before the journal is truncated.
+		 * @throws const char* if the snapshot cannot be saved or the journal truncated.
+		 */
+		void checkpoint(const std::string &snapshotPath);
+
+		/**
+		 * @brief Gets the number of records buffered but not yet committed.
+		 */
+		std::size_t getPendingCount();
+
+		/**
+		 * @brief Gets the durability policy.
+		 */
+		SyncPolicy getSyncPolicy() const;
+
+		/**
+		 * @brief Applies a journal to the current Inventory.
+		 *
+		 * Records referring to components, groups or customers that no longer exist
+		 * are skipped. Replay stops at a torn final frame.
+		 *
+		 * @param path Journal file; a missing file replays nothing.
+		 * @return Number of records applied.
+		 * @throws const char* if the file is not a journal or a complete frame is malformed.
+		 */
+		static std::size_t replay(const std::string &path);
+
+	private:
+		InventoryJournal(const InventoryJournal &);
+		InventoryJournal &operator=(const InventoryJournal &);
+
+		struct PayloadReader;
+		struct ComponentIndex;
+
+		void append(const std::string &payload);
+		void writePending();
+
+		/**
+		 * @brief Serialises a plant or a group with all of its contents.
+		 */
+		static void describe(std::string &out, PlantComponent *component, const InventorySnapshot::FlyweightIds &ids);
+
+		/**
+		 * @brief Rebuilds a component serialised by describe().
+		 */
+		static PlantComponent *build(PayloadReader &reader);
+
+		/**
+		 * @brief Applies one record during replay.
+		 * @return False if the record referred to something that no longer exists.
+		 */
+		static bool apply(PayloadReader &reader, ComponentIndex &index);
+
+		int fd;
+		SyncPolicy policy;
+		std::size_t batchSize;
+		std::chrono::milliseconds maxDelay;
+		std::string pending;
+		std::size_t pendingCount;
+		std::chrono::steady_clock::time_point pendingSince; ///< When the oldest pending record was made
+		off_t committedSize;								///< File size after the last complete write
+		std::mutex lock;
+};
+
+#endif //PHOTOSYNTECH_INVENTORYJOURNAL_H
@@ -0,0 +1,868 @@
+#include "InventorySnapshot.h"
+#include "SnapshotFormat.h"
+#include "MappedSnapshot.h"
+#include "../singleton/Singleton.h"
+#include "../diagnostics/AllocationTracker.h"
+#include "../composite/PlantGroup.h"
+#include "../prototype/LivingPlant.h"
+#include "../prototype/Herb.h"
+#include "../prototype/Shrub.h"
+#include "../prototype/Succulent.h"
+#include "../prototype/Tree.h"
+#include "../decorator/PlantAttributes.h"
+#include "../decorator/plantDecorator/PlantAttributesHeader.h"
+#include "../decorator/customerDecorator/PlantDecorationHeader.h"
+#include "../state/Seed.h"
+#include "../state/Vegetative.h"
+#include "../state/Mature.h"
+#include "../state/Dead.h"
+#include "../mediator/Staff.h"
+#include "../mediator/Customer.h"
+#include <cstring>
+#include <fstream>
+#include <istream>
+#include <iterator>
+#include <ostream>
+#include <unordered_map>
+#include <vector>
+
+using namespace SnapshotFormat;
+
+namespace
+{
+	typedef PlantComponent *(*DecoratorFactory)();
+
+	template <typename T>
+	PlantComponent *makeDecorator()
+	{
+		return new T();
+	}
+
+	/**
+	 * @brief Maps attribute display names to factories.
+	 *
+	 * Built once from the decorators themselves so the names stay in one place
+	 * (their constructors).
+	 */
+	const std::unordered_map<std::string, DecoratorFactory> &decoratorFactories()
+	{
+		static std::unordered_map<std::string, DecoratorFactory> factories;
+		if (factories.empty())
+		{
+			DecoratorFactory all[] = {
+				&makeDecorator<Autumn>, &makeDecorator<Spring>, &makeDecorator<Summer>, &makeDecorator<Winter>,
+				&makeDecorator<LargeFlowers>, &makeDecorator<LargeLeaf>, &makeDecorator<LargeStem>,
+				&makeDecorator<SmallFlowers>, &makeDecorator<SmallLeaf>, &makeDecorator<SmallStem>,
+				&makeDecorator<Thorns>, &makeDecorator<LargePot>, &makeDecorator<PlantCharm>,
+				&makeDecorator<RedPot>, &makeDecorator<ShopThemedCharm>};
+
+			for (DecoratorFactory factory : all)
+			{
+				PlantComponent *sample = factory();
+				factories[sample->getName()] = factory;
+				delete sample;
+			}
+		}
+		return factories;
+	}
+
+	uint64_t alignTo8(uint64_t offset)
+	{
+		return (offset + 7) & ~static_cast<uint64_t>(7);
+	}
+
+	void writeBytes(std::ostream &out, const void *data, std::size_t size)
+	{
+		out.write(static_cast<const char *>(data), static_cast<std::streamsize>(size));
+		if (!out)
+		{
+			throw "Failed to write inventory snapshot";
+		}
+	}
+
+	void writeU32(std::ostream &out, uint32_t value)
+	{
+		writeBytes(out, &value, sizeof(value));
+	}
+
+	void writePadding(std::ostream &out, uint64_t &position, uint64_t target)
+	{
+		static const char zeros[8] = {0};
+		writeBytes(out, zeros, static_cast<std::size_t>(target - position));
+		position = target;
+	}
+
+	/**
+	 * @brief Checks that count records of recordSize fit at offset inside size bytes.
+	 */
+	bool sectionFits(uint64_t offset, uint64_t count, uint64_t recordSize, uint64_t size)
+	{
+		return offset <= size && count <= (size - offset) / recordSize;
+	}
+
+	template <typename T>
+	T readRecord(const char *data, uint64_t offset, uint64_t index)
+	{
+		T record;
+		std::memcpy(&record, data + offset + index * sizeof(T), sizeof(T));
+		return record;
+	}
+
+	bool validString(uint32_t id, uint32_t stringCount)
+	{
+		return id < stringCount;
+	}
+
+	bool validOptionalString(uint32_t id, uint32_t stringCount)
+	{
+		return id == NONE || id < stringCount;
+	}
+}
+
+struct InventorySnapshot::SaveContext
+{
+	Inventory *inventory;
+
+	std::vector<std::string> strings;
+	std::unordered_map<std::string, uint32_t> stringIds;
+	std::unordered_map<const void *, uint32_t> flyweightIds;
+
+	std::vector<PlantGroup *> groups;
+	std::unordered_map<PlantGroup *, uint32_t> groupIds;
+	std::vector<uint32_t> plantBase;
+
+	FlyweightIds strategyIds;
+	std::unordered_map<const Observer *, uint32_t> staffIds;
+
+	uint32_t plantCount = 0;
+	uint32_t decoratorCount = 0;
+	uint32_t childCount = 0;
+	uint32_t observerCount = 0;
+
+	uint32_t intern(const std::string &value)
+	{
+		std::unordered_map<std::string, uint32_t>::iterator it = stringIds.find(value);
+		if (it != stringIds.end())
+		{
+			return it->second;
+		}
+		uint32_t id = static_cast<uint32_t>(strings.size());
+		strings.push_back(value);
+		stringIds[value] = id;
+		return id;
+	}
+
+	uint32_t intern(Flyweight<std::string *> *fly)
+	{
+		if (fly == nullptr)
+		{
+			return NONE;
+		}
+		std::unordered_map<const void *, uint32_t>::iterator it = flyweightIds.find(fly);
+		if (it != flyweightIds.end())
+		{
+			return it->second;
+		}
+		uint32_t id = intern(*fly->getState());
+		flyweightIds[fly] = id;
+		return id;
+	}
+
+	uint32_t observersOf(PlantGroup *group)
+	{
+		uint32_t count = 0;
+		for (Observer *observer : group->getObservers())
+		{
+			count += staffIds.count(observer) ? 1 : 0;
+		}
+		return count;
+	}
+};
+
+InventorySnapshot::FlyweightIds::FlyweightIds()
+{
+	Inventory *inv = Inventory::getInstance();
+	for (int id : {Seed::getID(), Vegetative::getID(), Mature::getID(), Dead::getID()})
+	{
+		maturity[inv->getStates(id)] = static_cast<uint8_t>(id);
+	}
+	for (int id : {LowWater::getID(), MidWater::getID(), HighWater::getID(), AlternatingWater::getID()})
+	{
+		water[inv->getWaterFly(id)] = static_cast<uint8_t>(id);
+	}
+	for (int id : {LowSun::getID(), MidSun::getID(), HighSun::getID(), AlternatingSun::getID()})
+	{
+		sun[inv->getSunFly(id)] = static_cast<uint8_t>(id);
+	}
+}
+
+uint8_t InventorySnapshot::FlyweightIds::find(const std::unordered_map<const void *, uint8_t> &ids, const void *fly, const char *error)
+{
+	if (fly == nullptr)
+	{
+		return NO_ID;
+	}
+	std::unordered_map<const void *, uint8_t>::const_iterator it = ids.find(fly);
+	if (it == ids.end())
+	{
+		throw error;
+	}
+	return it->second;
+}
+
+PlantRecord InventorySnapshot::describePlant(LivingPlant *plant, const FlyweightIds &ids)
+{
+	PlantRecord record;
+	std::memset(&record, 0, sizeof(record));
+	record.price = plant->price;
+	record.name = NONE;
+	record.season = NONE;
+	record.age = plant->age;
+	record.health = plant->health;
+	record.waterLevel = plant->waterLevel;
+	record.sunExposure = plant->sunExposure;
+	record.affectWater = plant->affectWaterValue;
+	record.affectSun = plant->affectSunValue;
+	record.maturity = FlyweightIds::find(ids.maturity, plant->getMaturity(), "Unknown maturity state in inventory snapshot");
+	record.waterStrategy = FlyweightIds::find(ids.water, plant->getWaterStrategy(), "Unknown water strategy in inventory snapshot");
+	record.sunStrategy = FlyweightIds::find(ids.sun, plant->getSunStrategy(), "Unknown sun strategy in inventory snapshot");
+	record.id = plant->id;
+
+	if (dynamic_cast<Herb *>(plant))
+		record.kind = KIND_HERB;
+	else if (dynamic_cast<Shrub *>(plant))
+		record.kind = KIND_SHRUB;
+	else if (dynamic_cast<Succulent *>(plant))
+		record.kind = KIND_SUCCULENT;
+	else if (dynamic_cast<Tree *>(plant))
+		record.kind = KIND_TREE;
+	else
+		record.kind = KIND_LIVING_PLANT;
+
+	for (PlantComponent *c = plant->decorator; c != nullptr && c != plant;
+		 c = static_cast<PlantAttributes *>(c)->nextComponent)
+	{
+		record.decoratorCount += static_cast<uint32_t>(static_cast<PlantAttributes *>(c)->getAttributeCount());
+	}
+	return record;
+}
+
+void InventorySnapshot::assignId(PlantComponent *component, uint32_t id)
+{
+	if (id != 0)
+	{
+		component->id = id;
+		PlantComponent::reserveIds(id);
+	}
+}
+
+void InventorySnapshot::decoratorNames(LivingPlant *plant, std::vector<std::string> &names)
+{
+	for (PlantComponent *c = plant->decorator; c != nullptr && c != plant;
+		 c = static_cast<PlantAttributes *>(c)->nextComponent)
+	{
+		PlantAttributes *attribute = static_cast<PlantAttributes *>(c);
+		for (std::size_t a = 0; a < attribute->getAttributeCount(); a++)
+			names.push_back(*attribute->getAttribute(a).name->getState());
+	}
+}
+
+PlantComponent *InventorySnapshot::createDecorator(const std::string &name)
+{
+	const std::unordered_map<std::string, DecoratorFactory> &factories = decoratorFactories();
+	std::unordered_map<std::string, DecoratorFactory>::const_iterator it = factories.find(name);
+	return it == factories.end() ? nullptr : it->second();
+}
+
+void InventorySnapshot::collect(SaveContext &context)
+{
+	Inventory *inv = context.inventory;
+
+	std::vector<Staff *> &staff = *inv->staffList;
+	for (std::size_t i = 0; i < staff.size(); i++)
+	{
+		context.staffIds[staff[i]] = static_cast<uint32_t>(i);
+		context.intern(staff[i]->getName());
+	}
+
+	// Group 0 is the inventory root; customer baskets follow as extra roots
+	collectGroup(context, inv->inventory);
+	for (Customer *customer : *inv->customerList)
+	{
+		context.intern(customer->getName());
+		if (customer->basket != nullptr)
+		{
+			collectGroup(context, customer->basket);
+		}
+	}
+
+	context.intern(inv->currentSeason);
+}
+
+void InventorySnapshot::collectGroup(SaveContext &context, PlantGroup *group)
+{
+	if (context.groupIds.count(group))
+	{
+		throw "PlantGroup appears more than once in the inventory";
+	}
+
+	context.groupIds[group] = static_cast<uint32_t>(context.groups.size());
+	context.groups.push_back(group);
+	context.plantBase.push_back(context.plantCount);
+	context.intern(group->getGroupName());
+	context.observerCount += context.observersOf(group);
+
+	std::list<PlantComponent *> &children = *group->getPlants();
+	context.childCount += static_cast<uint32_t>(children.size());
+
+	// Direct plants first so they get consecutive indices, then subgroups in pre-order
+	for (PlantComponent *child : children)
+	{
+		if (child->getType() == ComponentType::LIVING_PLANT)
+		{
+			collectPlant(context, static_cast<LivingPlant *>(child));
+		}
+		else if (child->getType() != ComponentType::PLANT_GROUP)
+		{
+			throw "Unsupported component in inventory snapshot";
+		}
+	}
+	for (PlantComponent *child : children)
+	{
+		if (child->getType() == ComponentType::PLANT_GROUP)
+		{
+			collectGroup(context, static_cast<PlantGroup *>(child));
+		}
+	}
+}
+
+void InventorySnapshot::collectPlant(SaveContext &context, LivingPlant *plant)
+{
+	context.plantCount++;
+	context.intern(plant->getNameFlyweight());
+	context.intern(plant->getSeason());
+
+	PlantComponent *component = plant->decorator;
+	while (component != nullptr && component != plant)
+	{
+		if (component->getType() != ComponentType::PLANT_COMPONENT)
+		{
+			throw "Unsupported decorator chain in inventory snapshot";
+		}
+		PlantAttributes *attribute = static_cast<PlantAttributes *>(component);
+		for (std::size_t a = 0; a < attribute->getAttributeCount(); a++)
+		{
+			context.intern(attribute->getAttribute(a).name);
+			context.decoratorCount++;
+		}
+		component = attribute->nextComponent;
+	}
+}
+
+void InventorySnapshot::save(std::ostream &out)
+{
+	AllocationTracker::TagScope tag(AllocationTracker::Tag::SNAPSHOT);
+	SaveContext context;
+	context.inventory = Inventory::getInstance();
+	collect(context);
+
+	std::vector<Staff *> &staff = *context.inventory->staffList;
+	std::vector<Customer *> &customers = *context.inventory->customerList;
+
+	// Every section size is known after the first pass, so offsets are fixed up front
+	Header header;
+	std::memset(&header, 0, sizeof(header));
+	std::memcpy(header.magic, MAGIC, sizeof(header.magic));
+	header.version = VERSION;
+	header.byteOrder = BYTE_ORDER_MARK;
+	header.stringCount = static_cast<uint32_t>(context.strings.size());
+	header.plantCount = context.plantCount;
+	header.decoratorCount = context.decoratorCount;
+	header.groupCount = static_cast<uint32_t>(context.groups.size());
+	header.childCount = context.childCount;
+	header.observerCount = context.observerCount;
+	header.staffCount = static_cast<uint32_t>(staff.size());
+	header.customerCount = static_cast<uint32_t>(customers.size());
+	header.currentSeason = context.intern(context.inventory->currentSeason);
+
+	uint64_t stringBytes = 0;
+	for (const std::string &value : context.strings)
+	{
+		stringBytes += sizeof(uint32_t) + value.size();
+	}
+
+	header.stringsOffset = sizeof(Header);
+	header.plantsOffset = alignTo8(header.stringsOffset + stringBytes);
+	header.decoratorsOffset = header.plantsOffset + sizeof(PlantRecord) * (uint64_t)header.plantCount;
+	header.groupsOffset = alignTo8(header.decoratorsOffset + sizeof(uint32_t) * (uint64_t)header.decoratorCount);
+	header.childrenOffset = header.groupsOffset + sizeof(GroupRecord) * (uint64_t)header.groupCount;
+	header.observersOffset = header.childrenOffset + sizeof(uint32_t) * (uint64_t)header.childCount;
+	header.staffOffset = header.observersOffset + sizeof(uint32_t) * (uint64_t)header.observerCount;
+	header.customersOffset = header.staffOffset + sizeof(uint32_t) * (uint64_t)header.staffCount;
+	header.totalSize = header.customersOffset + sizeof(CustomerRecord) * (uint64_t)header.customerCount;
+
+	writeBytes(out, &header, sizeof(header));
+	uint64_t position = sizeof(header);
+
+	for (const std::string &value : context.strings)
+	{
+		writeU32(out, static_cast<uint32_t>(value.size()));
+		writeBytes(out, value.data(), value.size());
+		position += sizeof(uint32_t) + value.size();
+	}
+	writePadding(out, position, header.plantsOffset);
+
+	// Plants, in group order, direct children only (matches collectGroup numbering)
+	uint32_t nextDecorator = 0;
+	for (PlantGroup *group : context.groups)
+	{
+		for (PlantComponent *child : *group->getPlants())
+		{
+			if (child->getType() != ComponentType::LIVING_PLANT)
+			{
+				continue;
+			}
+			LivingPlant *plant = static_cast<LivingPlant *>(child);
+
+			PlantRecord record = describePlant(plant, context.strategyIds);
+			record.name = context.intern(plant->getNameFlyweight());
+			record.season = context.intern(plant->getSeason());
+			record.firstDecorator = nextDecorator;
+			nextDecorator += record.decoratorCount;
+
+			writeBytes(out, &record, sizeof(record));
+			position += sizeof(record);
+		}
+	}
+
+	for (PlantGroup *group : context.groups)
+	{
+		for (PlantComponent *child : *group->getPlants())
+		{
+			if (child->getType() != ComponentType::LIVING_PLANT)
+			{
+				continue;
+			}
+			LivingPlant *plant = static_cast<LivingPlant *>(child);
+			for (PlantComponent *c = plant->decorator; c != nullptr && c != plant;
+				 c = static_cast<PlantAttributes *>(c)->nextComponent)
+			{
+				PlantAttributes *attribute = static_cast<PlantAttributes *>(c);
+				for (std::size_t a = 0; a < attribute->getAttributeCount(); a++)
+				{
+					writeU32(out, context.intern(attribute->getAttribute(a).name));
+					position += sizeof(uint32_t);
+				}
+			}
+		}
+	}
+	writePadding(out, position, header.groupsOffset);
+
+	uint32_t nextChild = 0;
+	uint32_t nextObserver = 0;
+	for (PlantGroup *group : context.groups)
+	{
+		GroupRecord record;
+		std::memset(&record, 0, sizeof(record));
+		record.name = context.intern(group->getGroupName());
+		record.firstChild = nextChild;
+		record.childCount = static_cast<uint32_t>(group->getPlants()->size());
+		record.firstObserver = nextObserver;
+		record.observerCount = context.observersOf(group);
+		record.id = group->id;
+		nextChild += record.childCount;
+		nextObserver += record.observerCount;
+		writeBytes(out, &record, sizeof(record));
+	}
+
+	for (std::size_t g = 0; g < context.groups.size(); g++)
+	{
+		uint32_t plantIndex = context.plantBase[g];
+		for (PlantComponent *child : *context.groups[g]->getPlants())
+		{
+			if (child->getType() == ComponentType::LIVING_PLANT)
+			{
+				writeU32(out, plantIndex++);
+			}
+			else
+			{
+				writeU32(out, GROUP_CHILD | context.groupIds[static_cast<PlantGroup *>(child)]);
+			}
+		}
+	}
+
+	for (PlantGroup *group : context.groups)
+	{
+		for (Observer *observer : group->getObservers())
+		{
+			std::unordered_map<const Observer *, uint32_t>::iterator it = context.staffIds.find(observer);
+			if (it != context.staffIds.end())
+			{
+				writeU32(out, it->second);
+			}
+		}
+	}
+
+	for (Staff *member : staff)
+	{
+		writeU32(out, context.intern(member->getName()));
+	}
+
+	for (Customer *customer : customers)
+	{
+		CustomerRecord record;
+		record.name = context.intern(customer->getName());
+		record.basket = customer->basket != nullptr ? context.groupIds[customer->basket] : NONE;
+		writeBytes(out, &record, sizeof(record));
+	}
+
+	out.flush();
+	if (!out)
+	{
+		throw "Failed to write inventory snapshot";
+	}
+}
+
+void InventorySnapshot::saveToFile(const std::string &path)
+{
+	std::ofstream out(path.c_str(), std::ios::binary | std::ios::trunc);
+	if (!out)
+	{
+		throw "Could not open snapshot file for writing";
+	}
+	save(out);
+}
+
+SnapshotFormat::Header InventorySnapshot::readHeader(const char *data, std::size_t size)
+{
+	if (data == nullptr || size < sizeof(Header))
+	{
+		throw "Snapshot is truncated";
+	}
+	Header header;
+	std::memcpy(&header, data, sizeof(header));
+
+	if (std::memcmp(header.magic, MAGIC, sizeof(header.magic)) != 0)
+		throw "Not an inventory snapshot";
+	if (header.byteOrder != BYTE_ORDER_MARK)
+		throw "Snapshot was written with a different byte order";
+	if (header.version != VERSION)
+		throw "Unsupported snapshot version";
+	if (header.totalSize != size)
+		throw "Snapshot is truncated";
+	if (header.stringsOffset < sizeof(Header) || header.stringsOffset > header.plantsOffset)
+		throw "Snapshot section out of bounds";
+
+	if (!sectionFits(header.plantsOffset, header.plantCount, sizeof(PlantRecord), size) ||
+		!sectionFits(header.decoratorsOffset, header.decoratorCount, sizeof(uint32_t), size) ||
+		!sectionFits(header.groupsOffset, header.groupCount, sizeof(GroupRecord), size) ||
+		!sectionFits(header.childrenOffset, header.childCount, sizeof(uint32_t), size) ||
+		!sectionFits(header.observersOffset, header.observerCount, sizeof(uint32_t), size) ||
+		!sectionFits(header.staffOffset, header.staffCount, sizeof(uint32_t), size) ||
+		!sectionFits(header.customersOffset, header.customerCount, sizeof(CustomerRecord), size))
+	{
+		throw "Snapshot section out of bounds";
+	}
+	if (header.groupCount == 0)
+		throw "Snapshot has no inventory root";
+
+	return header;
+}
+
+bool InventorySnapshot::isValidPlantRecord(const PlantRecord &record, const Header &header)
+{
+	const uint32_t stringCount = header.stringCount;
+	return validString(record.name, stringCount) && validOptionalString(record.season, stringCount) &&
+		   record.kind < KIND_COUNT &&
+		   (record.maturity == NO_ID || record.maturity <= Dead::getID()) &&
+		   (record.waterStrategy == NO_ID || (record.waterStrategy >= LowWater::getID() && record.waterStrategy <= AlternatingWater::getID())) &&
+		   (record.sunStrategy == NO_ID || (record.sunStrategy >= LowSun::getID() && record.sunStrategy <= AlternatingSun::getID())) &&
+		   record.firstDecorator <= header.decoratorCount &&
+		   record.decoratorCount <= header.decoratorCount - record.firstDecorator;
+}
+
+LivingPlant *InventorySnapshot::createPlant(const PlantRecord &record, Flyweight<std::string *> *name,
+											Flyweight<std::string *> *season, const std::vector<PlantComponent *> &chain)
+{
+	Inventory *inv = Inventory::getInstance();
+	LivingPlant *plant;
+	switch (record.kind)
+	{
+	case KIND_HERB:
+		plant = new Herb();
+		break;
+	case KIND_SHRUB:
+		plant = new Shrub();
+		break;
+	case KIND_SUCCULENT:
+		plant = new Succulent();
+		break;
+	case KIND_TREE:
+		plant = new Tree();
+		break;
+	default:
+		plant = new LivingPlant("Living Plant", 0.0, 0, 0);
+		break;
+	}
+
+	plant->setNameFlyweight(name);
+	plant->setSeason(season);
+	plant->price = record.price;
+	plant->affectWaterValue = record.affectWater;
+	plant->affectSunValue = record.affectSun;
+	plant->setAge(record.age);
+	plant->setHealth(record.health);
+	plant->setWaterLevel(record.waterLevel);
+	plant->setSunExposure(record.sunExposure);
+	// Assigned directly: a restore is not a state transition for the journal
+	if (record.maturity != NO_ID)
+		plant->maturityState = LivingPlant::smallIndex(inv->getStates(record.maturity)->getIndex());
+	if (record.waterStrategy != NO_ID)
+		plant->waterStrategy = LivingPlant::smallIndex(inv->getWaterFly(record.waterStrategy)->getIndex());
+	if (record.sunStrategy != NO_ID)
+		plant->sunStrategy = LivingPlant::smallIndex(inv->getSunFly(record.sunStrategy)->getIndex());
+	assignId(plant, record.id);
+
+	// addAttribute() inserts right behind the head, so add the head then the rest tail-first
+	if (!chain.empty())
+	{
+		plant->addAttribute(chain[0]);
+		for (std::size_t d = chain.size() - 1; d > 0; d--)
+		{
+			plant->addAttribute(chain[d]);
+		}
+	}
+	return plant;
+}
+
+void InventorySnapshot::restore(const char *data, std::size_t size)
+{
+	AllocationTracker::TagScope tag(AllocationTracker::Tag::SNAPSHOT);
+	Inventory *inv = Inventory::getInstance();
+	if (Inventory::on.load())
+	{
+		throw "Cannot restore a snapshot while the ticker is running";
+	}
+
+	// ---- Validate the whole image before touching live state ----
+	Header header = readHeader(data, size);
+
+	std::vector<std::string> strings;
+	strings.reserve(header.stringCount);
+	uint64_t cursor = header.stringsOffset;
+	for (uint32_t i = 0; i < header.stringCount; i++)
+	{
+		if (!sectionFits(cursor, 1, sizeof(uint32_t), header.plantsOffset))
+			throw "Snapshot string table out of bounds";
+		uint32_t length = readRecord<uint32_t>(data, cursor, 0);
+		cursor += sizeof(uint32_t);
+		if (!sectionFits(cursor, length, 1, header.plantsOffset))
+			throw "Snapshot string table out of bounds";
+		strings.push_back(std::string(data + cursor, length));
+		cursor += length;
+	}
+
+	const uint32_t stringCount = header.stringCount;
+	if (!validOptionalString(header.currentSeason, stringCount))
+		throw "Snapshot season out of range";
+
+	const std::unordered_map<std::string, DecoratorFactory> &factories = decoratorFactories();
+	std::vector<DecoratorFactory> factoryForString(stringCount, nullptr);
+	for (uint32_t d = 0; d < header.decoratorCount; d++)
+	{
+		uint32_t name = readRecord<uint32_t>(data, header.decoratorsOffset, d);
+		if (!validString(name, stringCount))
+			throw "Snapshot decorator name out of range";
+		if (factoryForString[name] == nullptr)
+		{
+			std::unordered_map<std::string, DecoratorFactory>::const_iterator it = factories.find(strings[name]);
+			if (it == factories.end())
+				throw "Unknown decorator in snapshot";
+			factoryForString[name] = it->second;
+		}
+	}
+
+	for (uint32_t p = 0; p < header.plantCount; p++)
+	{
+		if (!isValidPlantRecord(readRecord<PlantRecord>(data, header.plantsOffset, p), header))
+		{
+			throw "Snapshot plant record is invalid";
+		}
+	}
+
+	// Each plant and non-root group must be referenced exactly once, parents before children
+	std::vector<bool> plantSeen(header.plantCount, false);
+	std::vector<bool> groupIsChild(header.groupCount, false);
+	for (uint32_t g = 0; g < header.groupCount; g++)
+	{
+		GroupRecord record = readRecord<GroupRecord>(data, header.groupsOffset, g);
+		if (!validOptionalString(record.name, stringCount) ||
+			record.firstChild > header.childCount || record.childCount > header.childCount - record.firstChild ||
+			record.firstObserver > header.observerCount || record.observerCount > header.observerCount - record.firstObserver)
+		{
+			throw "Snapshot group record is invalid";
+		}
+
+		for (uint32_t c = 0; c < record.childCount; c++)
+		{
+			uint32_t entry = readRecord<uint32_t>(data, header.childrenOffset, record.firstChild + c);
+			uint32_t index = entry & ~GROUP_CHILD;
+			if (entry & GROUP_CHILD)
+			{
+				if (index <= g || index >= header.groupCount || groupIsChild[index])
+					throw "Snapshot group hierarchy is invalid";
+				groupIsChild[index] = true;
+			}
+			else
+			{
+				if (index >= header.plantCount || plantSeen[index])
+					throw "Snapshot plant reference is invalid";
+				plantSeen[index] = true;
+			}
+		}
+
+		for (uint32_t o = 0; o < record.observerCount; o++)
+		{
+			if (readRecord<uint32_t>(data, header.observersOffset, record.firstObserver + o) >= header.staffCount)
+				throw "Snapshot observer reference is invalid";
+		}
+	}
+	for (uint32_t p = 0; p < header.plantCount; p++)
+	{
+		if (!plantSeen[p])
+			throw "Snapshot contains orphaned plants";
+	}
+
+	for (uint32_t s = 0; s < header.staffCount; s++)
+	{
+		if (!validString(readRecord<uint32_t>(data, header.staffOffset, s), stringCount))
+			throw "Snapshot staff record is invalid";
+	}
+
+	std::vector<bool> groupIsBasket(header.groupCount, false);
+	for (uint32_t c = 0; c < header.customerCount; c++)
+	{
+		CustomerRecord record = readRecord<CustomerRecord>(data, header.customersOffset, c);
+		if (!validString(record.name, stringCount))
+			throw "Snapshot customer record is invalid";
+		if (record.basket != NONE)
+		{
+			if (record.basket == 0 || record.basket >= header.groupCount ||
+				groupIsChild[record.basket] || groupIsBasket[record.basket])
+				throw "Snapshot customer basket is invalid";
+			groupIsBasket[record.basket] = true;
+		}
+	}
+	if (groupIsChild[0])
+		throw "Snapshot group hierarchy is invalid";
+	for (uint32_t g = 1; g < header.groupCount; g++)
+	{
+		if (!groupIsChild[g] && !groupIsBasket[g])
+			throw "Snapshot contains orphaned groups";
+	}
+
+	// ---- Build the new object graph ----
+	// Held until the plants own them: interning a large string table can trigger a reclaim
+	std::vector<Flyweight<std::string *> *> flyweights;
+	flyweights.reserve(stringCount);
+	for (const std::string &value : strings)
+	{
+		flyweights.push_back(inv->getString(value));
+		flyweights.back()->retain();
+	}
+
+	std::vector<LivingPlant *> plants(header.plantCount, nullptr);
+	std::vector<PlantComponent *> chain;
+	for (uint32_t p = 0; p < header.plantCount; p++)
+	{
+		PlantRecord record = readRecord<PlantRecord>(data, header.plantsOffset, p);
+		chain.clear();
+		for (uint32_t d = 0; d < record.decoratorCount; d++)
+		{
+			uint32_t name = readRecord<uint32_t>(data, header.decoratorsOffset, record.firstDecorator + d);
+			chain.push_back(factoryForString[name]());
+		}
+		plants[p] = createPlant(record, flyweights[record.name],
+								record.season == NONE ? nullptr : flyweights[record.season], chain);
+	}
+	for (Flyweight<std::string *> *flyweight : flyweights)
+	{
+		flyweight->release();
+	}
+
+	std::vector<Staff *> *staff = new std::vector<Staff *>();
+	for (uint32_t s = 0; s < header.staffCount; s++)
+	{
+		staff->push_back(new Staff(strings[readRecord<uint32_t>(data, header.staffOffset, s)]));
+	}
+
+	std::vector<PlantGroup *> groups(header.groupCount, nullptr);
+	for (uint32_t g = 0; g < header.groupCount; g++)
+	{
+		GroupRecord record = readRecord<GroupRecord>(data, header.groupsOffset, g);
+		groups[g] = record.name == NONE ? new PlantGroup() : new PlantGroup(strings[record.name]);
+		assignId(groups[g], record.id);
+	}
+	for (uint32_t g = 0; g < header.groupCount; g++)
+	{
+		GroupRecord record = readRecord<GroupRecord>(data, header.groupsOffset, g);
+		for (uint32_t c = 0; c < record.childCount; c++)
+		{
+			uint32_t entry = readRecord<uint32_t>(data, header.childrenOffset, record.firstChild + c);
+			uint32_t index = entry & ~GROUP_CHILD;
+			if (entry & GROUP_CHILD)
+				groups[g]->addComponent(groups[index]);
+			else
+				groups[g]->addComponent(plants[index]);
+		}
+		for (uint32_t o = 0; o < record.observerCount; o++)
+		{
+			groups[g]->attach((*staff)[readRecord<uint32_t>(data, header.observersOffset, record.firstObserver + o)]);
+		}
+	}
+
+	std::vector<Customer *> *customers = new std::vector<Customer *>();
+	for (uint32_t c = 0; c < header.customerCount; c++)
+	{
+		CustomerRecord record = readRecord<CustomerRecord>(data, header.customersOffset, c);
+		Customer *customer = new Customer(strings[record.name]);
+		customer->basket = record.basket == NONE ? nullptr : groups[record.basket];
+		customers->push_back(customer);
+	}
+
+	// ---- Swap into the live Inventory (groups before the staff observing them) ----
+	delete inv->inventory;
+	inv->inventory = groups[0];
+
+	for (Customer *customer : *inv->customerList)
+	{
+		delete customer;
+	}
+	delete inv->customerList;
+	inv->customerList = customers;
+
+	for (Staff *member : *inv->staffList)
+	{
+		delete member;
+	}
+	delete inv->staffList;
+	inv->staffList = staff;
+
+	if (header.currentSeason != NONE)
+	{
+		inv->currentSeason = flyweights[header.currentSeason];
+	}
+}
+
+void InventorySnapshot::restore(std::istream &in)
+{
+	std::vector<char> buffer((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+	restore(buffer.data(), buffer.size());
+}
+
+void InventorySnapshot::restoreFromFile(const std::string &path)
+{
+	// Restore straight from the mapped file rather than copying it into a buffer
+	MappedSnapshot mapped(path);
+	restore(mapped.getData(), mapped.getSize());
+}
@@ -0,0 +1,165 @@
+#ifndef PHOTOSYNTECH_INVENTORYSNAPSHOT_H
+#define PHOTOSYNTECH_INVENTORYSNAPSHOT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "SnapshotFormat.h"
+
+template <class T>
+class Flyweight;
+class PlantComponent;
+class PlantGroup;
+class LivingPlant;
+
+/**
+ * @brief Compact binary save/restore of the complete Inventory state.
+ *
+ * Externalises everything the Inventory singleton owns - the plant hierarchy,
+ * staff, customers (with their baskets), group observers and the current
+ * season - into a single binary image, and rebuilds that state from it.
+ *
+ * **System Role:**
+ * Persistence layer for the nursery. Restarting the process no longer loses the
+ * inventory, and restoring a large nursery avoids re-running builders: plants are
+ * created as their recorded kind and their fields set from records.
+ *
+ * **Pattern Role:** Memento (opaque snapshot of the Inventory's internal state)
+ *
+ * **Related Patterns:**
+ * - Singleton: Inventory is the originator; friend access keeps its API unchanged
+ * - Flyweight: Strings and strategies are written once and referenced by id
+ * - Prototype: Restored plants keep their concrete kind (Herb, Shrub, ...) for clone()
+ * - Composite: Groups are stored as ranges into a shared child table
+ * - Decorator: Chains are stored as ordered attribute names and rebuilt
+ *
+ * **Format (version 2, native byte order, see SnapshotFormat.h):**
+ * - Header with counts and the absolute offset of every section
+ * - String table (length-prefixed), padded to 8 bytes
+ * - Fixed-size plant records referencing strings and strategy ids, with component ids
+ * - Decorator table (string id per attribute, head to tail)
+ * - Group records as [first, count) ranges into the child table and observer table
+ * - Child table entries (plant index, or group index with the high bit set)
+ * - Observer table (staff indices), staff records, customer records
+ *
+ * Group 0 is the inventory root; customer baskets are additional root groups.
+ *
+ * **Implementation Details:**
+ * - save() makes two passes: the first interns strings and counts records, the
+ *   second streams each section straight to the output, so memory use is
+ *   proportional to the number of groups and distinct strings, not plants
+ * - restore() validates every index in the image before touching the live
+ *   Inventory; a corrupt image throws and leaves the current state intact
+ * - Errors are reported by throwing const char* messages
+ *
+ * @see Inventory (originator whose state is captured)
+ * @see SnapshotFormat.h (on-disk record layouts)
+ * @see MappedSnapshot (read-only, lazily materialised view of a snapshot file)
+ */
+class InventorySnapshot
+{
+	public:
+		/**
+		 * @brief Writes the current Inventory state to a binary stream.
+		 * @param out Stream opened in binary mode.
+		 * @throws const char* if the inventory contains unsupported components or writing fails.
+		 */
+		static void save(std::ostream &out);
+
+		/**
+		 * @brief Writes the current Inventory state to a file.
+		 * @param path Destination file, replaced if it exists.
+		 */
+		static void saveToFile(const std::string &path);
+
+		/**
+		 * @brief Replaces the Inventory state with the contents of an in-memory image.
+		 * @param data Pointer to the snapshot bytes.
+		 * @param size Number of bytes available at data.
+		 * @throws const char* if the image is invalid or the ticker is running.
+		 */
+		static void restore(const char *data, std::size_t size);
+
+		/**
+		 * @brief Replaces the Inventory state with a snapshot read from a stream.
+		 * @param in Stream opened in binary mode, positioned at the snapshot start.
+		 */
+		static void restore(std::istream &in);
+
+		/**
+		 * @brief Replaces the Inventory state with a snapshot file.
+		 *
+		 * Reads from a MappedSnapshot instead of copying the file into a
+		 * buffer, but every plant is still built before this returns.
+		 * @param path Snapshot file written by saveToFile().
+		 */
+		static void restoreFromFile(const std::string &path);
+
+		/**
+		 * @brief Creates the attribute decorator with a given display name.
+		 * @param name Name passed to the decorator's constructor (e.g. "Large Flowers").
+		 * @return New undecorated attribute, or nullptr if the name is unknown.
+		 */
+		static PlantComponent *createDecorator(const std::string &name);
+
+	private:
+		friend class MappedSnapshot;
+		friend class InventoryJournal;
+
+		struct SaveContext;
+
+		/**
+		 * @brief Reverse lookup from the Inventory's state/strategy flyweights to their ids.
+		 */
+		struct FlyweightIds
+		{
+			std::unordered_map<const void *, uint8_t> maturity;
+			std::unordered_map<const void *, uint8_t> water;
+			std::unordered_map<const void *, uint8_t> sun;
+
+			FlyweightIds();
+
+			static uint8_t find(const std::unordered_map<const void *, uint8_t> &ids, const void *fly, const char *error);
+		};
+
+		/**
+		 * @brief Fills a plant record from a LivingPlant (name and season are left as NONE).
+		 */
+		static SnapshotFormat::PlantRecord describePlant(LivingPlant *plant, const FlyweightIds &ids);
+
+		/**
+		 * @brief Gives a restored component its saved id (0 keeps the fresh id).
+		 */
+		static void assignId(PlantComponent *component, uint32_t id);
+
+		/**
+		 * @brief Appends the names of a plant's decorators, head to tail.
+		 */
+		static void decoratorNames(LivingPlant *plant, std::vector<std::string> &names);
+
+		/**
+		 * @brief Checks magic, version, byte order, total size and section bounds.
+		 * @throws const char* describing the first problem found.
+		 */
+		static SnapshotFormat::Header readHeader(const char *data, std::size_t size);
+
+		/**
+		 * @brief Checks a plant record's string, strategy, state and decorator references.
+		 */
+		static bool isValidPlantRecord(const SnapshotFormat::PlantRecord &record, const SnapshotFormat::Header &header);
+
+		/**
+		 * @brief Builds a LivingPlant of the recorded kind and attaches its decorator chain (head first).
+		 */
+		static LivingPlant *createPlant(const SnapshotFormat::PlantRecord &record, Flyweight<std::string *> *name,
+										Flyweight<std::string *> *season, const std::vector<PlantComponent *> &chain);
+
+		static void collect(SaveContext &context);
+		static void collectGroup(SaveContext &context, PlantGroup *group);
+		static void collectPlant(SaveContext &context, LivingPlant *plant);
+};
+
+#endif //PHOTOSYNTECH_INVENTORYSNAPSHOT_H
@@ -0,0 +1,198 @@
+#include "MappedSnapshot.h"
+#include "InventorySnapshot.h"
+#include "../singleton/Singleton.h"
+#include "../prototype/LivingPlant.h"
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace SnapshotFormat;
+
+MappedSnapshot::MappedSnapshot(const std::string &path)
+	: data(nullptr), size(0), records(nullptr), stringsIndexed(false)
+{
+	int fd = open(path.c_str(), O_RDONLY);
+	if (fd < 0)
+	{
+		throw "Could not open snapshot file for reading";
+	}
+
+	struct stat info;
+	if (fstat(fd, &info) != 0 || info.st_size < (off_t)sizeof(Header))
+	{
+		close(fd);
+		throw "Snapshot is truncated";
+	}
+
+	size = (std::size_t)info.st_size;
+	void *mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (mapping == MAP_FAILED)
+	{
+		throw "Could not map snapshot file";
+	}
+	data = static_cast<const char *>(mapping);
+
+	try
+	{
+		header = InventorySnapshot::readHeader(data, size);
+		// The mapping is page aligned, so an aligned offset gives aligned records
+		if (header.plantsOffset % alignof(PlantRecord) != 0)
+		{
+			throw "Snapshot plant table is misaligned";
+		}
+	}
+	catch (const char *)
+	{
+		munmap(const_cast<char *>(data), size);
+		throw;
+	}
+	records = reinterpret_cast<const PlantRecord *>(data + header.plantsOffset);
+}
+
+MappedSnapshot::~MappedSnapshot()
+{
+	for (std::unordered_map<std::size_t, LivingPlant *>::iterator it = plants.begin(); it != plants.end(); ++it)
+	{
+		// Deleting the decorator head also deletes the wrapped plant
+		if (it->second->getDecorator())
+			delete it->second->getDecorator();
+		else
+			delete it->second;
+	}
+	munmap(const_cast<char *>(data), size);
+}
+
+std::size_t MappedSnapshot::getPlantCount() const
+{
+	return header.plantCount;
+}
+
+const PlantRecord &MappedSnapshot::getPlantRecord(std::size_t index) const
+{
+	if (index >= header.plantCount)
+	{
+		throw "Snapshot plant index out of range";
+	}
+	if (!InventorySnapshot::isValidPlantRecord(records[index], header))
+	{
+		throw "Snapshot plant record is invalid";
+	}
+	return records[index];
+}
+
+void MappedSnapshot::indexStrings()
+{
+	std::vector<uint64_t> offsets;
+	offsets.reserve(header.stringCount);
+
+	uint64_t cursor = header.stringsOffset;
+	for (uint32_t i = 0; i < header.stringCount; i++)
+	{
+		if (cursor > header.plantsOffset || header.plantsOffset - cursor < sizeof(uint32_t))
+			throw "Snapshot string table out of bounds";
+		uint32_t length;
+		std::memcpy(&length, data + cursor, sizeof(length));
+		offsets.push_back(cursor);
+		cursor += sizeof(uint32_t);
+		if (header.plantsOffset - cursor < length)
+			throw "Snapshot string table out of bounds";
+		cursor += length;
+	}
+
+	stringOffsets.swap(offsets);
+	stringsIndexed = true;
+}
+
+std::string MappedSnapshot::getString(uint32_t id)
+{
+	if (!stringsIndexed)
+	{
+		indexStrings();
+	}
+	if (id >= stringOffsets.size())
+	{
+		throw "Snapshot string id out of range";
+	}
+
+	uint32_t length;
+	std::memcpy(&length, data + stringOffsets[id], sizeof(length));
+	return std::string(data + stringOffsets[id] + sizeof(uint32_t), length);
+}
+
+std::string MappedSnapshot::getPlantName(std::size_t index)
+{
+	return getString(getPlantRecord(index).name);
+}
+
+LivingPlant *MappedSnapshot::getPlant(std::size_t index)
+{
+	std::unordered_map<std::size_t, LivingPlant *>::iterator it = plants.find(index);
+	if (it != plants.end())
+	{
+		return it->second;
+	}
+
+	const PlantRecord &record = getPlantRecord(index);
+	Inventory *inv = Inventory::getInstance();
+
+	// Resolve everything that can fail before allocating the plant
+	Flyweight<std::string *> *name = inv->getString(getString(record.name));
+	Flyweight<std::string *> *season = record.season == NONE ? nullptr : inv->getString(getString(record.season));
+
+	std::vector<std::string> decoratorNames;
+	for (uint32_t d = 0; d < record.decoratorCount; d++)
+	{
+		uint32_t nameId;
+		std::memcpy(&nameId, data + header.decoratorsOffset + (uint64_t)(record.firstDecorator + d) * sizeof(uint32_t), sizeof(nameId));
+		decoratorNames.push_back(getString(nameId));
+	}
+
+	std::vector<PlantComponent *> chain;
+	for (const std::string &decoratorName : decoratorNames)
+	{
+		PlantComponent *decorator = InventorySnapshot::createDecorator(decoratorName);
+		if (decorator == nullptr)
+		{
+			for (PlantComponent *created : chain)
+			{
+				delete created;
+			}
+			throw "Unknown decorator in snapshot";
+		}
+		chain.push_back(decorator);
+	}
+
+	LivingPlant *plant = InventorySnapshot::createPlant(record, name, season, chain);
+	plants[index] = plant;
+	return plant;
+}
+
+LivingPlant *MappedSnapshot::takePlant(std::size_t index)
+{
+	LivingPlant *plant = getPlant(index);
+	plants.erase(index);
+	return plant;
+}
+
+bool MappedSnapshot::isMaterialised(std::size_t index) const
+{
+	return plants.count(index) != 0;
+}
+
+std::size_t MappedSnapshot::getMaterialisedCount() const
+{
+	return plants.size();
+}
+
+const char *MappedSnapshot::getData() const
+{
+	return data;
+}
+
+std::size_t MappedSnapshot::getSize() const
+{
+	return size;
+}
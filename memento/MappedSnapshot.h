@@ -0,0 +1,140 @@
+#ifndef PHOTOSYNTECH_MAPPEDSNAPSHOT_H
+#define PHOTOSYNTECH_MAPPEDSNAPSHOT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "SnapshotFormat.h"
+
+class LivingPlant;
+
+/**
+ * @brief Read-only, memory-mapped view of an InventorySnapshot file.
+ *
+ * Maps a snapshot written by InventorySnapshot::saveToFile() and serves plant
+ * records straight from the mapping, so a saved nursery can be inspected as
+ * soon as the file is opened without deserialising every LivingPlant.
+ *
+ * **System Role:**
+ * Read-only inspection of snapshot files. Opening only validates the header
+ * and section bounds, so it costs the same for ten plants or a million; records
+ * are checked individually as they are accessed.
+ *
+ * It does not make loading the nursery lazy: the Inventory holds live plants
+ * only, so InventorySnapshot::restoreFromFile() still materialises every
+ * plant and its startup cost grows with the nursery.
+ *
+ * **Pattern Role:** Memento reader with Virtual Proxy style materialisation
+ *
+ * **Related Patterns:**
+ * - Memento: Reads the state captured by InventorySnapshot
+ * - Proxy: PlantRecords stand in for LivingPlants until one is needed
+ * - Flyweight: Strings are resolved through the Inventory's flyweight factory
+ *
+ * **Copy-on-write:**
+ * - getPlantRecord() returns the record as saved, directly from the mapping
+ * - getPlant() materialises a heap LivingPlant (with its decorator chain) on
+ *   first use; that plant is then the one to tick, water or mutate, and later
+ *   calls return the same object
+ * - Materialised plants are owned by the MappedSnapshot until takePlant()
+ *   hands one over (e.g. to add it to a PlantGroup)
+ *
+ * The mapping is private and read-only; the file is never modified.
+ *
+ * @see InventorySnapshot (writer and full restore)
+ * @see SnapshotFormat.h (record layouts)
+ */
+class MappedSnapshot
+{
+	public:
+		/**
+		 * @brief Maps a snapshot file and validates its header.
+		 * @param path Snapshot file written by InventorySnapshot::saveToFile().
+		 * @throws const char* if the file cannot be mapped or is not a valid snapshot.
+		 */
+		MappedSnapshot(const std::string &path);
+
+		/**
+		 * @brief Unmaps the file and deletes plants that were not taken.
+		 */
+		~MappedSnapshot();
+
+		/**
+		 * @brief Gets the number of plant records in the snapshot.
+		 */
+		std::size_t getPlantCount() const;
+
+		/**
+		 * @brief Gets the saved record for a plant without materialising it.
+		 * @param index Plant index, 0 to getPlantCount() - 1.
+		 * @return Reference into the mapping, valid for this MappedSnapshot's lifetime.
+		 * @throws const char* if index is out of range or the record is invalid.
+		 */
+		const SnapshotFormat::PlantRecord &getPlantRecord(std::size_t index) const;
+
+		/**
+		 * @brief Resolves a string-table id (e.g. PlantRecord::name).
+		 * @throws const char* if the id or the string table is invalid.
+		 */
+		std::string getString(uint32_t id);
+
+		/**
+		 * @brief Gets a plant's saved name.
+		 */
+		std::string getPlantName(std::size_t index);
+
+		/**
+		 * @brief Gets a mutable LivingPlant for a record, creating it on first use.
+		 * @param index Plant index, 0 to getPlantCount() - 1.
+		 * @return The materialised plant, still owned by this MappedSnapshot.
+		 * @throws const char* if the record or its decorators are invalid.
+		 */
+		LivingPlant *getPlant(std::size_t index);
+
+		/**
+		 * @brief Transfers ownership of a plant to the caller, materialising it if needed.
+		 * @return The plant; later getPlant() calls for this index create a fresh copy.
+		 */
+		LivingPlant *takePlant(std::size_t index);
+
+		/**
+		 * @brief Checks whether a plant has been materialised and not taken.
+		 */
+		bool isMaterialised(std::size_t index) const;
+
+		/**
+		 * @brief Gets the number of plants currently materialised and owned here.
+		 */
+		std::size_t getMaterialisedCount() const;
+
+		/**
+		 * @brief Gets the raw snapshot bytes (for InventorySnapshot::restore()).
+		 */
+		const char *getData() const;
+
+		/**
+		 * @brief Gets the size of the mapped file in bytes.
+		 */
+		std::size_t getSize() const;
+
+	private:
+		MappedSnapshot(const MappedSnapshot &);
+		MappedSnapshot &operator=(const MappedSnapshot &);
+
+		void indexStrings();
+
+		const char *data;
+		std::size_t size;
+		SnapshotFormat::Header header;
+		const SnapshotFormat::PlantRecord *records;
+
+		std::vector<uint64_t> stringOffsets;
+		bool stringsIndexed;
+
+		// Sparse: only plants that were actually touched
+		std::unordered_map<std::size_t, LivingPlant *> plants;
+};
+
+#endif //PHOTOSYNTECH_MAPPEDSNAPSHOT_H
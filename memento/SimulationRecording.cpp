@@ -0,0 +1,232 @@
+#include "SimulationRecording.h"
+#include "InventorySnapshot.h"
+#include "InventoryJournal.h"
+#include "SnapshotFormat.h"
+#include "../singleton/Singleton.h"
+#include "../singleton/SimulationRandom.h"
+#include "../composite/PlantGroup.h"
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <unordered_map>
+
+namespace
+{
+	const char RECORDING_MAGIC[8] = {'P', 'H', 'O', 'T', 'O', 'S', 'I', 'M'};
+	const uint32_t RECORDING_VERSION = 1;
+	const std::size_t EVENT_SIZE = sizeof(uint8_t) + sizeof(uint32_t);
+
+	void putU32(std::string &out, uint32_t value)
+	{
+		out.append(reinterpret_cast<const char *>(&value), sizeof(value));
+	}
+
+	void putU64(std::string &out, uint64_t value)
+	{
+		out.append(reinterpret_cast<const char *>(&value), sizeof(value));
+	}
+
+	void indexComponents(std::unordered_map<uint32_t, PlantComponent *> &index, PlantComponent *component)
+	{
+		index[component->getId()] = component;
+		if (component->getType() == ComponentType::PLANT_GROUP)
+		{
+			for (PlantComponent *child : *static_cast<PlantGroup *>(component)->getPlants())
+			{
+				indexComponents(index, child);
+			}
+		}
+	}
+}
+
+SimulationRecording::SimulationRecording()
+	: seed(0)
+{
+}
+
+SimulationRecording::SimulationRecording(uint32_t seed)
+	: seed(seed)
+{
+	std::ostringstream out;
+	InventorySnapshot::save(out);
+	image = out.str();
+
+	SimulationRandom::seed(seed);
+	Inventory::getInstance()->resetSimulationState();
+}
+
+void SimulationRecording::record(EventType type, uint32_t componentId)
+{
+	Event event;
+	event.type = type;
+	event.componentId = componentId;
+
+	std::lock_guard<std::mutex> guard(lock);
+	events.push_back(event);
+}
+
+void SimulationRecording::recordTick()
+{
+	record(EventType::TICK, 0);
+}
+
+void SimulationRecording::recordWater(PlantComponent *component)
+{
+	record(EventType::WATER, component->getId());
+}
+
+void SimulationRecording::recordSunlight(PlantComponent *component)
+{
+	record(EventType::SUNLIGHT, component->getId());
+}
+
+uint32_t SimulationRecording::getSeed() const
+{
+	return seed;
+}
+
+std::vector<SimulationRecording::Event> SimulationRecording::getEvents()
+{
+	std::lock_guard<std::mutex> guard(lock);
+	return events;
+}
+
+std::size_t SimulationRecording::getTickCount()
+{
+	std::lock_guard<std::mutex> guard(lock);
+	std::size_t ticks = 0;
+	for (const Event &event : events)
+	{
+		if (event.type == EventType::TICK)
+			ticks++;
+	}
+	return ticks;
+}
+
+std::size_t SimulationRecording::replay(std::size_t maxTicks)
+{
+	std::vector<Event> log = getEvents();
+	InventorySnapshot::restore(image.data(), image.size());
+
+	Inventory *inv = Inventory::getInstance();
+	SimulationRandom::seed(seed);
+	inv->resetSimulationState();
+
+	std::unordered_map<uint32_t, PlantComponent *> index;
+	indexComponents(index, inv->getInventory());
+
+	// The replayed run must not be logged again, neither here nor in the journal
+	SimulationRecording *activeRecording = inv->getRecording();
+	InventoryJournal *activeJournal = inv->getJournal();
+	inv->setRecording(nullptr);
+	inv->setJournal(nullptr);
+
+	std::size_t ticks = 0;
+	for (const Event &event : log)
+	{
+		if (event.type == EventType::TICK)
+		{
+			if (ticks == maxTicks)
+				break;
+			inv->tickOnce();
+			ticks++;
+			continue;
+		}
+
+		std::unordered_map<uint32_t, PlantComponent *>::iterator it = index.find(event.componentId);
+		if (it == index.end())
+			continue;
+		if (event.type == EventType::WATER)
+			it->second->water();
+		else
+			it->second->setOutside();
+	}
+
+	inv->setRecording(activeRecording);
+	inv->setJournal(activeJournal);
+	return ticks;
+}
+
+void SimulationRecording::saveToFile(const std::string &path)
+{
+	std::vector<Event> log = getEvents();
+
+	std::string out(RECORDING_MAGIC, sizeof(RECORDING_MAGIC));
+	putU32(out, RECORDING_VERSION);
+	putU32(out, SnapshotFormat::BYTE_ORDER_MARK);
+	putU32(out, seed);
+	putU64(out, image.size());
+	out.append(image);
+	putU64(out, log.size());
+	for (const Event &event : log)
+	{
+		out.push_back(static_cast<char>(event.type));
+		putU32(out, event.componentId);
+	}
+
+	std::ofstream file(path.c_str(), std::ios::binary | std::ios::trunc);
+	if (!file || !file.write(out.data(), out.size()))
+	{
+		throw "Could not write simulation recording";
+	}
+}
+
+SimulationRecording *SimulationRecording::loadFromFile(const std::string &path)
+{
+	std::ifstream file(path.c_str(), std::ios::binary);
+	if (!file)
+	{
+		throw "Could not open simulation recording";
+	}
+	std::string data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+	std::size_t position = sizeof(RECORDING_MAGIC) + 3 * sizeof(uint32_t);
+	uint32_t version, byteOrder, seed;
+	uint64_t imageSize, eventCount;
+	if (data.size() < position + sizeof(uint64_t) || std::memcmp(data.data(), RECORDING_MAGIC, sizeof(RECORDING_MAGIC)) != 0)
+	{
+		throw "Not a simulation recording";
+	}
+	std::memcpy(&version, data.data() + sizeof(RECORDING_MAGIC), sizeof(version));
+	std::memcpy(&byteOrder, data.data() + sizeof(RECORDING_MAGIC) + sizeof(uint32_t), sizeof(byteOrder));
+	std::memcpy(&seed, data.data() + sizeof(RECORDING_MAGIC) + 2 * sizeof(uint32_t), sizeof(seed));
+	if (version != RECORDING_VERSION || byteOrder != SnapshotFormat::BYTE_ORDER_MARK)
+	{
+		throw "Unsupported simulation recording";
+	}
+
+	std::memcpy(&imageSize, data.data() + position, sizeof(imageSize));
+	position += sizeof(imageSize);
+	if (data.size() - position < imageSize || data.size() - position - imageSize < sizeof(uint64_t))
+	{
+		throw "Simulation recording is truncated";
+	}
+	std::size_t imageOffset = position;
+	position += imageSize;
+	std::memcpy(&eventCount, data.data() + position, sizeof(eventCount));
+	position += sizeof(eventCount);
+	if ((data.size() - position) / EVENT_SIZE < eventCount)
+	{
+		throw "Simulation recording is truncated";
+	}
+
+	SimulationRecording *recording = new SimulationRecording();
+	recording->seed = seed;
+	recording->image.assign(data.data() + imageOffset, imageSize);
+	recording->events.reserve(eventCount);
+	for (uint64_t e = 0; e < eventCount; e++, position += EVENT_SIZE)
+	{
+		Event event;
+		uint8_t type = static_cast<uint8_t>(data[position]);
+		if (type < static_cast<uint8_t>(EventType::TICK) || type > static_cast<uint8_t>(EventType::SUNLIGHT))
+		{
+			delete recording;
+			throw "Simulation recording has an unknown event";
+		}
+		event.type = static_cast<EventType>(type);
+		std::memcpy(&event.componentId, data.data() + position + 1, sizeof(event.componentId));
+		recording->events.push_back(event);
+	}
+	return recording;
+}
@@ -0,0 +1,140 @@
+#ifndef PHOTOSYNTECH_SIMULATIONRECORDING_H
+#define PHOTOSYNTECH_SIMULATIONRECORDING_H
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+class PlantComponent;
+
+/**
+ * @brief Reproducible log of a simulation run: starting inventory, seed and events.
+ *
+ * Captures the Inventory as an InventorySnapshot image when recording starts,
+ * seeds SimulationRandom, and then logs every tick and every watering or
+ * sunlight action in order. replay() restores the image, reseeds, and applies
+ * the same events with no wall-clock sleeps, so a run that took minutes on
+ * the ticker thread replays in milliseconds and ticks identically every time.
+ *
+ * **System Role:**
+ * Regression and benchmarking tool. A recording taken from a slow session can
+ * be replayed under a profiler, or replayed up to a given tick to bisect where
+ * plant state diverges between two builds.
+ *
+ * **Pattern Role:** Memento (initial state) plus a log of replayable Commands
+ *
+ * **Related Patterns:**
+ * - Memento: The starting state is an InventorySnapshot image
+ * - Singleton: Inventory::tickOnce() reports ticks through Inventory::getRecording()
+ * - Facade: NurseryFacade records water and sunlight actions
+ *
+ * Events refer to components by PlantComponent::getId(), which snapshots
+ * preserve. Actions on components outside the inventory tree (e.g. baskets)
+ * are skipped on replay. Recording and replay require the ticker to be stopped
+ * while the image is captured or restored.
+ *
+ * @see SimulationRandom (seeded per-subsystem random streams)
+ * @see InventoryJournal (durability log for structural changes)
+ */
+class SimulationRecording
+{
+	public:
+		/**
+		 * @brief Kinds of recorded event.
+		 */
+		enum class EventType : uint8_t
+		{
+			TICK = 1,	 ///< Inventory::tickOnce()
+			WATER = 2,	 ///< PlantComponent::water()
+			SUNLIGHT = 3 ///< PlantComponent::setOutside()
+		};
+
+		/**
+		 * @brief One recorded event.
+		 */
+		struct Event
+		{
+			EventType type;
+			uint32_t componentId; ///< 0 for ticks
+		};
+
+		/**
+		 * @brief Starts a recording from the current Inventory.
+		 *
+		 * Captures the inventory, seeds SimulationRandom with seed and resets the
+		 * Inventory's simulation state, so the recorded run starts exactly where
+		 * replay() will.
+		 * @param seed Base seed for SimulationRandom.
+		 * @throws const char* if the inventory cannot be captured.
+		 */
+		SimulationRecording(uint32_t seed);
+
+		/**
+		 * @brief Records one simulation tick.
+		 */
+		void recordTick();
+
+		/**
+		 * @brief Records a component being watered.
+		 */
+		void recordWater(PlantComponent *component);
+
+		/**
+		 * @brief Records a component being put in the sun.
+		 */
+		void recordSunlight(PlantComponent *component);
+
+		/**
+		 * @brief Gets the seed the run was recorded with.
+		 */
+		uint32_t getSeed() const;
+
+		/**
+		 * @brief Gets a copy of the recorded events.
+		 */
+		std::vector<Event> getEvents();
+
+		/**
+		 * @brief Gets the number of recorded ticks.
+		 */
+		std::size_t getTickCount();
+
+		/**
+		 * @brief Replaces the Inventory with the recorded start and replays events at full speed.
+		 *
+		 * The journal and any active recording are suspended while replaying.
+		 * @param maxTicks Stop before the tick that would exceed this count.
+		 * @return Number of ticks replayed.
+		 * @throws const char* if the ticker is running or the image cannot be restored.
+		 */
+		std::size_t replay(std::size_t maxTicks = SIZE_MAX);
+
+		/**
+		 * @brief Writes the recording to a binary file.
+		 * @throws const char* if the file cannot be written.
+		 */
+		void saveToFile(const std::string &path);
+
+		/**
+		 * @brief Reads a recording written by saveToFile().
+		 * @return New recording owned by the caller.
+		 * @throws const char* if the file is missing or malformed.
+		 */
+		static SimulationRecording *loadFromFile(const std::string &path);
+
+	private:
+		SimulationRecording();
+		SimulationRecording(const SimulationRecording &);
+		SimulationRecording &operator=(const SimulationRecording &);
+
+		void record(EventType type, uint32_t componentId);
+
+		uint32_t seed;
+		std::string image;
+		std::vector<Event> events;
+		std::mutex lock;
+};
+
+#endif //PHOTOSYNTECH_SIMULATIONRECORDING_H
@@ -0,0 +1,140 @@
+#ifndef PHOTOSYNTECH_SNAPSHOTFORMAT_H
+#define PHOTOSYNTECH_SNAPSHOTFORMAT_H
+
+#include <cstdint>
+
+/**
+ * @file SnapshotFormat.h
+ * @brief On-disk record layouts shared by the snapshot writer and readers.
+ *
+ * All records are trivially copyable, fixed-size and laid out so that no
+ * implicit padding is inserted; sizes are checked with static_assert. Integers
+ * are stored in the writer's native byte order, which the header's byteOrder
+ * marker lets readers verify. Sections start on 8-byte boundaries.
+ */
+namespace SnapshotFormat
+{
+	/**
+	 * @brief Marker stored in every snapshot header.
+	 */
+	const char MAGIC[8] = {'P', 'H', 'O', 'T', 'O', 'S', 'N', 'P'};
+
+	/**
+	 * @brief Current format version (2 added component ids to plant and group records).
+	 */
+	const uint32_t VERSION = 2;
+
+	/**
+	 * @brief Written as a native integer to detect byte-order mismatches.
+	 */
+	const uint32_t BYTE_ORDER_MARK = 0x01020304;
+
+	/**
+	 * @brief Sentinel for "no string" / "no group" references.
+	 */
+	const uint32_t NONE = 0xFFFFFFFFu;
+
+	/**
+	 * @brief Sentinel for "no strategy / state" in 8-bit id fields.
+	 */
+	const uint8_t NO_ID = 0xFF;
+
+	/**
+	 * @brief Child table flag marking a group index (otherwise a plant index).
+	 */
+	const uint32_t GROUP_CHILD = 0x80000000u;
+
+	/**
+	 * @brief Concrete LivingPlant subclass a record is restored as.
+	 */
+	enum PlantKind
+	{
+		KIND_LIVING_PLANT = 0,
+		KIND_HERB = 1,
+		KIND_SHRUB = 2,
+		KIND_SUCCULENT = 3,
+		KIND_TREE = 4,
+		KIND_COUNT = 5
+	};
+
+	/**
+	 * @brief File header: counts and absolute byte offsets of every section.
+	 */
+	struct Header
+	{
+		char magic[8];
+		uint32_t version;
+		uint32_t byteOrder;
+		uint32_t stringCount;
+		uint32_t plantCount;
+		uint32_t decoratorCount;
+		uint32_t groupCount;
+		uint32_t childCount;
+		uint32_t observerCount;
+		uint32_t staffCount;
+		uint32_t customerCount;
+		uint32_t currentSeason;
+		uint32_t reserved;
+		uint64_t stringsOffset;
+		uint64_t plantsOffset;
+		uint64_t decoratorsOffset;
+		uint64_t groupsOffset;
+		uint64_t childrenOffset;
+		uint64_t observersOffset;
+		uint64_t staffOffset;
+		uint64_t customersOffset;
+		uint64_t totalSize;
+	};
+
+	/**
+	 * @brief One LivingPlant; decorators are [firstDecorator, +decoratorCount) head to tail.
+	 */
+	struct PlantRecord
+	{
+		double price;
+		uint32_t name;
+		uint32_t season;
+		uint32_t firstDecorator;
+		uint32_t decoratorCount;
+		int32_t age;
+		int32_t health;
+		int32_t waterLevel;
+		int32_t sunExposure;
+		int32_t affectWater;
+		int32_t affectSun;
+		uint8_t kind;
+		uint8_t maturity;
+		uint8_t waterStrategy;
+		uint8_t sunStrategy;
+		uint32_t id;
+	};
+
+	/**
+	 * @brief One PlantGroup as ranges into the child and observer tables.
+	 */
+	struct GroupRecord
+	{
+		uint32_t name;
+		uint32_t firstChild;
+		uint32_t childCount;
+		uint32_t firstObserver;
+		uint32_t observerCount;
+		uint32_t id;
+	};
+
+	/**
+	 * @brief One Customer and the root group holding their basket (or NONE).
+	 */
+	struct CustomerRecord
+	{
+		uint32_t name;
+		uint32_t basket;
+	};
+
+	static_assert(sizeof(Header) == 128, "Snapshot header layout changed");
+	static_assert(sizeof(PlantRecord) == 56, "Snapshot plant record layout changed");
+	static_assert(sizeof(GroupRecord) == 24, "Snapshot group record layout changed");
+	static_assert(sizeof(CustomerRecord) == 8, "Snapshot customer record layout changed");
+}
+
+#endif //PHOTOSYNTECH_SNAPSHOTFORMAT_H
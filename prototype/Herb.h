@@ -59,6 +59,10 @@ public:
 	 * @return Pointer to a new Herb object that is a copy of this one.
 	 */
 	PlantComponent *clone();
+
+	std::size_t getCloneSize() const;
+
+	LivingPlant *cloneInto(void *memory);
 };
 
 #endif
@@ -6,78 +6,125 @@
 #include "Tree.h"
 #include "../composite/PlantComponent.h"
 #include "../singleton/Singleton.h"
+#include "../memento/InventoryJournal.h"
+#include "../diagnostics/TickProfiler.h"
+#include "../diagnostics/Tracer.h"
 #include "../state/MaturityState.h"
+#include "../composite/InfoBuffer.h"
+#include <new>
 
 
+const uint16_t LivingPlant::NO_STRING;
+const uint8_t LivingPlant::NO_FLYWEIGHT;
+
+namespace
+{
+    uint8_t clampVital(int value)
+    {
+        return static_cast<uint8_t>(std::max(0, std::min(100, value)));
+    }
+}
+
 LivingPlant::LivingPlant(std::string name, double price, int waterAffect, int sunAffect)
-    : PlantComponent(price, waterAffect, sunAffect), age(0),
+    : PlantComponent(price, waterAffect, sunAffect),
+      decorator(nullptr),
+      season(NO_STRING),
+      age(0),
       health(0),
       waterLevel(0),
       sunExposure(0),
-      maturityState(nullptr),
-      waterStrategy(nullptr),
-      sunStrategy(nullptr),
-      decorator(nullptr)
+      maturityState(NO_FLYWEIGHT),
+      waterStrategy(NO_FLYWEIGHT),
+      sunStrategy(NO_FLYWEIGHT),
+      infoVersion(0),
+      cachedInfo(nullptr)
 {
     // remember to change to getString() after Wilmar fixes getSeason()
-    this->name = Inventory::getInstance()->getString(name);
-    this->season = nullptr;
+    Flyweight<std::string *> *interned = Inventory::getInstance()->getString(name);
+    interned->retain();
+    this->name = interned->getIndex();
 };
 
 LivingPlant::LivingPlant(const LivingPlant &other)
         : PlantComponent(other),
-
+            decorator(nullptr),
             name(other.name),
+            season(other.season),
             age(other.age),
             health(other.health),
             waterLevel(other.waterLevel),
             sunExposure(other.sunExposure),
-            season(other.season),
-
             maturityState(other.maturityState),
             waterStrategy(other.waterStrategy),
             sunStrategy(other.sunStrategy),
-            decorator(nullptr)
+            infoVersion(0),
+            cachedInfo(nullptr)
 {
-        health = std::max(0, std::min(100, health));
-        waterLevel = std::max(0, std::min(100, waterLevel));
-        sunExposure = std::max(0, std::min(100, sunExposure));
+    Inventory::retainString(name);
+    if (season != NO_STRING)
+        Inventory::retainString(season);
 };
 
-
+uint8_t LivingPlant::smallIndex(uint16_t index)
+{
+    if (index >= NO_FLYWEIGHT)
+        throw "Too many states or strategies for a plant to index";
+    return static_cast<uint8_t>(index);
+}
 
 void LivingPlant::setAge(int age)
 {
-    this->age = age;
+    this->age = static_cast<uint16_t>(std::max(0, std::min(0xFFFF, age)));
+    invalidateInfo();
 };
 
 void LivingPlant::setHealth(int health)
 {
-    this->health = health;
-    this->health = std::max(0, std::min(100, this->health));
+    this->health = clampVital(health);
+    invalidateInfo();
 };
 
 
 void LivingPlant::setWaterLevel(int waterLevel)
 {
-    this->waterLevel = waterLevel;
-    this->waterLevel = std::max(0, std::min(100, this->waterLevel));
+    this->waterLevel = clampVital(waterLevel);
+    invalidateInfo();
 };
 
 
 void LivingPlant::setSunExposure(int sunExposure)
 {
-    this->sunExposure = sunExposure;
-    this->sunExposure = std::max(0, std::min(100, this->sunExposure));
+    this->sunExposure = clampVital(sunExposure);
+    invalidateInfo();
 };
 
+void LivingPlant::addWaterToAll(LivingPlant *const *plants, std::size_t count, int amount)
+{
+    for (std::size_t i = 0; i < count; i++)
+    {
+        LivingPlant *plant = plants[i];
+        plant->waterLevel = clampVital(plant->waterLevel + amount);
+        plant->invalidateInfo();
+    }
+}
+
+void LivingPlant::addSunToAll(LivingPlant *const *plants, std::size_t count, int amount)
+{
+    for (std::size_t i = 0; i < count; i++)
+    {
+        LivingPlant *plant = plants[i];
+        plant->sunExposure = clampVital(plant->sunExposure + amount);
+        plant->invalidateInfo();
+    }
+}
+
 void LivingPlant::setWaterStrategy(int strategy)
 {
     Inventory *inv = Inventory::getInstance();
 
     Flyweight<WaterStrategy *> *newStrategy = inv->getWaterFly(strategy);
 
-    this->waterStrategy = newStrategy;
+    this->waterStrategy = smallIndex(newStrategy->getIndex());
 };
 
 void LivingPlant::setSunStrategy(int strategy)
@@ -86,21 +133,42 @@ void LivingPlant::setSunStrategy(int strategy)
 
     Flyweight<SunStrategy *> *newStrategy = inv->getSunFly(strategy);
 
-    this->sunStrategy = newStrategy;
+    this->sunStrategy = smallIndex(newStrategy->getIndex());
 };
 
 void LivingPlant::setMaturity(int state)
 {
     Inventory *inv = Inventory::getInstance();
 
-    Flyweight<MaturityState *> *newState = inv->getStates(state);
+    uint8_t newState = smallIndex(inv->getStates(state)->getIndex());
+
+    // Builders set the first state on construction; only transitions are counted and journalled
+    if (this->maturityState != NO_FLYWEIGHT && this->maturityState != newState)
+    {
+        TickProfiler::countTransition();
+        if (InventoryJournal *journal = inv->getJournal())
+            journal->recordStateChange(this, state);
+    }
 
     this->maturityState = newState;
+    invalidateInfo();
 };
 
 void LivingPlant::setSeason(Flyweight<std::string *> *season)
 {
-    this->season = season;
+    if (season)
+        season->retain();
+    if (this->season != NO_STRING)
+        Inventory::releaseString(this->season);
+    this->season = season ? season->getIndex() : NO_STRING;
+}
+
+void LivingPlant::setNameFlyweight(Flyweight<std::string *> *name)
+{
+    name->retain();
+    Inventory::releaseString(this->name);
+    this->name = name->getIndex();
+    invalidateInfo();
 }
 
 int LivingPlant::getAge()
@@ -120,56 +188,156 @@ int LivingPlant::getSunExposure()
 
 std::string LivingPlant::getName()
 {
-    return *name->getState();
+    return getNameView();
 };
 
+const std::string &LivingPlant::getNameView()
+{
+    return *getNameFlyweight()->getState();
+}
+
+const std::string &LivingPlant::getSeasonView()
+{
+    static const std::string none;
+    Flyweight<std::string *> *season = getSeason();
+    return season ? *season->getState() : none;
+}
+
+Flyweight<std::string *> *LivingPlant::getNameFlyweight()
+{
+    return Inventory::getInstance()->getStringAt(this->name);
+}
+
 double LivingPlant::getPrice()
 {
     return this->price;
 };
 
-std::string LivingPlant::getInfo()
+void LivingPlant::writeInfo(InfoBuffer &out)
 {
-    std::ostringstream stream;
-    stream << std::fixed << std::setprecision(2);
-    string stateStr = "";
-    std::string plantName = *name->getState();
+    // Taken before rendering: a change made while the text is rendered leaves it out of date
+    CachedInfo *cached = takeInfo();
+    uint32_t version = infoVersion.load(std::memory_order_acquire);
+    if (cached != nullptr && cached->version == version)
+    {
+        out.append(cached->text);
+        keepInfo(cached);
+        return;
+    }
+
+    std::size_t start = out.size();
+    renderInfo(out);
+
+    // Streamed reports cover whole groups; caching every plant in them would undo the bounded memory
+    if (!out.isStreaming())
+    {
+        // Re-rendering reuses the entry's string, so a plant that keeps changing stops allocating
+        if (cached == nullptr)
+            cached = new CachedInfo();
+        cached->text.assign(out.str(), start, std::string::npos);
+        cached->version = version;
+    }
+    keepInfo(cached);
+}
 
-    if (this->maturityState)
-        stateStr = this->maturityState->getState()->getName();
+void LivingPlant::invalidateInfo()
+{
+    infoVersion.fetch_add(1, std::memory_order_release);
+}
 
-    stream << "-------------------------------\n";
+LivingPlant::CachedInfo *LivingPlant::takeInfo()
+{
+    return cachedInfo.exchange(nullptr, std::memory_order_acquire);
+}
 
-    stream << "| " << std::left << std::setw(15) << "Name:" << std::setw(13) << plantName << "|\n";
-    stream << "| " << std::left << std::setw(15) << "Health:" << std::setw(13) << health << "|\n";
-    stream << "| " << std::left << std::setw(15) << "Age:" << std::setw(13) << (std::to_string(age) + " days") << "|\n";
-    if (this->maturityState)
-        stream << "| " << std::left << std::setw(15) << "State:" << std::setw(13) << stateStr << "|\n";
+void LivingPlant::keepInfo(CachedInfo *cached)
+{
+    if (cached == nullptr)
+        return;
 
-    stream << "| " << std::left << std::setw(15) << "Age:" << std::setw(13) << (std::to_string(age) + " days") << "|\n";
-    stream << "| " << std::left << std::setw(15) << "Water Level:" << std::setw(13) << waterLevel << "|\n";
-    stream << "| " << std::left << std::setw(15) << "Sun Exposure:" << std::setw(13) << sunExposure << "|\n";
-    stream << "| " << std::left << std::setw(15) << "Base Price:" << "R" << std::setw(12) << price << "|\n";
+    // Another thread rendered and stored its own entry meanwhile; one is enough
+    CachedInfo *empty = nullptr;
+    if (!cachedInfo.compare_exchange_strong(empty, cached, std::memory_order_release))
+        delete cached;
+}
 
-    stream << "-------------------------------\n";
+void LivingPlant::renderInfo(InfoBuffer &out)
+{
+    Flyweight<MaturityState *> *state = getMaturity();
+    std::size_t mark;
+
+    out.append("-------------------------------\n");
+
+    out.append("| ").column("Name:", 15).column(getNameView(), 13).append("|\n");
+    out.append("| ").column("Health:", 15);
+    mark = out.size();
+    out.integer(health).padFrom(mark, 13).append("|\n");
+    out.append("| ").column("Age:", 15);
+    mark = out.size();
+    out.integer(age).append(" days").padFrom(mark, 13).append("|\n");
+    if (state)
+        out.append("| ").column("State:", 15).column(state->getState()->getName(), 13).append("|\n");
+
+    out.append("| ").column("Age:", 15);
+    mark = out.size();
+    out.integer(age).append(" days").padFrom(mark, 13).append("|\n");
+    out.append("| ").column("Water Level:", 15);
+    mark = out.size();
+    out.integer(waterLevel).padFrom(mark, 13).append("|\n");
+    out.append("| ").column("Sun Exposure:", 15);
+    mark = out.size();
+    out.integer(sunExposure).padFrom(mark, 13).append("|\n");
+    out.append("| ").column("Base Price:", 15).append("R");
+    mark = out.size();
+    out.fixed(price, 2).padFrom(mark, 12).append("|\n");
+
+    out.append("-------------------------------\n");
 
     if (decorator)
     {
-        stream << "\n";
-        stream << "Total:\n";
-        stream << "-------------------------------\n";
-        stream << "| " << std::left << std::setw(20) << "Total Price:" << "R" << std::setw(7) << decorator->getPrice() << "|\n";
-        stream << "| " << std::left << std::setw(20) << "Water Affection:" << std::setw(8) << decorator->affectWater() << "|\n";
-        stream << "| " << std::left << std::setw(20) << "Sun Affection:" << std::setw(8) << decorator->affectSunlight() << "|\n";
-        stream << "-------------------------------\n";
+        // One virtual call each; a shared decorator answers from its chain's totals
+        out.append("\n");
+        out.append("Total:\n");
+        out.append("-------------------------------\n");
+        out.append("| ").column("Total Price:", 20).append("R");
+        mark = out.size();
+        out.fixed(decorator->getPrice(), 2).padFrom(mark, 7).append("|\n");
+        out.append("| ").column("Water Affection:", 20);
+        mark = out.size();
+        out.integer(decorator->affectWater()).padFrom(mark, 8).append("|\n");
+        out.append("| ").column("Sun Affection:", 20);
+        mark = out.size();
+        out.integer(decorator->affectSunlight()).padFrom(mark, 8).append("|\n");
+        out.append("-------------------------------\n");
     }
-
-    return stream.str();
 }
 
 Flyweight<std::string *> *LivingPlant::getSeason()
 {
-    return this->season;
+    if (this->season == NO_STRING)
+        return nullptr;
+    return Inventory::getInstance()->getStringAt(this->season);
+}
+
+Flyweight<MaturityState *> *LivingPlant::getMaturity()
+{
+    if (this->maturityState == NO_FLYWEIGHT)
+        return nullptr;
+    return Inventory::getInstance()->getStateAt(this->maturityState);
+}
+
+Flyweight<WaterStrategy *> *LivingPlant::getWaterStrategy()
+{
+    if (this->waterStrategy == NO_FLYWEIGHT)
+        return nullptr;
+    return Inventory::getInstance()->getWaterFlyAt(this->waterStrategy);
+}
+
+Flyweight<SunStrategy *> *LivingPlant::getSunStrategy()
+{
+    if (this->sunStrategy == NO_FLYWEIGHT)
+        return nullptr;
+    return Inventory::getInstance()->getSunFlyAt(this->sunStrategy);
 }
 
 ComponentType LivingPlant::getType() const
@@ -179,20 +347,43 @@ ComponentType LivingPlant::getType() const
 
 PlantComponent *LivingPlant::clone()
 {
+    TRACE_SCOPE("clone", "prototype");
     return new LivingPlant(*this);
 };
 
+std::size_t LivingPlant::getCloneSize() const
+{
+    return sizeof(LivingPlant);
+}
+
+LivingPlant *LivingPlant::cloneInto(void *memory)
+{
+    return new (memory) LivingPlant(*this);
+}
+
+void *LivingPlant::operator new(std::size_t size)
+{
+    return ::operator new(size);
+}
+
+void *LivingPlant::operator new(std::size_t size, void *memory)
+{
+    return ::operator new(size, memory);
+}
+
+void LivingPlant::operator delete(void *memory)
+{
+    ::operator delete(memory);
+}
+
 void LivingPlant::water()
 {
-    if (this->waterStrategy != nullptr)
+    if (this->waterStrategy != NO_FLYWEIGHT)
     {
 
-        WaterStrategy *strategy = this->waterStrategy->getState();
+        WaterStrategy *strategy = getWaterStrategy()->getState();
 
         int waterApplied = strategy->water(this);
-    this->health = std::max(0, std::min(100, this->health));
-    this->waterLevel = std::max(0, std::min(100, this->waterLevel));
-    this->sunExposure = std::max(0, std::min(100, this->sunExposure));
     }
 }
 
@@ -211,31 +402,26 @@ void LivingPlant::update()
     // added null checks
     if (this->decorator != nullptr)
     {
-        this->waterLevel -= this->decorator->affectWater();
+        this->waterLevel = clampVital(this->waterLevel - this->decorator->affectWater());
 
-        this->sunExposure -= this->decorator->affectSunlight();
+        this->sunExposure = clampVital(this->sunExposure - this->decorator->affectSunlight());
     }
     else
     {
-        this->waterLevel -= this->affectWater();
-        this->sunExposure -= this->affectSunlight();
+        this->waterLevel = clampVital(this->waterLevel - this->affectWater());
+        this->sunExposure = clampVital(this->sunExposure - this->affectSunlight());
     }
-    this->health = std::max(0, std::min(100, this->health));
-    this->waterLevel = std::max(0, std::min(100, this->waterLevel));
-    this->sunExposure = std::max(0, std::min(100, this->sunExposure));
+    invalidateInfo();
 };
 
 void LivingPlant::setOutside()
 {
-    if (this->sunStrategy != nullptr)
+    if (this->sunStrategy != NO_FLYWEIGHT)
     {
 
-        SunStrategy *strategy = this->sunStrategy->getState();
+        SunStrategy *strategy = getSunStrategy()->getState();
 
         int sunApplied = strategy->addSun(this);
-    this->health = std::max(0, std::min(100, this->health));
-    this->waterLevel = std::max(0, std::min(100, this->waterLevel));
-    this->sunExposure = std::max(0, std::min(100, this->sunExposure));
     }
 }
 
@@ -255,6 +441,7 @@ void LivingPlant::addAttribute(PlantComponent *attribute)
         this->decorator = attribute;
         attribute->addAttribute(this);
     }
+    invalidateInfo();
 }
 
 Herb::Herb()
@@ -268,9 +455,20 @@ Herb::Herb(const Herb &other)
 
 PlantComponent *Herb::clone()
 {
+    TRACE_SCOPE("clone", "prototype");
     return new Herb(*this);
 }
 
+std::size_t Herb::getCloneSize() const
+{
+    return sizeof(Herb);
+}
+
+LivingPlant *Herb::cloneInto(void *memory)
+{
+    return new (memory) Herb(*this);
+}
+
 Shrub::Shrub()
     : LivingPlant("Shrub", 75.00, 4, 4) {};
 
@@ -282,9 +480,20 @@ Shrub::Shrub(const Shrub &other)
 
 PlantComponent *Shrub::clone()
 {
+    TRACE_SCOPE("clone", "prototype");
     return new Shrub(*this);
 }
 
+std::size_t Shrub::getCloneSize() const
+{
+    return sizeof(Shrub);
+}
+
+LivingPlant *Shrub::cloneInto(void *memory)
+{
+    return new (memory) Shrub(*this);
+}
+
 Succulent::Succulent()
     : LivingPlant("Succulent", 45.00, 1, 5) {};
 
@@ -296,9 +505,20 @@ Succulent::Succulent(const Succulent &other)
 
 PlantComponent *Succulent::clone()
 {
+    TRACE_SCOPE("clone", "prototype");
     return new Succulent(*this);
 }
 
+std::size_t Succulent::getCloneSize() const
+{
+    return sizeof(Succulent);
+}
+
+LivingPlant *Succulent::cloneInto(void *memory)
+{
+    return new (memory) Succulent(*this);
+}
+
 Tree::Tree()
     : LivingPlant("Tree", 150.00, 5, 5) {};
 
@@ -310,8 +530,19 @@ Tree::Tree(const Tree &other)
 
 PlantComponent *Tree::clone()
 {
+    TRACE_SCOPE("clone", "prototype");
     return new Tree(*this);
 }
+
+std::size_t Tree::getCloneSize() const
+{
+    return sizeof(Tree);
+}
+
+LivingPlant *Tree::cloneInto(void *memory)
+{
+    return new (memory) Tree(*this);
+}
 PlantComponent *LivingPlant::getDecorator()
 {
     return this->decorator;
@@ -319,10 +550,15 @@ PlantComponent *LivingPlant::getDecorator()
 PlantComponent *LivingPlant::correctShape(PlantComponent *mainDecorator)
 {
     this->decorator = mainDecorator;
+    invalidateInfo();
     return this;
 }
 LivingPlant::~LivingPlant()
 {
+    delete cachedInfo.load(std::memory_order_acquire);
+    Inventory::releaseString(name);
+    if (season != NO_STRING)
+        Inventory::releaseString(season);
     if (!deleted)
     {
         deleted = true;
@@ -340,17 +576,17 @@ int LivingPlant::getSunlightValue()
 }
 void LivingPlant::tick()
 {
+    if (this->maturityState == NO_FLYWEIGHT)
+        return;
 
-    this->maturityState->getState()->grow(this);
-    this->health = std::max(0, std::min(100, this->health));
-    this->waterLevel = std::max(0, std::min(100, this->waterLevel));
-    this->sunExposure = std::max(0, std::min(100, this->sunExposure));
+    getMaturity()->getState()->grow(this);
 }
 
 string LivingPlant::getImageStr()
 {
-    if (this->maturityState && this->maturityState->getState())
-   return this->maturityState->getState()->getImagePath(this);
+    Flyweight<MaturityState *> *state = getMaturity();
+    if (state && state->getState())
+   return state->getState()->getImagePath(this);
    else
    return "";
 }
\ No newline at end of file
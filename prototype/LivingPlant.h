@@ -1,6 +1,7 @@
 #ifndef LivingPlant_h
 #define LivingPlant_h
 
+#include <atomic>
 #include <string>
 #include "../composite/PlantComponent.h"
 #include "../flyweight/Flyweight.h"
@@ -55,27 +56,81 @@
 
 class LivingPlant : public PlantComponent
 {
+	friend class InventorySnapshot;
+	friend class MemoryReport;
+	friend class CareBatch;
+
 protected:
 	/**
-	 * Name of the plant.
+	 * Id stored for an unset season, state or strategy.
 	 */
-	Flyweight<std::string *> *name;
+	static const uint16_t NO_STRING = 0xFFFF;
+	static const uint8_t NO_FLYWEIGHT = 0xFF;
 
 	PlantComponent *decorator;
-	int age;
-	int health;
-	int waterLevel;
-	int sunExposure;
 
 	/**
-	 * Growing season for the plant.
+	 * Name of the plant (index into the Inventory's string flyweights).
+	 * The plant holds a reference on its name and season strings so the
+	 * pool never reclaims them while it lives.
+	 */
+	uint16_t name;
+
+	/**
+	 * Growing season for the plant (string flyweight index, or NO_STRING).
+	 */
+	uint16_t season;
+
+	uint16_t age; ///< Saturates at 65535 days
+	uint8_t health;
+	uint8_t waterLevel;
+	uint8_t sunExposure;
+
+	// Flyweight indices into the Inventory's state and strategy caches, or NO_FLYWEIGHT
+	uint8_t maturityState;
+	uint8_t waterStrategy;
+	uint8_t sunStrategy;
+
+	/**
+	 * @brief Rendered info text and the infoVersion it was rendered at.
+	 */
+	struct CachedInfo
+	{
+		std::string text;
+		uint32_t version;
+	};
+
+	/**
+	 * Bumped by invalidateInfo(); the ticker and the UI may both change a
+	 * plant, so a render publishes its text with the version read before it.
+	 * 32 bits, so a cached entry cannot come back into date by wrapping.
+	 */
+	std::atomic<uint32_t> infoVersion;
+
+	/**
+	 * Last rendered info, or null. A reader owns the entry while it holds
+	 * it: takeInfo() swaps in null and keepInfo() puts it back.
+	 */
+	std::atomic<CachedInfo *> cachedInfo;
+
+	CachedInfo *takeInfo();
+	void keepInfo(CachedInfo *cached);
+
+	/**
+	 * @brief Renders the plant's info card and totals, uncached.
 	 */
-	Flyweight<std::string *> *season;
+	void renderInfo(InfoBuffer &out);
 
-	Flyweight<MaturityState *> *maturityState;
-	Flyweight<WaterStrategy *> *waterStrategy;
-	Flyweight<SunStrategy *> *sunStrategy;
-    
+	/**
+	 * @brief Narrows a state or strategy flyweight to the id stored in a plant.
+	 * @throws const char* if the cache has grown past what a plant can index.
+	 */
+	static uint8_t smallIndex(uint16_t index);
+
+	/**
+	 * @brief Replaces the name flyweight, moving the plant's reference to the new one.
+	 */
+	void setNameFlyweight(Flyweight<std::string *> *name);
 
 public:
 	/**
@@ -127,6 +182,18 @@ public:
 	 */
 	void setSunExposure(int sunExposure);
 
+	/**
+	 * @brief Adds the same amount of water to every plant, like setWaterLevel(getWaterLevel() + amount) on each.
+	 *
+	 * The loop behind the fixed-amount strategies' WaterStrategy::waterAll().
+	 */
+	static void addWaterToAll(LivingPlant *const *plants, std::size_t count, int amount);
+
+	/**
+	 * @brief Adds the same sun exposure to every plant, like setSunExposure(getSunExposure() + amount) on each.
+	 */
+	static void addSunToAll(LivingPlant *const *plants, std::size_t count, int amount);
+
 	/**
 
 	 * @brief Sets the water strategy for this plant.
@@ -158,6 +225,24 @@ public:
 	 */
 	Flyweight<std::string *> *getSeason();
 
+	/**
+	 * @brief Gets the maturity state flyweight of the plant.
+	 * @return Shared MaturityState flyweight, or nullptr if none was assigned.
+	 */
+	Flyweight<MaturityState *> *getMaturity();
+
+	/**
+	 * @brief Gets the water strategy flyweight of the plant.
+	 * @return Shared WaterStrategy flyweight, or nullptr if none was assigned.
+	 */
+	Flyweight<WaterStrategy *> *getWaterStrategy();
+
+	/**
+	 * @brief Gets the sun strategy flyweight of the plant.
+	 * @return Shared SunStrategy flyweight, or nullptr if none was assigned.
+	 */
+	Flyweight<SunStrategy *> *getSunStrategy();
+
 	/**
 	 * @brief Gets the component type (LIVING_PLANT).
 	 *
@@ -179,6 +264,17 @@ public:
 	 */
 	std::string getName() ;
 
+	/**
+	 * @brief Gets the plant's interned name without copying it.
+	 */
+	const std::string &getNameView();
+
+	/**
+	 * @brief Gets the interned season name without copying it.
+	 * @return The season name, or an empty string if no season was assigned.
+	 */
+	const std::string &getSeasonView();
+
 	/**
 	 * @brief Gets plant health as an Integer.
 	 * @return Integer containing plant health.
@@ -221,10 +317,24 @@ public:
 	double getPrice() ;
 
 	/**
-	 * @brief Gets plant information as a string.
-	 * @return String containing plant details.
+	 * @brief Renders plant information.
+	 *
+	 * The text is cached in the plant and only rendered again after
+	 * invalidateInfo(), so redrawing an unchanged plant is a copy. A render
+	 * that races an invalidation keeps the older version, so the next call
+	 * renders again. Streaming buffers use the cache but do not fill it.
+	 *
+	 * @param out Buffer receiving the plant details.
 	 */
-	std::string getInfo() ;
+	void writeInfo(InfoBuffer &out);
+
+	/**
+	 * @brief Marks the cached info as stale. Safe from any thread.
+	 *
+	 * Called by every setter and by decorators whose layers change; anything
+	 * else that changes what getInfo() shows must call it too.
+	 */
+	void invalidateInfo();
 
 	/**
 	 * @brief Clones the plant creating a deep copy (Prototype pattern).
@@ -232,6 +342,42 @@ public:
 	 */
 	virtual PlantComponent *clone() ;
 
+	/**
+	 * @brief Gets the size of this plant's concrete type, for cloneInto().
+	 */
+	virtual std::size_t getCloneSize() const;
+
+	/**
+	 * @brief Copy-constructs this plant into caller-provided storage.
+	 *
+	 * Lets SharedDecorator place a cloned plant and its decorator in one
+	 * allocation. The storage must hold getCloneSize() bytes.
+	 *
+	 * @return The copy, living in memory.
+	 */
+	virtual LivingPlant *cloneInto(void *memory);
+
+	/**
+	 * @brief Allocates a plant with the global operator new, pairing with operator delete below.
+	 */
+	static void *operator new(std::size_t size);
+
+	/**
+	 * @brief Constructs a plant in storage someone else owns (see cloneInto()).
+	 *
+	 * Declared because a class operator new hides the global placement form.
+	 */
+	static void *operator new(std::size_t size, void *memory);
+
+	/**
+	 * @brief Releases a plant's storage.
+	 *
+	 * A plant cloned by SharedDecorator heads the allocation it shares with
+	 * its decorator, so deleting the plant frees both. Declared unsized so
+	 * that allocation size, not the plant type's size, is what is released.
+	 */
+	static void operator delete(void *memory);
+
 	/**
 	 * @brief Waters the plant component.
 	 */
@@ -294,7 +440,7 @@ virtual int getSunlightValue();
  */
 virtual void tick();
 
-	virtual Flyweight<std::string *> *getNameFlyweight() { return this->name; };
+	virtual Flyweight<std::string *> *getNameFlyweight();
 	
 virtual string getImageStr();
 
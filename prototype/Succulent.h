@@ -59,6 +59,10 @@ class Succulent : public LivingPlant
 		 * @return Pointer to a new Succulent object that is a copy of this one.
 		 */
 		PlantComponent* clone();
+
+		std::size_t getCloneSize() const;
+
+		LivingPlant *cloneInto(void *memory);
 };
 
 #endif
@@ -0,0 +1,61 @@
+#include "SimulationRandom.h"
+#include <chrono>
+
+std::mutex SimulationRandom::lock;
+std::mt19937 SimulationRandom::engines[static_cast<int>(SimulationRandom::Stream::COUNT)];
+uint32_t SimulationRandom::currentSeed = 0;
+bool SimulationRandom::seeded = false;
+bool SimulationRandom::deterministic = false;
+
+void SimulationRandom::reseed(uint32_t baseSeed)
+{
+	currentSeed = baseSeed;
+	for (int stream = 0; stream < static_cast<int>(Stream::COUNT); stream++)
+	{
+		// Same base seed, different stream number: unrelated sequences
+		std::seed_seq sequence{baseSeed, static_cast<uint32_t>(stream)};
+		engines[stream].seed(sequence);
+	}
+	seeded = true;
+}
+
+void SimulationRandom::seed(uint32_t baseSeed)
+{
+	std::lock_guard<std::mutex> guard(lock);
+	reseed(baseSeed);
+	deterministic = true;
+}
+
+void SimulationRandom::seedFromClock()
+{
+	std::lock_guard<std::mutex> guard(lock);
+	reseed(static_cast<uint32_t>(std::chrono::system_clock::now().time_since_epoch().count()));
+	deterministic = false;
+}
+
+bool SimulationRandom::isDeterministic()
+{
+	std::lock_guard<std::mutex> guard(lock);
+	return deterministic;
+}
+
+uint32_t SimulationRandom::getSeed()
+{
+	std::lock_guard<std::mutex> guard(lock);
+	return currentSeed;
+}
+
+std::size_t SimulationRandom::pick(Stream stream, std::size_t count)
+{
+	if (count == 0)
+	{
+		throw "Cannot pick from an empty range";
+	}
+
+	std::lock_guard<std::mutex> guard(lock);
+	if (!seeded)
+	{
+		reseed(static_cast<uint32_t>(std::chrono::system_clock::now().time_since_epoch().count()));
+	}
+	return engines[static_cast<int>(stream)]() % count;
+}
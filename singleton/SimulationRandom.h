@@ -0,0 +1,91 @@
+#ifndef PHOTOSYNTECH_SIMULATIONRANDOM_H
+#define PHOTOSYNTECH_SIMULATIONRANDOM_H
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <random>
+
+/**
+ * @brief Process-wide random source with one independent stream per subsystem.
+ *
+ * Replaces the std::rand()/std::srand(time) calls in the mediators so a
+ * simulation run can be reproduced exactly. Each Stream has its own
+ * std::mt19937 derived from a single base seed, so adding draws in one
+ * subsystem (e.g. more suggestions) never shifts the sequence another
+ * subsystem sees.
+ *
+ * **System Role:**
+ * Randomness provider for staff selection on the sales and suggestion floors
+ * and for staff recommendations. By default it is seeded from the clock, like
+ * the code it replaces; seed() switches to deterministic mode for tests,
+ * benchmarks and SimulationRecording replays.
+ *
+ * **Pattern Role:** Monostate (all state is static, shared by every caller)
+ *
+ * **Related Patterns:**
+ * - Singleton: Process-wide like the Inventory
+ * - Mediator: SalesFloor and SuggestionFloor draw staff assignments from it
+ * - Memento: SimulationRecording stores the seed and reseeds before replay
+ *
+ * Draws are serialised by a mutex, so the ticker thread and the UI can share
+ * it. Indices are taken from the raw engine output (whose sequence the
+ * standard fixes) rather than a distribution, so a seed produces the same
+ * picks with every standard library.
+ *
+ * @see SimulationRecording
+ */
+class SimulationRandom
+{
+	public:
+		/**
+		 * @brief Independent random streams, one per consumer.
+		 */
+		enum class Stream
+		{
+			SALES_FLOOR,		  ///< Staff chosen to process a purchase
+			SUGGESTION_FLOOR,	  ///< Staff chosen to answer a suggestion request
+			STAFF_RECOMMENDATION, ///< Plant a staff member recommends
+			STAFF_COMMENT,		  ///< Small-talk line attached to a recommendation
+			COUNT
+		};
+
+		/**
+		 * @brief Reseeds every stream from one base seed and enables deterministic mode.
+		 */
+		static void seed(uint32_t baseSeed);
+
+		/**
+		 * @brief Reseeds every stream from the clock and leaves deterministic mode.
+		 */
+		static void seedFromClock();
+
+		/**
+		 * @brief Checks whether the streams were seeded explicitly.
+		 */
+		static bool isDeterministic();
+
+		/**
+		 * @brief Gets the base seed the streams were last derived from.
+		 */
+		static uint32_t getSeed();
+
+		/**
+		 * @brief Draws an index in [0, count) from a stream.
+		 * @param stream Consumer making the draw.
+		 * @param count Number of choices; must be greater than 0.
+		 * @throws const char* if count is 0.
+		 */
+		static std::size_t pick(Stream stream, std::size_t count);
+
+	private:
+		static void reseed(uint32_t baseSeed);
+
+		static std::mutex lock;
+		static std::mt19937 engines[static_cast<int>(Stream::COUNT)];
+		static uint32_t currentSeed;
+		static bool seeded;
+		static bool deterministic;
+};
+
+#endif //PHOTOSYNTECH_SIMULATIONRANDOM_H
@@ -6,7 +6,49 @@
 #include "../composite/PlantGroup.h"
 #include "../mediator/Customer.h"
 #include "../mediator/Staff.h"
-Inventory *Inventory::instance = nullptr;
+#include "../iterator/PlantQuery.h"
+#include "../memento/InventoryJournal.h"
+#include "../memento/SimulationRecording.h"
+#include "../diagnostics/AllocationTracker.h"
+#include "../diagnostics/TickProfiler.h"
+#include "../diagnostics/Tracer.h"
+#include <mutex>
+
+namespace
+{
+    /**
+     * @brief Interned strings shared by every Inventory the process creates.
+     *
+     * Never destroyed: plants and decorators alive after the Inventory (or
+     * during static destruction) must still be able to release their names.
+     */
+    struct StringPool
+    {
+        std::mutex lock;
+        FlyweightFactory<string, string *> strings;
+        std::size_t internedSinceReclaim;
+
+        StringPool() : internedSinceReclaim(0) {}
+
+        static StringPool &get()
+        {
+            static StringPool *instance = new StringPool();
+            return *instance;
+        }
+    };
+
+    const char *SEASON_NAMES[] = {"Winter Season", "Summer Season", "Spring Season", "Autumn Season"};
+
+    // Serialises creating the Inventory; lookups of an existing one never take it
+    std::mutex &instanceLock()
+    {
+        static std::mutex *lock = new std::mutex();
+        return *lock;
+    }
+}
+
+const std::size_t Inventory::STRING_RECLAIM_INTERVAL;
+std::atomic<Inventory *> Inventory::instance(nullptr);
 thread *Inventory::TickerThread = nullptr;
 std::atomic<bool> Inventory::on(false);
 int Inventory::timeBetweenTicks = 2;
@@ -14,9 +56,13 @@ int Inventory::timeBetweenTicks = 2;
 Inventory::Inventory()
 {
     on.store(false);
+    journal.store(nullptr);
+    recording.store(nullptr);
+    seasonTicks = 0;
+    profiler = new TickProfiler();
     inventory = new PlantGroup();
 
-    stringFactory = new FlyweightFactory<string, string *>();
+    stringFactory = &StringPool::get().strings;
     waterStrategies = new FlyweightFactory<int, WaterStrategy *>();
     sunStrategies = new FlyweightFactory<int, SunStrategy *>();
     states = new FlyweightFactory<int, MaturityState *>();
@@ -40,10 +86,10 @@ Inventory::Inventory()
     states->getFlyweight(Mature::getID(), new Mature());
     states->getFlyweight(Dead::getID(), new Dead());
 
-    getString("Winter Season");
+    // Every plant with a season points at one of these; never reclaim or count them
+    for (const char *season : SEASON_NAMES)
+        getString(season)->pin();
     this->currentSeason = getString("Summer Season");
-    getString("Spring Season");
-    getString("Autumn Season");
 }
 Inventory::~Inventory()
 {
@@ -53,10 +99,10 @@ Inventory::~Inventory()
     if (inventory)
         delete inventory;
 
-    delete stringFactory;
     delete waterStrategies;
     delete sunStrategies;
     delete states;
+    delete profiler;
 
     std::vector<Staff *>::iterator itr = staffList->begin();
     while (!(itr == staffList->end()))
@@ -80,28 +126,111 @@ Inventory::~Inventory()
     delete staffList;
     delete customerList;
     TickerThread = NULL;
-    instance = NULL;
+    instance.store(nullptr, std::memory_order_release);
 }
 Inventory *Inventory::getInstance()
 {
-    if (!instance)
+    Inventory *current = instance.load(std::memory_order_acquire);
+    if (current)
     {
-        instance = new Inventory();
+        return current;
     }
 
-    return instance;
+    std::lock_guard<std::mutex> guard(instanceLock());
+    current = instance.load(std::memory_order_relaxed);
+    if (!current)
+    {
+        current = new Inventory();
+        instance.store(current, std::memory_order_release);
+    }
+    return current;
 }
 
 Flyweight<std::string *> *Inventory::getString(std::string str)
 {
+    StringPool &pool = StringPool::get();
+    std::lock_guard<std::mutex> guard(pool.lock);
+    if (Flyweight<std::string *> *fly = stringFactory->find(str))
+    {
+        return fly;
+    }
+
+    // At most one reclaim per call: each advances the epoch, and two in a row would
+    // free strings another thread has just found but not yet retained
+    bool reclaimed = false;
+    if (++pool.internedSinceReclaim >= STRING_RECLAIM_INTERVAL)
+    {
+        pool.internedSinceReclaim = 0;
+        stringFactory->reclaim();
+        reclaimed = true;
+    }
+
     string *flyweightData = new string(str);
-    Flyweight<std::string *> *fly = stringFactory->getFlyweight(*flyweightData, flyweightData);
-    if (fly->getState() != flyweightData)
+    try
+    {
+        return stringFactory->getFlyweight(*flyweightData, flyweightData);
+    }
+    catch (const char *)
+    {
+        // Full: free what has been idle since the last pass and try once more
+        if (reclaimed)
+        {
+            delete flyweightData;
+            throw;
+        }
+    }
+    try
+    {
+        pool.internedSinceReclaim = 0;
+        stringFactory->reclaim();
+        return stringFactory->getFlyweight(*flyweightData, flyweightData);
+    }
+    catch (const char *)
     {
         delete flyweightData;
+        throw;
     }
+}
+
+Flyweight<std::string *> *Inventory::findString(const std::string &str)
+{
+    std::lock_guard<std::mutex> guard(StringPool::get().lock);
+    return stringFactory->find(str);
+}
+
+Flyweight<std::string *> *Inventory::findAndRetainString(const std::string &str)
+{
+    std::lock_guard<std::mutex> guard(StringPool::get().lock);
+    Flyweight<std::string *> *fly = stringFactory->find(str);
+    if (fly)
+        fly->retain();
     return fly;
 }
+
+Flyweight<std::string *> *Inventory::getMissingString()
+{
+    // Index NO_STRING in plant terms; never destroyed, like the pool
+    static Flyweight<std::string *> *missing = new Flyweight<std::string *>(new string(), FlyweightFactory<string, string *>::MAX_SIZE);
+    return missing;
+}
+
+std::size_t Inventory::reclaimStrings()
+{
+    StringPool &pool = StringPool::get();
+    std::lock_guard<std::mutex> guard(pool.lock);
+    pool.internedSinceReclaim = 0;
+    return stringFactory->reclaim();
+}
+
+void Inventory::retainString(std::size_t index)
+{
+    StringPool::get().strings.at(index)->retain();
+}
+
+void Inventory::releaseString(std::size_t index)
+{
+    StringPool::get().strings.at(index)->release();
+}
 Flyweight<WaterStrategy *> *Inventory::getWaterFly(int id)
 {
 
@@ -146,6 +275,11 @@ PlantGroup *Inventory::getInventory()
     return inventory;
 }
 
+PlantQuery Inventory::query()
+{
+    return PlantQuery(inventory->getPlants());
+}
+
 vector<Customer *> *Inventory::getCustomers()
 {
     return customerList;
@@ -211,22 +345,57 @@ bool Inventory::stopTicker()
         return false;
 }
 
+bool Inventory::isTickerRunning()
+{
+    return on.load();
+}
+
 void Inventory::TickInventory()
 {
-    int count = 0;
-    
+    TRACE_THREAD_NAME("ticker");
     while (on.load())
     {
-        
-        this->inventory->tick();
+        tickOnce();
         std::this_thread::sleep_for(std::chrono::seconds(timeBetweenTicks));
-        if (count == 8)
+    }
+}
+
+void Inventory::tickOnce()
+{
+    AllocationTracker::TagScope tag(AllocationTracker::Tag::TICK);
+    TRACE_SCOPE("tick", "inventory");
+    profiler->beginTick();
+    this->inventory->tick();
+    if (seasonTicks == 8)
+    {
+        TickProfiler::PhaseTimer timer(TickProfiler::Phase::SEASON);
+        changeSeason();
+        seasonTicks = 0;
+    }
+    seasonTicks++;
+
+    if (SimulationRecording *active = recording.load())
+        active->recordTick();
+    // A quiet nursery may not fill a batch for a long time
+    if (InventoryJournal *active = journal.load())
+    {
+        try
         {
-            changeSeason();
-            count = 0;
-       
-        }     count++;
+            active->commitIfDue();
+        }
+        catch (const char *)
+        {
+            // The batch stays pending and is retried on the next tick
+        }
     }
+    profiler->endTick();
+}
+
+void Inventory::resetSimulationState()
+{
+    seasonTicks = 0;
+    getWaterFly(AlternatingWater::getID())->getState()->reset();
+    getSunFly(AlternatingSun::getID())->getState()->reset();
 }
 
 Flyweight<string *> *Inventory::getSeason()
@@ -252,5 +421,40 @@ void Inventory::changeSeason()
     {
         currentSeason = getString("Summer Season");
     }
+
+    if (InventoryJournal *active = journal.load())
+    {
+        active->recordSeasonChange(*currentSeason->getState());
+    }
     return;
-}
\ No newline at end of file
+}
+
+void Inventory::setJournal(InventoryJournal *journal)
+{
+    this->journal.store(journal);
+}
+
+InventoryJournal *Inventory::getJournal()
+{
+    return journal.load();
+}
+
+void Inventory::setRecording(SimulationRecording *recording)
+{
+    this->recording.store(recording);
+}
+
+SimulationRecording *Inventory::getRecording()
+{
+    return recording.load();
+}
+
+TickMetrics Inventory::getMetrics()
+{
+    return profiler->getMetrics();
+}
+
+TickProfiler *Inventory::getProfiler()
+{
+    return profiler;
+}
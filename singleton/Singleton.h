@@ -63,13 +63,25 @@ class WaterStrategy;
 class SunStrategy;
 class MaturityState;
 class PlantGroup;
+class PlantQuery;
 class Staff;
+class InventorySnapshot;
+class InventoryJournal;
+class SimulationRecording;
+class TickProfiler;
+struct TickMetrics;
 class Inventory
 
 {
+	friend class InventorySnapshot;
+	friend class InventoryJournal;
+	friend class MemoryReport;
+
 private:
-	static Inventory *instance;
+	// Published once fully constructed, so threads racing on first use share one Inventory
+	static atomic<Inventory *> instance;
 	PlantGroup *inventory;
+	// Process-wide pool; outlives the Inventory so plants can always resolve and release their names
 	FlyweightFactory<std::string, string *> *stringFactory;
 	FlyweightFactory<int, WaterStrategy *> *waterStrategies;
 	FlyweightFactory<int, SunStrategy *> *sunStrategies;
@@ -79,6 +91,14 @@ private:
 
 	vector<Staff *> *staffList;
 	vector<Customer *> *customerList;
+
+	atomic<InventoryJournal *> journal;
+	atomic<SimulationRecording *> recording;
+
+	TickProfiler *profiler;
+
+	// Ticks since the last season change
+	int seasonTicks;
 	/**
 	 * @brief Private constructor to prevent direct instantiation.
 	 */
@@ -93,17 +113,80 @@ private:
 public:
 	/**
 	 * @brief Retrieves the singleton instance of Inventory.
+	 *
+	 * Safe to call from several threads at once; the first caller creates
+	 * the Inventory and the others wait for it. Deleting the Inventory while
+	 * other threads still use it is not supported.
+	 *
 	 * @return Pointer to the single Inventory instance.
 	 */
 	static Inventory *getInstance();
 
+	/**
+	 * @brief Number of new strings interned between automatic reclaimStrings() passes.
+	 */
+	static const std::size_t STRING_RECLAIM_INTERVAL = 1024;
+
 	/**
 	 * @brief Retrieves a flyweight for a season name.
+	 *
+	 * Interns the string if needed, running at most one reclaim pass.
+	 * Callers that keep the flyweight beyond the current operation must
+	 * retain() it (plants and decorators do); otherwise a later
+	 * reclaimStrings() may free it.
+	 *
 	 * @param season Season name string.
 	 * @return Flyweight wrapping the season string.
+	 * @throws const char* if the pool is full even after reclaiming.
 	 */
 	Flyweight<std::string *> *getString(std::string season);
 
+	/**
+	 * @brief Looks up an interned string without interning it.
+	 *
+	 * For filters (iterators, queries) built from arbitrary user text: a
+	 * string no plant carries cannot match anything, so there is no reason
+	 * to add it to the pool.
+	 *
+	 * @return The flyweight, or nullptr if the string is not interned.
+	 */
+	Flyweight<std::string *> *findString(const std::string &str);
+
+	/**
+	 * @brief Looks up an interned string and retains it before any reclaim can run.
+	 *
+	 * For filters that keep the flyweight; they release() it when done.
+	 *
+	 * @return The retained flyweight, or nullptr if the string is not interned.
+	 */
+	Flyweight<std::string *> *findAndRetainString(const std::string &str);
+
+	/**
+	 * @brief Gets a flyweight that is not in the pool, so no plant ever carries it.
+	 *
+	 * Filters on a string findString() does not know use it to match nothing.
+	 */
+	static Flyweight<std::string *> *getMissingString();
+
+	/**
+	 * @brief Frees interned strings nothing has retained or looked up for a whole epoch.
+	 *
+	 * Runs automatically every STRING_RECLAIM_INTERVAL new strings and when
+	 * the pool fills up. See FlyweightFactory::reclaim().
+	 *
+	 * @return Number of strings freed.
+	 */
+	std::size_t reclaimStrings();
+
+	/**
+	 * @brief Takes or drops a reference on an interned string by index.
+	 *
+	 * For compact plants, which only keep the index. Static so plants can
+	 * still release their names while no Inventory exists.
+	 */
+	static void retainString(std::size_t index);
+	static void releaseString(std::size_t index);
+
 	/**
 	 * @brief Retrieves a flyweight for a water strategy level.
 	 * @param level Integer identifier for water strategy.
@@ -126,12 +209,34 @@ public:
 	 */
 	Flyweight<MaturityState *> *getStates(int id);
 
+	/**
+	 * @brief Looks up flyweights by their dense index (Flyweight::getIndex()).
+	 *
+	 * Constant time; this is how compact plants resolve their name, season,
+	 * state and strategy ids. The index must come from a flyweight of the
+	 * same cache.
+	 */
+	Flyweight<std::string *> *getStringAt(std::size_t index) { return stringFactory->at(index); }
+	Flyweight<WaterStrategy *> *getWaterFlyAt(std::size_t index) { return waterStrategies->at(index); }
+	Flyweight<SunStrategy *> *getSunFlyAt(std::size_t index) { return sunStrategies->at(index); }
+	Flyweight<MaturityState *> *getStateAt(std::size_t index) { return states->at(index); }
+
 	/**
 	 * @brief Gets the root plant inventory group.
 	 * @return Pointer to the root PlantGroup.
 	 */
 	PlantGroup *getInventory();
 
+	/**
+	 * @brief Starts a composable query over the whole inventory.
+	 *
+	 * Example: `query().state(Mature::getID()).waterBelow(20).limit(50).execute()`.
+	 * Include "iterator/PlantQuery.h" to use the returned object.
+	 *
+	 * @return PlantQuery rooted at the inventory's plant list.
+	 */
+	PlantQuery query();
+
 	/**
 	 * @brief Retrieves the list of registered customers.
 	 * @return Pointer to vector of Customer pointers.
@@ -170,6 +275,11 @@ public:
 	 */
 	static bool stopTicker();
 
+	/**
+	 * @brief Checks whether the background ticker is running.
+	 */
+	static bool isTickerRunning();
+
 	/**
 	 * @brief Destructor. Cleans up all managed resources.
 	 */
@@ -178,6 +288,67 @@ public:
 	Flyweight<string *> *getSeason();
 
 	void changeSeason();
+
+	/**
+	 * @brief Advances the simulation by one tick: ticks every plant and
+	 * periodically moves to the next season.
+	 *
+	 * This is the ticker thread's step. Calling it directly (with the ticker
+	 * stopped) runs the simulation at full speed without wall-clock sleeps.
+	 */
+	void tickOnce();
+
+	/**
+	 * @brief Clears simulation state that snapshots do not capture.
+	 *
+	 * Resets the season tick counter and the cycles of the shared alternating
+	 * water and sun strategies, so two runs from the same snapshot and seed
+	 * tick identically.
+	 */
+	void resetSimulationState();
+
+	/**
+	 * @brief Sets the recording that logs ticks (nullptr to stop recording).
+	 *
+	 * The Inventory does not own the recording.
+	 */
+	void setRecording(SimulationRecording *recording);
+
+	/**
+	 * @brief Gets the active simulation recording.
+	 * @return The recording, or nullptr if ticks are not being recorded.
+	 */
+	SimulationRecording *getRecording();
+
+	/**
+	 * @brief Sets the journal that records inventory mutations (nullptr to stop recording).
+	 *
+	 * The Inventory does not own the journal. Plants report state transitions and
+	 * the ticker reports season changes through it.
+	 */
+	void setJournal(InventoryJournal *journal);
+
+	/**
+	 * @brief Gets the active mutation journal.
+	 * @return The journal, or nullptr if mutations are not being recorded.
+	 */
+	InventoryJournal *getJournal();
+
+	/**
+	 * @brief Gets per-phase tick timings and per-tick event counts.
+	 *
+	 * Safe to call while the ticker runs. Include "diagnostics/TickProfiler.h"
+	 * to use the result.
+	 *
+	 * @return Copy of the profiler's current statistics.
+	 */
+	TickMetrics getMetrics();
+
+	/**
+	 * @brief Gets the profiler fed by tickOnce(), e.g. to reset it or enable periodic dumps.
+	 */
+	TickProfiler *getProfiler();
+
 	static void updateTickerRate(int time) { timeBetweenTicks = time; }
 };
 #endif
\ No newline at end of file
@@ -8,8 +8,6 @@ void Dead::grow(LivingPlant *plant)
 
 std::string Dead::getImagePath(LivingPlant *plant)
 {
-    std::string plantName = plant->getName();
-    plantName.erase(std::remove(plantName.begin(), plantName.end(), ' '), plantName.end());
-    return "../external/ftxui-image-view/imgs/" + plantName + std::to_string(getID()) + ".png";
+    return imagePath(plant, getID());
 }
 
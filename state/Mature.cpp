@@ -57,8 +57,5 @@ void Mature::grow(LivingPlant *plant)
 }
 std::string Mature::getImagePath(LivingPlant *plant)
 {
-  std::string plantName = plant->getName();
-  plantName.erase(std::remove(plantName.begin(), plantName.end(), ' '),
-                  plantName.end());
-  return "../external/ftxui-image-view/imgs/" + plantName + std::to_string(getID()) + ".png";
+  return imagePath(plant, getID());
 }
\ No newline at end of file
@@ -4,4 +4,22 @@ const int MaturityState::getID()
 {
   
     return -1;
-}
\ No newline at end of file
+}
+
+std::string MaturityState::imagePath(LivingPlant *plant, int stateId)
+{
+    static const char prefix[] = "../external/ftxui-image-view/imgs/";
+    const std::string &plantName = plant->getNameView();
+    std::string id = std::to_string(stateId);
+
+    std::string path;
+    path.reserve(sizeof(prefix) - 1 + plantName.size() + id.size() + 4);
+    path.append(prefix);
+    for (char c : plantName)
+    {
+        if (c != ' ')
+            path.push_back(c);
+    }
+    path.append(id).append(".png");
+    return path;
+}
@@ -46,5 +46,18 @@ public:
 	static const int getID();
 
 	virtual const string getName(){return "Base State";};
+
+protected:
+	/**
+	 * @brief Builds the image path for a plant in a state.
+	 *
+	 * Reads the plant's interned name in place and drops its spaces while
+	 * appending, so the only allocation is the returned path.
+	 *
+	 * @param plant Pointer to the LivingPlant
+	 * @param stateId Identifier of the state the image shows
+	 * @return Image file path as a string
+	 */
+	static std::string imagePath(LivingPlant *plant, int stateId);
 };
 #endif /* MaturityState_h */
\ No newline at end of file
@@ -51,11 +51,7 @@ void Seed::grow(LivingPlant *plant) {
 }
 
 std::string Seed::getImagePath(LivingPlant *plant) {
-  
-  std::string plantName = plant->getName();
-  plantName.erase(std::remove(plantName.begin(), plantName.end(), ' '),
-                  plantName.end());
-  return "../external/ftxui-image-view/imgs/" + plantName + std::to_string(getID()) + ".png";
+  return imagePath(plant, getID());
 }
 
 
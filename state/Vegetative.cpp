@@ -53,9 +53,6 @@ void Vegetative::grow(LivingPlant *plant) {
 }
 
 std::string Vegetative::getImagePath(LivingPlant *plant) {
-  std::string plantName = plant->getName();
-  plantName.erase(std::remove(plantName.begin(), plantName.end(), ' '),
-                  plantName.end());
-  return "../external/ftxui-image-view/imgs/" + plantName + std::to_string(getID()) + ".png";
+  return imagePath(plant, getID());
 }
 
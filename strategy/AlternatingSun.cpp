@@ -2,10 +2,7 @@
 #include "../prototype/LivingPlant.h"
 
 int AlternatingSun::addSun(LivingPlant* plant) {
-    intensity= intensity == 4 ? 6 : 4;
-    hoursNeeded = hoursNeeded == 4 ? 6 : 4;
-
-    int applied = intensity * hoursNeeded;
+    int applied = nextExposure();
          plant->setSunExposure(plant->getSunExposure() + applied);
     return applied;
 }
@@ -17,4 +14,21 @@ int AlternatingSun::getID() {
 AlternatingSun::AlternatingSun() {
     intensity = 4;   
     hoursNeeded = 4; 
-}
\ No newline at end of file
+}
+
+void AlternatingSun::reset() {
+    intensity = 4;
+    hoursNeeded = 4;
+}
+
+void AlternatingSun::addSunAll(LivingPlant* const* plants, std::size_t count) {
+    for (std::size_t i = 0; i < count; i++) {
+        LivingPlant::addSunToAll(plants + i, 1, nextExposure());
+    }
+}
+
+int AlternatingSun::nextExposure() {
+    intensity = intensity == 4 ? 6 : 4;
+    hoursNeeded = hoursNeeded == 4 ? 6 : 4;
+    return intensity * hoursNeeded;
+}
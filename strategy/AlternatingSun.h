@@ -18,6 +18,11 @@ class AlternatingSun : public SunStrategy
 		 */
 		int addSun(LivingPlant* plant);
 
+		/**
+		 * @brief Gives a batch of plants sun in one loop, continuing the cycle plant by plant.
+		 */
+		void addSunAll(LivingPlant* const* plants, std::size_t count);
+
 		/**
 		 * @brief Gets the unique identifier for the AlternatingSun strategy.
 		 * @return Integer ID representing the AlternatingSun strategy.
@@ -30,6 +35,18 @@ class AlternatingSun : public SunStrategy
 		 * Default sets intensity to alternating levels and hoursNeeded to alternating durations.
 		 */
 		AlternatingSun();
+
+		/**
+		 * @brief Restarts the sun cycle at its first intensity and duration.
+		 */
+		void reset();
+
+	private:
+		/**
+		 * @brief Advances the cycle one step; shared by addSun() and addSunAll().
+		 * @return The exposure for the new step.
+		 */
+		int nextExposure();
 };
 
 #endif
@@ -4,11 +4,7 @@
 
 int AlternatingWater::water(LivingPlant* plant) {
     
-   if (waterAmount < 40) {
-      waterAmount+=5;
-    } else {
-        waterAmount = 20; 
-    }
+    nextAmount();
     
     plant->setWaterLevel(plant->getWaterLevel() + waterAmount);
     return waterAmount;
@@ -21,4 +17,23 @@ int AlternatingWater::getID() {
 AlternatingWater::AlternatingWater() {
     waterAmount = 20;
    
-}
\ No newline at end of file
+}
+
+void AlternatingWater::reset() {
+    waterAmount = 20;
+}
+
+void AlternatingWater::waterAll(LivingPlant* const* plants, std::size_t count) {
+    for (std::size_t i = 0; i < count; i++) {
+        LivingPlant::addWaterToAll(plants + i, 1, nextAmount());
+    }
+}
+
+int AlternatingWater::nextAmount() {
+    if (waterAmount < 40) {
+        waterAmount += 5;
+    } else {
+        waterAmount = 20;
+    }
+    return waterAmount;
+}
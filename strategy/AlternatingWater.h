@@ -42,6 +42,11 @@ class AlternatingWater : public WaterStrategy
          */
         int water(LivingPlant* plant);
 
+        /**
+         * @brief Waters a batch of plants in one loop, continuing the cycle plant by plant.
+         */
+        void waterAll(LivingPlant *const *plants, std::size_t count);
+
         /**
          * @brief Gets the unique identifier for the AlternatingWater strategy.
          * @return Integer ID representing the AlternatingWater strategy.
@@ -55,6 +60,18 @@ class AlternatingWater : public WaterStrategy
    * prepares internal cycle state (implementation-owned).
    */
   AlternatingWater();
+
+  /**
+   * @brief Restarts the watering cycle at its first amount.
+   */
+  void reset();
+
+    private:
+        /**
+         * @brief Advances the cycle one step; shared by water() and waterAll().
+         * @return The amount for the new step.
+         */
+        int nextAmount();
 };
 
 #endif
@@ -15,3 +15,7 @@ HighSun::HighSun() {
     intensity = 9;  
     hoursNeeded = 8; 
 }
+
+void HighSun::addSunAll(LivingPlant* const* plants, std::size_t count) {
+    LivingPlant::addSunToAll(plants, count, intensity * hoursNeeded);
+}
@@ -41,6 +41,11 @@ class HighSun : public SunStrategy
 		 */
 		int addSun(LivingPlant* plant);
 
+		/**
+		 * @brief Gives a batch of plants sun in one loop, skipping the per-plant virtual calls.
+		 */
+		void addSunAll(LivingPlant* const* plants, std::size_t count);
+
 		/**
 		 * @brief Gets the unique identifier for the HighSun strategy.
 		 * @return Integer ID representing the HighSun strategy.
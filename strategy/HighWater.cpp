@@ -14,4 +14,9 @@ int HighWater::water(LivingPlant* plant) {
 
 HighWater::HighWater() {
     waterAmount = 25; 
-}
\ No newline at end of file
+}
+
+void HighWater::waterAll(LivingPlant *const *plants, std::size_t count)
+{
+    LivingPlant::addWaterToAll(plants, count, waterAmount);
+}
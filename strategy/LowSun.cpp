@@ -15,3 +15,7 @@ LowSun::LowSun() {
     intensity = 4;    
     hoursNeeded = 3; 
 }
+
+void LowSun::addSunAll(LivingPlant* const* plants, std::size_t count) {
+    LivingPlant::addSunToAll(plants, count, intensity * hoursNeeded);
+}
@@ -17,4 +17,9 @@ int LowWater::getID()
 LowWater::LowWater()
 {
     waterAmount = 15;
-}
\ No newline at end of file
+}
+
+void LowWater::waterAll(LivingPlant *const *plants, std::size_t count)
+{
+    LivingPlant::addWaterToAll(plants, count, waterAmount);
+}
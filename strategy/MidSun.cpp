@@ -15,3 +15,7 @@ MidSun::MidSun() {
     intensity = 8;   
     hoursNeeded = 5; 
 }
+
+void MidSun::addSunAll(LivingPlant* const* plants, std::size_t count) {
+    LivingPlant::addSunToAll(plants, count, intensity * hoursNeeded);
+}
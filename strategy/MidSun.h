@@ -19,6 +19,11 @@ class MidSun : public SunStrategy
 		 */
 		int addSun(LivingPlant* plant);
 
+		/**
+		 * @brief Gives a batch of plants sun in one loop, skipping the per-plant virtual calls.
+		 */
+		void addSunAll(LivingPlant* const* plants, std::size_t count);
+
 		/**
 		 * @brief Gets the unique identifier for the MidSun strategy.
 		 * @return Integer ID representing the MidSun strategy.
@@ -14,4 +14,9 @@ int MidWater::getID() {
 
 MidWater::MidWater() {
     waterAmount = 20; 
-}
\ No newline at end of file
+}
+
+void MidWater::waterAll(LivingPlant *const *plants, std::size_t count)
+{
+    LivingPlant::addWaterToAll(plants, count, waterAmount);
+}
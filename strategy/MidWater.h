@@ -41,6 +41,11 @@ class MidWater : public WaterStrategy
          */
         int water(LivingPlant* plant);
 
+        /**
+         * @brief Waters a batch of plants in one loop, skipping the per-plant virtual calls.
+         */
+        void waterAll(LivingPlant *const *plants, std::size_t count);
+
         /**
          * @brief Gets the unique identifier for the MidWater strategy.
          * @return Integer ID representing the MidWater strategy.
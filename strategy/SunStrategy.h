@@ -1,6 +1,8 @@
 #ifndef SunStrategy_h
 #define SunStrategy_h
 
+#include <cstddef>
+
 /**
  * @brief Abstract strategy interface for plant sunlight exposure algorithms.
  *
@@ -51,6 +53,20 @@ class SunStrategy
 		 */
 		virtual int addSun(LivingPlant* plant) = 0;
 
+		/**
+		 * @brief Gives several plants sun, in order, with the same result as addSun() on each.
+		 *
+		 * Batch counterpart used by PlantGroup::setOutside(); see WaterStrategy::waterAll().
+		 *
+		 * @param plants Plants using this strategy.
+		 * @param count Number of plants.
+		 */
+		virtual void addSunAll(LivingPlant* const* plants, std::size_t count)
+		{
+			for (std::size_t i = 0; i < count; i++)
+				addSun(plants[i]);
+		}
+
 		/**
 		 * @brief Gets the unique identifier for this sun strategy type.
 		 * @return Integer ID representing the strategy.
@@ -60,6 +76,11 @@ class SunStrategy
         return -1; // Abstract strategy has no ID
     }
 
+		/**
+		 * @brief Returns a stateful strategy to its initial cycle (no-op for stateless ones).
+		 */
+		virtual void reset() {}
+
 		/**
 		 * @brief Virtual destructor for proper cleanup of derived classes.
 		 */
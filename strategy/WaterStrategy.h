@@ -1,6 +1,8 @@
 #ifndef WaterStrategy_h
 #define WaterStrategy_h
 
+#include <cstddef>
+
 class LivingPlant; // Forward declaration
 
 /**
@@ -51,6 +53,30 @@ public:
      */
     virtual int water(LivingPlant *plant) = 0;
 
+    /**
+     * @brief Waters several plants, in order, with the same result as water() on each.
+     *
+     * PlantGroup::water() hands each strategy all of its plants at once
+     * (see CareBatch), so an override with a tight loop turns two virtual
+     * calls per plant into one per strategy. The default just calls water().
+     *
+     * @param plants Plants using this strategy.
+     * @param count Number of plants.
+     */
+    virtual void waterAll(LivingPlant *const *plants, std::size_t count)
+    {
+        for (std::size_t i = 0; i < count; i++)
+            water(plants[i]);
+    }
+
+    /**
+     * @brief Returns a stateful strategy to its initial cycle (no-op for stateless ones).
+     *
+     * Strategies are shared flyweights, so their state depends on every plant
+     * watered so far; deterministic simulation runs reset them before starting.
+     */
+    virtual void reset() {}
+
     /**
      * @brief Virtual destructor for proper cleanup of derived classes.
      */
@@ -15,6 +15,14 @@
 #include "prototype/Succulent.h"
 #include "prototype/Herb.h"
 #include "builder/Builder.h"
+#include "builder/SpeciesBuilder.h"
+#include "builder/SpeciesCatalog.h"
+#include "builder/ParallelBuild.h"
+#include "facade/NurseryFacade.h"
+#include <atomic>
+#include <new>
+#include <thread>
+#include "prototype/Shrub.h"
 
 TEST_CASE("Testing Builder Pattern Implementation")
 {
@@ -893,3 +901,174 @@ TEST_CASE("Testing SunflowerBuilder Implementation")
     delete Inventory::getInstance();
 }
 
+
+TEST_CASE("Testing Builder Pattern - Species Catalog")
+{
+    Inventory *inv = Inventory::getInstance();
+
+    SUBCASE("Every species is found by its exact name and listed in catalog order")
+    {
+        const std::vector<std::string> &names = SpeciesCatalog::getNames();
+        REQUIRE(names.size() == SpeciesCatalog::COUNT);
+        for (int id = 0; id < SpeciesCatalog::COUNT; id++)
+        {
+            const Species &species = SpeciesCatalog::get((SpeciesCatalog::Id)id);
+            CHECK(names[id] == species.name);
+            CHECK(SpeciesCatalog::find(species.name) == &species);
+        }
+        CHECK(names[0] == "Sunflower");
+        CHECK(names[SpeciesCatalog::PINE] == "Pine Tree");
+        CHECK(&SpeciesCatalog::getNames() == &names);
+    }
+
+    SUBCASE("Near misses are not species")
+    {
+        const char *misses[] = {"", "R", "rose", "Rose ", "Roses", "Pine", "Maple", "Succulent", "Cherry blossom"};
+        for (const char *miss : misses)
+            CHECK(SpeciesCatalog::find(miss) == nullptr);
+        CHECK(SpeciesCatalog::find("Rosebud", 4) == &SpeciesCatalog::get(SpeciesCatalog::ROSE));
+    }
+
+    SUBCASE("Builders follow their catalog entry")
+    {
+        for (int id = 0; id < SpeciesCatalog::COUNT; id++)
+        {
+            const Species &species = SpeciesCatalog::get((SpeciesCatalog::Id)id);
+            Builder *builder = species.createBuilder();
+            CHECK(&static_cast<SpeciesBuilder *>(builder)->getSpecies() == &species);
+            Director director(builder);
+            director.construct();
+
+            LivingPlant *plant = dynamic_cast<LivingPlant *>(director.getPlant());
+            REQUIRE(plant != nullptr);
+            CHECK(plant->getNameView() == species.name);
+            CHECK(plant->getWaterLevel() == species.waterLevel);
+            CHECK(plant->getSunExposure() == species.sunExposure);
+            CHECK(plant->getWaterStrategy() == inv->getWaterFly(species.waterStrategy()));
+            CHECK(plant->getSunStrategy() == inv->getSunFly(species.sunStrategy()));
+            CHECK(plant->getHealth() == 100);
+
+            delete plant;
+            delete builder;
+        }
+
+        // The concrete builders are the same recipes
+        RoseBuilder rose;
+        CHECK(&rose.getSpecies() == &SpeciesCatalog::get(SpeciesCatalog::ROSE));
+        Director director(&rose);
+        director.construct();
+        PlantComponent *plant = director.getPlant();
+        CHECK(dynamic_cast<Shrub *>(plant) != nullptr);
+        CHECK(static_cast<LivingPlant *>(plant)->getDecorator()->getInfo().find("Thorns") != std::string::npos);
+        delete plant;
+    }
+
+    delete Inventory::getInstance();
+}
+
+TEST_CASE("Testing Builder Pattern - Parallel Bulk Build")
+{
+    SUBCASE("Threads racing on first use share one Inventory")
+    {
+        delete Inventory::getInstance();
+        std::vector<Inventory *> seen(8, nullptr);
+        std::vector<std::thread> threads;
+        for (std::size_t t = 0; t < seen.size(); t++)
+            threads.push_back(std::thread([&seen, t]()
+                                          { seen[t] = Inventory::getInstance(); }));
+        for (std::thread &thread : threads)
+            thread.join();
+        for (Inventory *inv : seen)
+            CHECK(inv == Inventory::getInstance());
+    }
+
+    SUBCASE("Bulk-built plants match a plant built on its own")
+    {
+        RoseBuilder builder;
+        Director director(&builder);
+        director.construct();
+        PlantComponent *single = director.getPlant();
+        std::string expected = single->getDecorator()->getInfo();
+
+        ParallelBuild parallel(4, 1);
+        CHECK(parallel.workerCount(1000) == 4);
+        CHECK(parallel.workerCount(3) == 3);
+        CHECK(ParallelBuild(4).workerCount(1000) == 1000 / ParallelBuild::MIN_PLANTS_PER_THREAD);
+
+        std::vector<PlantComponent *> plants = parallel.build(SpeciesCatalog::get(SpeciesCatalog::ROSE), 1000);
+        REQUIRE(plants.size() == 1000);
+        for (PlantComponent *plant : plants)
+        {
+            REQUIRE(plant != nullptr);
+            CHECK(plant->getDecorator()->getInfo() == expected);
+            CHECK(dynamic_cast<Shrub *>(plant) != nullptr);
+        }
+        for (PlantComponent *plant : plants)
+            delete plant;
+        delete single;
+
+        CHECK(parallel.build(SpeciesCatalog::get(SpeciesCatalog::ROSE), 0).empty());
+    }
+
+    SUBCASE("Every species can be bulk-built at the same time")
+    {
+        std::vector<std::vector<PlantComponent *> > built(SpeciesCatalog::COUNT);
+        std::vector<std::thread> threads;
+        for (int id = 0; id < SpeciesCatalog::COUNT; id++)
+            threads.push_back(std::thread([&built, id]()
+                                          { built[id] = ParallelBuild(2, 1).build(SpeciesCatalog::get((SpeciesCatalog::Id)id), 300); }));
+        for (std::thread &thread : threads)
+            thread.join();
+
+        for (int id = 0; id < SpeciesCatalog::COUNT; id++)
+        {
+            const Species &species = SpeciesCatalog::get((SpeciesCatalog::Id)id);
+            REQUIRE(built[id].size() == 300);
+            for (PlantComponent *plant : built[id])
+            {
+                CHECK(plant->getNameView() == species.name);
+                CHECK(static_cast<LivingPlant *>(plant)->getWaterLevel() == species.waterLevel);
+                delete plant;
+            }
+        }
+    }
+
+    SUBCASE("Any exception from a worker reaches the caller")
+    {
+        // Throws on the second builder created, so other chunks succeed and must be cleaned up
+        static std::atomic<int> builders(0);
+        builders = 0;
+        Species broken = SpeciesCatalog::get(SpeciesCatalog::ROSE);
+        broken.createBuilder = []() -> Builder *
+        {
+            if (builders++ == 1)
+                throw std::bad_alloc();
+            return new RoseBuilder();
+        };
+
+        bool threwBadAlloc = false;
+        try
+        {
+            ParallelBuild(4, 1).build(broken, 400);
+        }
+        catch (const std::bad_alloc &)
+        {
+            threwBadAlloc = true;
+        }
+        CHECK(threwBadAlloc);
+        CHECK(builders == 4);
+    }
+
+    SUBCASE("The facade adds bulk-built plants to the inventory")
+    {
+        NurseryFacade nursery;
+        std::size_t before = Inventory::getInstance()->getInventory()->getPlants()->size();
+        std::vector<PlantComponent *> cacti = nursery.createPlants("Cactus", 500, 4);
+        CHECK(cacti.size() == 500);
+        CHECK(Inventory::getInstance()->getInventory()->getPlants()->size() == before + 500);
+        CHECK(Inventory::getInstance()->getInventory()->getPlants()->back() == cacti.back());
+        CHECK(nursery.createPlants("Cacti", 10).empty());
+    }
+
+    delete Inventory::getInstance();
+}
@@ -1,6 +1,9 @@
 #include "doctest.h"
 #include "composite/PlantGroup.h"
 #include "composite/PlantComponent.h"
+#include "composite/InfoBuffer.h"
+#include "composite/CareBatch.h"
+#include "diagnostics/AllocationTracker.h"
 #include "prototype/Tree.h"
 #include "prototype/Succulent.h"
 #include "prototype/Shrub.h"
@@ -11,6 +14,8 @@
 #include "mediator/Staff.h"
 #include "singleton/Singleton.h"
 #include <vector>
+#include <sstream>
+#include <iomanip>
 
 TEST_CASE("Testing Composite Pattern - Basic PlantGroup Operations")
 {
@@ -146,6 +151,91 @@ TEST_CASE("Testing Composite Pattern - Aggregated Care Operations")
     delete Inventory::getInstance();
 }
 
+TEST_CASE("Testing Composite Pattern - Batched Care")
+{
+    // Plants on every strategy, some decorated, half in a nested group; enough to fill each bucket
+    static const int PLANTS = 4 * CareBatch::FLUSH_SIZE + 1;
+    struct Greenhouse
+    {
+        PlantGroup *root;
+        std::vector<LivingPlant *> order;
+
+        Greenhouse()
+        {
+            root = new PlantGroup();
+            PlantGroup *nested = new PlantGroup();
+            root->addComponent(nested);
+            std::vector<LivingPlant *> direct;
+            for (int i = 0; i < PLANTS; i++)
+            {
+                LivingPlant *plant = new Tree();
+                if (i < PLANTS - 1)
+                {
+                    plant->setWaterStrategy(1 + i % 4);
+                    plant->setSunStrategy(1 + (i / 2) % 4);
+                }
+                plant->setWaterLevel(i * 7 % 100);
+                plant->setSunExposure(i * 5 % 100);
+                if (i % 3 == 0)
+                    plant->addAttribute(new Autumn());
+                PlantComponent *component = i % 3 == 0 ? plant->getDecorator() : plant;
+                if (i % 2)
+                {
+                    nested->addComponent(component);
+                    order.push_back(plant);
+                }
+                else
+                {
+                    root->addComponent(component);
+                    direct.push_back(plant);
+                }
+            }
+            order.insert(order.end(), direct.begin(), direct.end());
+        }
+
+        ~Greenhouse() { delete root; }
+    };
+
+    Inventory *inv = Inventory::getInstance();
+    WaterStrategy *alternatingWater = inv->getWaterFly(AlternatingWater::getID())->getState();
+    SunStrategy *alternatingSun = inv->getSunFly(AlternatingSun::getID())->getState();
+
+    Greenhouse batched;
+    Greenhouse single;
+    for (LivingPlant *plant : batched.order)
+        plant->getInfo();
+
+    alternatingWater->reset();
+    alternatingSun->reset();
+    for (int round = 0; round < 3; round++)
+    {
+        batched.root->water();
+        batched.root->setOutside();
+    }
+
+    alternatingWater->reset();
+    alternatingSun->reset();
+    for (int round = 0; round < 3; round++)
+    {
+        for (LivingPlant *plant : single.order)
+            plant->water();
+        for (LivingPlant *plant : single.order)
+            plant->setOutside();
+    }
+
+    // Same levels as per-plant care, including the alternating cycles, and no stale info
+    for (std::size_t i = 0; i < batched.order.size(); i++)
+    {
+        CHECK(batched.order[i]->getWaterLevel() == single.order[i]->getWaterLevel());
+        CHECK(batched.order[i]->getSunExposure() == single.order[i]->getSunExposure());
+        CHECK(batched.order[i]->getInfo() == single.order[i]->getInfo());
+    }
+    CHECK(batched.order.back()->getWaterLevel() == (PLANTS - 1) * 7 % 100);
+    CHECK(batched.order[0]->getWaterLevel() > 7);
+
+    delete Inventory::getInstance();
+}
+
 TEST_CASE("Testing Composite Pattern - Aggregated Value Queries")
 {
     SUBCASE("getPrice aggregates all plant prices")
@@ -293,6 +383,117 @@ TEST_CASE("Testing Composite Pattern - Group Information")
     delete Inventory::getInstance();
 }
 
+TEST_CASE("Testing Composite Pattern - Info Rendering")
+{
+    SUBCASE("InfoBuffer formats like the stream manipulators it replaces")
+    {
+        InfoBuffer buffer;
+        buffer.column("Name:", 8).integer(-42).append("|").fixed(150.0, 2).append("|").general(12.5);
+        buffer.append("|").column("much longer than the column", 4);
+
+        std::ostringstream stream;
+        stream << std::left << std::setw(8) << "Name:" << -42 << "|" << std::fixed << std::setprecision(2) << 150.0 << "|";
+        stream.unsetf(std::ios::floatfield);
+        stream << std::setprecision(6) << 12.5 << "|" << "much longer than the column";
+        CHECK(buffer.str() == stream.str());
+
+        buffer.clear();
+        CHECK(buffer.size() == 0);
+    }
+
+    SUBCASE("Cached plant info follows vitals and decorators")
+    {
+        LivingPlant *tree = new Tree();
+        tree->setHealth(40);
+        std::string before = tree->getInfo();
+        CHECK(tree->getInfo() == before);
+
+        tree->setHealth(90);
+        std::string after = tree->getInfo();
+        CHECK(after != before);
+        CHECK(after.find("90") != std::string::npos);
+
+        tree->addAttribute(new Autumn());
+        CHECK(tree->getInfo().find("Total Price:") != std::string::npos);
+        CHECK(tree->getDecorator()->getInfo().find(after) == 0);
+
+        delete tree;
+    }
+
+    SUBCASE("Rendering into a warm buffer allocates nothing")
+    {
+        PlantGroup *group = new PlantGroup();
+        for (int i = 0; i < 10; i++)
+        {
+            LivingPlant *shrub = new Shrub();
+            shrub->addAttribute(new Spring());
+            group->addComponent(shrub);
+        }
+
+        InfoBuffer buffer;
+        group->writeInfo(buffer);
+        std::string first = buffer.str();
+        buffer.clear();
+
+        AllocationTracker::Scope scope;
+        group->writeInfo(buffer);
+        if (AllocationTracker::isInstalled())
+            CHECK(scope.getAllocations() == 0);
+        CHECK(buffer.str() == first);
+
+        delete group;
+    }
+    delete Inventory::getInstance();
+}
+
+TEST_CASE("Testing Composite Pattern - Name Views")
+{
+    SUBCASE("Plants and decorators expose their interned names")
+    {
+        Inventory *inv = Inventory::getInstance();
+        LivingPlant *tree = new Tree();
+        tree->addAttribute(new Autumn());
+
+        AllocationTracker::Scope scope;
+        const std::string &name = tree->getNameView();
+        const std::string &decoratorName = tree->getDecorator()->getNameView();
+        if (AllocationTracker::isInstalled())
+            CHECK(scope.getAllocations() == 0);
+
+        CHECK(&name == inv->getString("Tree")->getState());
+        CHECK(name == tree->getName());
+        CHECK(decoratorName == "Autumn Season");
+        CHECK(tree->getSeasonView().empty());
+        tree->setSeason(inv->getString("Autumn Season"));
+        CHECK(&tree->getSeasonView() == inv->getString("Autumn Season")->getState());
+
+        delete tree;
+    }
+
+    SUBCASE("A group's name is rebuilt only after its structure changes")
+    {
+        PlantGroup *group = new PlantGroup();
+        CHECK(group->getNameView() == "Plant Group");
+
+        group->addComponent(new Tree());
+        group->addComponent(new Shrub());
+        CHECK(group->getNameView() == "Plant Group: Tree, Shrub");
+
+        AllocationTracker::Scope scope;
+        const std::string &cached = group->getNameView();
+        if (AllocationTracker::isInstalled())
+            CHECK(scope.getAllocations() == 0);
+        CHECK(cached == group->getName());
+
+        group->addComponent(new Herb());
+        group->addComponent(new Succulent());
+        CHECK(group->getNameView() == "Plant Group: Tree, Shrub, Herb");
+
+        delete group;
+    }
+    delete Inventory::getInstance();
+}
+
 TEST_CASE("Testing Composite Pattern - Clone and Copy Functionality")
 {
     SUBCASE("clone creates independent deep copy of group")
@@ -759,3 +960,57 @@ TEST_CASE("Testing Composite Pattern - Complex Scenarios")
     }
     delete Inventory::getInstance();
 }
+
+TEST_CASE("PlantGroup structure version tracks hierarchy changes")
+{
+    PlantGroup *root = new PlantGroup();
+    PlantGroup *child = new PlantGroup();
+    LivingPlant *tree = new Tree();
+
+    SUBCASE("Adding and removing components bumps the version")
+    {
+        unsigned long before = PlantGroup::getStructureVersion();
+        root->addComponent(child);
+        unsigned long afterAdd = PlantGroup::getStructureVersion();
+        CHECK(afterAdd != before);
+
+        child->addComponent(tree);
+        CHECK(PlantGroup::getStructureVersion() != afterAdd);
+
+        unsigned long beforeRemove = PlantGroup::getStructureVersion();
+        CHECK(root->removeComponent(tree));
+        CHECK(PlantGroup::getStructureVersion() != beforeRemove);
+
+        delete tree;
+    }
+
+    SUBCASE("Non-structural operations leave the version unchanged")
+    {
+        root->addComponent(child);
+        child->addComponent(tree);
+
+        PlantGroup *stranger = new PlantGroup();
+
+        unsigned long before = PlantGroup::getStructureVersion();
+        root->water();
+        root->setOutside();
+        root->getName();
+        CHECK_FALSE(root->removeComponent(stranger));
+        CHECK(PlantGroup::getStructureVersion() == before);
+
+        delete stranger;
+    }
+
+    SUBCASE("Direct list edits can be reported explicitly")
+    {
+        root->getPlants()->push_back(child);
+        unsigned long before = PlantGroup::getStructureVersion();
+        PlantGroup::markStructureChanged();
+        CHECK(PlantGroup::getStructureVersion() != before);
+
+        delete tree;
+    }
+
+    delete root;
+    delete Inventory::getInstance();
+}
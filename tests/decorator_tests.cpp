@@ -18,6 +18,8 @@
 #include "decorator/customerDecorator/LargePot.h"
 #include "decorator/customerDecorator/RedPot.h"
 #include "decorator/customerDecorator/PlantCharm.h"
+#include "decorator/SharedDecorator.h"
+#include "diagnostics/AllocationTracker.h"
 #include "singleton/Singleton.h"
 #include <vector>
 
@@ -699,3 +701,109 @@ TEST_CASE("Testing Decorator Pattern - getInfo() with Decorators")
     }
     delete Inventory::getInstance();
 }
+
+TEST_CASE("Testing Decorator Pattern - Shared Decorator Chains")
+{
+    // Spring, then Thorns and LargeLeaf behind it: the Rose-style chain
+    LivingPlant *original = new Shrub();
+    original->addAttribute(new Spring());
+    original->addAttribute(new LargeLeaf());
+    original->addAttribute(new Thorns());
+    PlantComponent *head = original->getDecorator();
+    std::string originalInfo = head->getInfo();
+
+    SUBCASE("Clones share one interned chain")
+    {
+        LivingPlant *first = static_cast<LivingPlant *>(head->clone());
+        LivingPlant *second = static_cast<LivingPlant *>(head->clone());
+
+        SharedDecorator *firstChain = dynamic_cast<SharedDecorator *>(first->getDecorator());
+        SharedDecorator *secondChain = dynamic_cast<SharedDecorator *>(second->getDecorator());
+        REQUIRE(firstChain != nullptr);
+        REQUIRE(secondChain != nullptr);
+        CHECK(firstChain != secondChain);
+        CHECK(firstChain->getChain() == secondChain->getChain());
+        CHECK(firstChain->getChain()->getReferenceCount() == 2);
+        CHECK(firstChain->getAttributeCount() == 3);
+        CHECK(*firstChain->getAttribute(0).name->getState() == "Spring Season");
+        CHECK(*firstChain->getAttribute(1).name->getState() == "Thorns/Spikes");
+
+        // Cloning a clone takes another reference instead of interning again
+        LivingPlant *third = static_cast<LivingPlant *>(firstChain->clone());
+        CHECK(static_cast<SharedDecorator *>(third->getDecorator())->getChain() == firstChain->getChain());
+        CHECK(firstChain->getChain()->getReferenceCount() == 3);
+
+        delete third->getDecorator();
+        delete second->getDecorator();
+        CHECK(firstChain->getChain()->getReferenceCount() == 1);
+        delete first->getDecorator();
+    }
+
+    SUBCASE("Shared chains behave like the nodes they replace")
+    {
+        LivingPlant *clone = static_cast<LivingPlant *>(head->clone());
+        PlantComponent *shared = clone->getDecorator();
+
+        CHECK(shared->getPrice() == head->getPrice());
+        CHECK(shared->affectWater() == head->affectWater());
+        CHECK(shared->affectSunlight() == head->affectSunlight());
+        CHECK(shared->getName() == head->getName());
+        CHECK(shared->getInfo() == originalInfo);
+
+        clone->update();
+        original->update();
+        CHECK(clone->getWaterLevel() == original->getWaterLevel());
+        CHECK(clone->getSunExposure() == original->getSunExposure());
+
+        delete shared;
+    }
+
+    SUBCASE("A clone is one allocation holding the plant and its decorator")
+    {
+        LivingPlant *first = static_cast<LivingPlant *>(head->clone());
+
+        AllocationTracker::Scope scope;
+        LivingPlant *second = static_cast<LivingPlant *>(first->getDecorator()->clone());
+        if (AllocationTracker::isInstalled())
+            CHECK(scope.getAllocations() == 1);
+
+        SharedDecorator *handle = static_cast<SharedDecorator *>(second->getDecorator());
+        CHECK(handle->isEmbedded());
+        CHECK(reinterpret_cast<char *>(handle) > reinterpret_cast<char *>(second));
+        CHECK(reinterpret_cast<char *>(handle) - reinterpret_cast<char *>(second) < 2 * (long)sizeof(Shrub));
+        CHECK(handle->getPrice() == head->getPrice());
+
+        // Either end may be deleted first; the block is freed once
+        delete first;
+        delete handle;
+    }
+
+    SUBCASE("Adding an attribute copies on write")
+    {
+        LivingPlant *plain = static_cast<LivingPlant *>(head->clone());
+        LivingPlant *potted = static_cast<LivingPlant *>(head->clone());
+        DecoratorChain *chain = static_cast<SharedDecorator *>(plain->getDecorator())->getChain();
+
+        potted->addAttribute(new RedPot());
+        SharedDecorator *pottedChain = static_cast<SharedDecorator *>(potted->getDecorator());
+        CHECK(pottedChain->getChain() != chain);
+        CHECK(chain->getReferenceCount() == 1);
+        CHECK(pottedChain->getAttributeCount() == 4);
+        CHECK(*pottedChain->getAttribute(1).name->getState() == "Red Clay Pot");
+        CHECK(potted->getDecorator()->getPrice() == plain->getDecorator()->getPrice() + RedPot().getPrice());
+
+        // Same layers as a concrete chain given the same attribute
+        original->addAttribute(new RedPot());
+        CHECK(potted->getDecorator()->getInfo() == head->getInfo());
+
+        // A second plant potted the same way shares the new chain
+        plain->addAttribute(new RedPot());
+        CHECK(static_cast<SharedDecorator *>(plain->getDecorator())->getChain() == pottedChain->getChain());
+
+        delete plain->getDecorator();
+        delete potted->getDecorator();
+    }
+
+    delete head;
+    delete Inventory::getInstance();
+}
@@ -0,0 +1,498 @@
+#include "doctest.h"
+#include "diagnostics/AllocationTracker.h"
+#include "diagnostics/TickProfiler.h"
+#include "diagnostics/Tracer.h"
+#include "diagnostics/WorkloadGenerator.h"
+#include "diagnostics/MemoryReport.h"
+#include "singleton/Singleton.h"
+#include "composite/PlantGroup.h"
+#include "builder/Director.h"
+#include "builder/RoseBuilder.h"
+#include "builder/CactusBuilder.h"
+#include "observer/Observer.h"
+#include "prototype/LivingPlant.h"
+#include "iterator/PlantRange.h"
+#include "mediator/Customer.h"
+#include "state/Mature.h"
+#include <algorithm>
+#include <atomic>
+#include <sstream>
+#include <thread>
+
+namespace
+{
+    // The pointer escapes through a volatile, so the optimiser cannot elide the new/delete pair
+    int *volatile observedAllocation;
+
+    void allocateInt(int value)
+    {
+        observedAllocation = new int(value);
+        delete observedAllocation;
+    }
+}
+
+TEST_CASE("Testing AllocationTracker")
+{
+    // Built with ALLOCATION_HOOKS=0: nothing is counted
+    if (!AllocationTracker::isInstalled())
+    {
+        CHECK(AllocationTracker::getTotalCounts().allocations == 0);
+        return;
+    }
+
+    SUBCASE("Scopes count the current thread only")
+    {
+        // Starting a thread allocates on the caller, so start it before measuring
+        std::atomic<bool> go(false);
+        std::thread worker([&go]()
+                           {
+                               while (!go.load())
+                                   std::this_thread::yield();
+                               allocateInt(5); });
+
+        AllocationTracker::Scope scope;
+        uint64_t totalBefore = AllocationTracker::getTotalCounts().allocations;
+        allocateInt(4);
+        go.store(true);
+        worker.join();
+
+        CHECK(scope.getAllocations() == 1);
+        CHECK(scope.getCounts().deallocations == 1);
+        CHECK(scope.getCounts().bytes >= sizeof(int));
+        CHECK(AllocationTracker::getTotalCounts().allocations - totalBefore >= 2);
+    }
+
+    SUBCASE("Steady-state ticks perform zero allocations")
+    {
+        PlantGroup *root = Inventory::getInstance()->getInventory();
+        for (int i = 0; i < 50; i++)
+        {
+            RoseBuilder rose;
+            Director director(&rose);
+            director.construct();
+            root->addComponent(director.getPlant());
+
+            CactusBuilder cactus;
+            Director cactusDirector(&cactus);
+            cactusDirector.construct();
+            root->addComponent(cactusDirector.getPlant());
+        }
+
+        // Only plant ticks; tickOnce() may also change the season
+        root->tick();
+        AllocationTracker::Scope scope;
+        for (int i = 0; i < 20; i++)
+            root->tick();
+        CHECK(scope.getAllocations() == 0);
+        delete Inventory::getInstance();
+    }
+
+    SUBCASE("Allocations are attributed to the innermost tag")
+    {
+        AllocationTracker::resetTagCounts();
+        {
+            AllocationTracker::TagScope tick(AllocationTracker::Tag::TICK);
+            allocateInt(1);
+            {
+                AllocationTracker::TagScope builder(AllocationTracker::Tag::BUILDER);
+                allocateInt(2);
+                allocateInt(3);
+            }
+            allocateInt(4);
+        }
+        CHECK(AllocationTracker::getTagCounts(AllocationTracker::Tag::TICK).allocations == 2);
+        CHECK(AllocationTracker::getTagCounts(AllocationTracker::Tag::BUILDER).allocations == 2);
+
+        RoseBuilder rose;
+        Director director(&rose);
+        director.construct();
+        CHECK(AllocationTracker::getTagCounts(AllocationTracker::Tag::BUILDER).allocations > 2);
+        CHECK(std::string(AllocationTracker::getTagName(AllocationTracker::Tag::BUILDER)) == "builder");
+        delete Inventory::getInstance();
+    }
+}
+
+namespace
+{
+    /**
+     * @brief Observer that only counts its callbacks.
+     */
+    class CountingObserver : public Observer
+    {
+    public:
+        CountingObserver() : calls(0) {}
+        void getWaterUpdate(PlantComponent *) { calls++; }
+        void getSunUpdate(PlantComponent *) { calls++; }
+        void getStateUpdate(PlantComponent *) { calls++; }
+        std::string getNameObserver() { return "Counter"; }
+
+        int calls;
+    };
+}
+
+TEST_CASE("Testing TickProfiler")
+{
+    Inventory *inv = Inventory::getInstance();
+    PlantGroup *group = new PlantGroup();
+    inv->getInventory()->addComponent(group);
+    CountingObserver observer;
+    group->attach(&observer);
+
+    LivingPlant *plants[2];
+    for (LivingPlant *&plant : plants)
+    {
+        RoseBuilder rose;
+        Director director(&rose);
+        director.construct();
+        plant = static_cast<LivingPlant *>(director.getPlant());
+        plant->setWaterLevel(0);
+        group->addComponent(plant);
+    }
+    // Past the mature lifespan: dies (one transition) on the first tick
+    plants[0]->setMaturity(Mature::getID());
+    plants[0]->setAge(500);
+
+    SUBCASE("Ticks record phase timings and event counts")
+    {
+        for (int i = 0; i < 10; i++)
+            inv->tickOnce();
+
+        TickMetrics metrics = inv->getMetrics();
+        CHECK(metrics.ticks == 10);
+        CHECK(metrics.window == 10);
+        CHECK(metrics.totalTransitions == 1);
+        CHECK(metrics.maxTransitions == 1);
+        CHECK(metrics.lastTransitions == 0);
+        CHECK(observer.calls > 0);
+        CHECK(metrics.totalNotifications == (uint64_t)observer.calls);
+
+        const TickMetrics::Phase &grow = metrics.phases[static_cast<int>(TickProfiler::Phase::GROW)];
+        const TickMetrics::Phase &season = metrics.phases[static_cast<int>(TickProfiler::Phase::SEASON)];
+        CHECK(std::string(grow.name) == "grow");
+        CHECK(grow.maxNs > 0);
+        CHECK(grow.p50Ns <= grow.p99Ns);
+        CHECK(grow.p99Ns <= grow.maxNs);
+        // The season changes once in the first ten ticks, so its median tick is zero
+        CHECK(season.maxNs > 0);
+        CHECK(season.p50Ns == 0);
+
+        double phaseMeans = 0.0;
+        for (const TickMetrics::Phase &phase : metrics.phases)
+            phaseMeans += phase.meanNs;
+        CHECK(phaseMeans <= metrics.total.meanNs);
+
+        // Outside tickOnce() nothing is recorded
+        inv->getInventory()->tick();
+        CHECK(inv->getMetrics().ticks == 10);
+
+        inv->getProfiler()->reset();
+        CHECK(inv->getMetrics().ticks == 0);
+        CHECK(inv->getMetrics().totalNotifications == 0);
+    }
+
+    SUBCASE("Metrics are dumped periodically")
+    {
+        std::ostringstream json;
+        inv->getProfiler()->setDump(&json, 3, TickProfiler::Format::JSON);
+        for (int i = 0; i < 7; i++)
+            inv->tickOnce();
+
+        std::string dump = json.str();
+        CHECK(std::count(dump.begin(), dump.end(), '\n') == 2);
+        CHECK(dump.find("{\"schema\": 1, \"ticks\": 3,") == 0);
+        CHECK(dump.find("\"ticks\": 6,") != std::string::npos);
+        CHECK(dump.find("\"name\": \"observers\"") != std::string::npos);
+
+        std::ostringstream text;
+        inv->getProfiler()->setDump(&text, 1, TickProfiler::Format::TEXT);
+        inv->tickOnce();
+        inv->getProfiler()->setDump(nullptr, 0, TickProfiler::Format::TEXT);
+        inv->tickOnce();
+        CHECK(text.str().find("Tick metrics: 8 ticks") == 0);
+        CHECK(text.str().find("state transitions:") != std::string::npos);
+    }
+
+    group->detach(&observer);
+    delete inv;
+}
+
+TEST_CASE("Testing Tracer")
+{
+    Tracer::clear();
+
+    SUBCASE("Scopes become complete events with thread names")
+    {
+        Tracer::setThreadName("main");
+        {
+            Tracer::Scope outer("outer", "test");
+            Tracer::Scope inner("inner", "test");
+        }
+        std::thread worker([]()
+                           {
+                               Tracer::setThreadName("helper");
+                               Tracer::Scope scope("work", "test"); });
+        worker.join();
+        CHECK(Tracer::getEventCount() == 3);
+
+        std::ostringstream out;
+        Tracer::write(out);
+        std::string trace = out.str();
+        CHECK(trace.find("{\"displayTimeUnit\": \"ns\", \"traceEvents\": [") == 0);
+        CHECK(trace.find("\"args\": {\"name\": \"main\"}") != std::string::npos);
+        CHECK(trace.find("\"args\": {\"name\": \"helper\"}") != std::string::npos);
+        CHECK(trace.find("{\"name\": \"inner\", \"cat\": \"test\", \"ph\": \"X\"") != std::string::npos);
+        CHECK(trace.find("\"name\": \"work\"") != std::string::npos);
+        // Inner ends first, so it is recorded before outer
+        CHECK(trace.find("\"inner\"") < trace.find("\"outer\""));
+    }
+
+    SUBCASE("Full rings keep the newest events")
+    {
+        std::thread worker([]()
+                           {
+                               for (std::size_t i = 0; i < Tracer::BUFFER_EVENTS; i++)
+                                   Tracer::record("old", "test", i, 1);
+                               for (int i = 0; i < 5; i++)
+                                   Tracer::record("new", "test", Tracer::BUFFER_EVENTS + i, 1); });
+        worker.join();
+        CHECK(Tracer::getEventCount() == Tracer::BUFFER_EVENTS);
+
+        std::ostringstream out;
+        Tracer::write(out);
+        std::string trace = out.str();
+        CHECK(trace.find("\"ts\": 0.000,") == std::string::npos);
+        CHECK(trace.find("\"name\": \"new\"") != std::string::npos);
+    }
+
+    SUBCASE("Clearing while threads record keeps their later events")
+    {
+        std::atomic<bool> stop(false);
+        std::thread worker([&stop]()
+                           {
+                               while (!stop.load())
+                                   Tracer::record("busy", "test", Tracer::now(), 1); });
+        for (int i = 0; i < 100; i++)
+            Tracer::clear();
+        stop.store(true);
+        worker.join();
+
+        Tracer::clear();
+        CHECK(Tracer::getEventCount() == 0);
+        Tracer::record("after", "test", Tracer::now(), 1);
+        Tracer::record("after", "test", Tracer::now(), 1);
+        CHECK(Tracer::getEventCount() == 2);
+    }
+
+    SUBCASE("Call sites follow the compile-time switch")
+    {
+        Inventory::getInstance()->tickOnce();
+        std::ostringstream out;
+        Tracer::write(out);
+#ifdef PHOTOSYNTECH_TRACING
+        CHECK(out.str().find("\"name\": \"tick\"") != std::string::npos);
+        CHECK(out.str().find("\"name\": \"group_tick\"") != std::string::npos);
+#else
+        CHECK(Tracer::getEventCount() == 0);
+#endif
+        delete Inventory::getInstance();
+    }
+
+    Tracer::clear();
+}
+
+TEST_CASE("Testing WorkloadGenerator")
+{
+    WorkloadConfig config;
+    config.plants = 300;
+    config.groupDepth = 2;
+    config.groupFanout = 3;
+    for (int &weight : config.typeWeights)
+        weight = 0;
+    config.typeWeights[1] = 3; // Rose
+    config.typeWeights[4] = 1; // Cactus
+    config.minExtraDecorators = 1;
+    config.maxExtraDecorators = 2;
+    config.staff = 2;
+    config.observedGroupRatio = 0.5;
+    config.seed = 7;
+
+    SUBCASE("Builds the configured shape")
+    {
+        WorkloadGenerator generator(config);
+        PlantGroup *top = generator.build();
+        CHECK(top->getGroupName() == "Workload");
+
+        WorkloadStats stats = generator.getStats();
+        CHECK(stats.plants == 300);
+        CHECK(stats.groups == 1 + 3 + 9);
+        CHECK(stats.leafGroups == 9);
+        CHECK(stats.observedGroups == 5);
+        CHECK(stats.plantsPerType[1] + stats.plantsPerType[4] == 300);
+        CHECK(stats.plantsPerType[1] > stats.plantsPerType[4]);
+        CHECK(stats.plantsPerType[0] == 0);
+        CHECK(Inventory::getInstance()->getStaff()->size() == 2);
+
+        RoseBuilder rose;
+        Director director(&rose);
+        director.construct();
+        PlantComponent *bareRose = director.getPlant();
+        double bareRosePrice = bareRose->getDecorator()->getPrice();
+        delete bareRose;
+
+        // Every plant carries at least one extra pot or charm, which adds to its price
+        int roses = 0;
+        int pricedAbove = 0;
+        for (LivingPlant *plant : PlantRange(top->getPlants()))
+        {
+            if (plant->getName() != "Rose")
+                continue;
+            roses++;
+            pricedAbove += plant->getDecorator()->getPrice() > bareRosePrice;
+        }
+        CHECK(roses == stats.plantsPerType[1]);
+        CHECK(pricedAbove == roses);
+        CHECK(Inventory::getInstance()->query().count() == 300);
+        CHECK_THROWS(generator.build());
+
+        delete Inventory::getInstance();
+    }
+
+    SUBCASE("Equal seeds give equal nurseries")
+    {
+        WorkloadGenerator first(config);
+        first.build();
+        WorkloadStats a = first.getStats();
+        delete Inventory::getInstance();
+
+        WorkloadGenerator second(config);
+        second.build();
+        WorkloadStats b = second.getStats();
+        delete Inventory::getInstance();
+
+        for (int t = 0; t < WorkloadConfig::PLANT_TYPES; t++)
+            CHECK(a.plantsPerType[t] == b.plantsPerType[t]);
+    }
+
+    SUBCASE("Runs ticks and sales")
+    {
+        config.customers = 3;
+        config.purchaseRate = 0.5;
+        WorkloadGenerator generator(config);
+        generator.run(6);
+
+        WorkloadStats stats = generator.getStats();
+        CHECK(stats.ticks == 6);
+        CHECK(stats.purchases > 0);
+        CHECK(stats.purchases <= 18);
+        CHECK(stats.plants == 300 - stats.purchases);
+        CHECK(Inventory::getInstance()->query().count() == (std::size_t)stats.plants);
+        CHECK(Inventory::getInstance()->getMetrics().ticks == 6);
+        CHECK(Inventory::getInstance()->getCustomers()->front()->getBasket() == nullptr);
+
+        delete Inventory::getInstance();
+    }
+
+    SUBCASE("Rejects a config without plant types")
+    {
+        for (int &weight : config.typeWeights)
+            weight = 0;
+        CHECK_THROWS(WorkloadGenerator{config});
+    }
+}
+
+TEST_CASE("Testing MemoryReport")
+{
+    WorkloadConfig config;
+    config.plants = 300;
+    config.groupDepth = 2;
+    config.groupFanout = 3;
+    for (int &weight : config.typeWeights)
+        weight = 0;
+    config.typeWeights[1] = 1; // Rose: five builder decorators
+    config.minExtraDecorators = config.maxExtraDecorators = 1;
+    config.staff = 2;
+
+    WorkloadGenerator generator(config);
+    AllocationTracker::Scope scope;
+    PlantGroup *top = generator.build();
+    uint64_t allocatedBytes = scope.getCounts().bytes;
+
+    typedef MemoryReport::Category Category;
+    MemoryReport report = MemoryReport::measure();
+
+    SUBCASE("Counts every part of the inventory")
+    {
+        CHECK(report.getPlantCount() == 300);
+        CHECK(report.get(Category::PLANTS).objects == 300);
+        CHECK(report.get(Category::PLANTS).bytes == 300 * sizeof(LivingPlant));
+        // One shared handle per plant, all pointing at one six-layer chain
+        CHECK(report.get(Category::DECORATORS).objects == 300);
+        CHECK(report.get(Category::DECORATOR_CHAINS).objects == 1);
+        CHECK(report.get(Category::GROUPS).objects == 1 + 1 + 3 + 9);
+        CHECK(report.get(Category::GROUP_LISTS).objects == 1 + 3 + 9 + 300);
+        CHECK(report.get(Category::OBSERVER_LISTS).objects == 9);
+        CHECK(report.get(Category::FLYWEIGHT_STRINGS).objects >= 4);
+        CHECK(report.get(Category::FLYWEIGHT_STRATEGIES).objects == 8);
+        CHECK(report.get(Category::FLYWEIGHT_STATES).objects == 4);
+        CHECK(report.get(Category::STAFF).objects == 2);
+        CHECK(report.get(Category::CUSTOMERS).objects == 0);
+        CHECK(report.getBytesPerPlant() == (double)report.getTotalBytes() / 300);
+    }
+
+    SUBCASE("Counts the info plants have cached")
+    {
+        CHECK(report.get(Category::PLANT_INFO).objects == 0);
+        PlantComponent *plant = top->getPlants()->front();
+        while (plant->getType() == ComponentType::PLANT_GROUP)
+            plant = static_cast<PlantGroup *>(plant)->getPlants()->front();
+        std::string info = plant->getInfo();
+
+        MemoryReport shown = MemoryReport::measure();
+        CHECK(shown.get(Category::PLANT_INFO).objects == 1);
+        // The entry and the text it keeps on the heap
+        CHECK(shown.get(Category::PLANT_INFO).allocations == 2);
+    }
+
+    SUBCASE("Agrees with the allocation counters")
+    {
+        // Building allocates at least what the new plants and groups occupy
+        uint64_t treeBytes = MemoryReport::measure(top).getTotalBytes();
+        CHECK(treeBytes > 0);
+        if (AllocationTracker::isInstalled())
+            CHECK(treeBytes <= allocatedBytes);
+        CHECK(MemoryReport::measure(top).get(Category::FLYWEIGHT_STRINGS).bytes == 0);
+    }
+
+    SUBCASE("Charges baskets to customers")
+    {
+        Customer *customer = new Customer("Basket holder");
+        Inventory::getInstance()->addCustomer(customer);
+        PlantComponent *plant = top->getPlants()->front();
+        while (plant->getType() == ComponentType::PLANT_GROUP)
+            plant = static_cast<PlantGroup *>(plant)->getPlants()->front();
+        top->removeComponent(plant);
+        customer->addPlant(plant);
+
+        MemoryReport withBasket = MemoryReport::measure();
+        CHECK(withBasket.getPlantCount() == 300);
+        CHECK(withBasket.get(Category::PLANTS).objects == 299);
+        // Customer, basket group, its list node, the plant and its decorator handle
+        CHECK(withBasket.get(Category::CUSTOMERS).objects == 1 + 1 + 1 + 1 + 1);
+        CHECK(withBasket.get(Category::CUSTOMERS).bytes > sizeof(Customer) + sizeof(PlantGroup) + sizeof(LivingPlant));
+    }
+
+    SUBCASE("Writes text and JSON")
+    {
+        std::ostringstream text;
+        report.writeText(text);
+        CHECK(text.str().find("Memory footprint: 300 plants") == 0);
+        CHECK(text.str().find("flyweight_strings") != std::string::npos);
+
+        std::ostringstream json;
+        report.writeJson(json);
+        CHECK(json.str().find("{\"schema\": 1, \"plants\": 300,") == 0);
+        CHECK(json.str().find("\"decorators\": {\"objects\": 300,") != std::string::npos);
+    }
+
+    delete Inventory::getInstance();
+}
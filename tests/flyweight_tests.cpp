@@ -6,6 +6,10 @@
 #include "strategy/MidWater.h"
 #include "prototype/LivingPlant.h"
 #include "prototype/Tree.h"
+#include "decorator/PlantAttributes.h"
+#include "iterator/AggPlantName.h"
+#include "iterator/PlantQuery.h"
+#include <list>
 #include <string>
 
 TEST_CASE("Testing Flyweight Pattern - String Flyweight Storage")
@@ -331,3 +335,138 @@ TEST_CASE("Testing Flyweight Pattern - Factory Method Pattern")
     }
     delete Inventory::getInstance();
 }
+
+TEST_CASE("Testing Flyweight Pattern - String Reclamation")
+{
+    SUBCASE("Factory frees flyweights idle for a whole epoch and reuses their indices")
+    {
+        FlyweightFactory<int, std::string *> *fac = new FlyweightFactory<int, std::string *>();
+
+        Flyweight<std::string *> *kept = fac->getFlyweight(0, new std::string("Kept"));
+        Flyweight<std::string *> *idle = fac->getFlyweight(1, new std::string("Idle"));
+        fac->getFlyweight(2, new std::string("Looked up"));
+        uint16_t idleIndex = idle->getIndex();
+        kept->retain();
+
+        // Everything was handed out this epoch
+        CHECK(fac->reclaim() == 0);
+        CHECK(fac->find(2) != nullptr);
+        CHECK(fac->find(7) == nullptr);
+        CHECK(fac->getSize() == 3);
+
+        CHECK(fac->reclaim() == 1);
+        CHECK(fac->at(idleIndex) == nullptr);
+        CHECK(fac->at(kept->getIndex()) == kept);
+        CHECK(fac->getFreeIndexCount() == 1);
+
+        Flyweight<std::string *> *reused = fac->getFlyweight(3, new std::string("Reused"));
+        CHECK(reused->getIndex() == idleIndex);
+        CHECK(fac->getFreeIndexCount() == 0);
+
+        // Widely shared flyweights become permanent
+        for (uint32_t i = 1; i < Flyweight<std::string *>::PERMANENT_REFERENCES; i++)
+            reused->retain();
+        CHECK(!reused->isPinned());
+        reused->retain();
+        CHECK(reused->isPinned());
+        reused->release();
+        kept->release();
+        fac->reclaim();
+        fac->reclaim();
+        CHECK(fac->at(reused->getIndex()) == reused);
+        CHECK(fac->find(0) == nullptr);
+
+        delete fac;
+    }
+
+    SUBCASE("Queries look strings up without interning them")
+    {
+        Inventory *inv = Inventory::getInstance();
+        std::list<PlantComponent *> plants;
+        plants.push_back(new Tree());
+
+        AggPlantName *agg = new AggPlantName(&plants, "No Such Plant 0x5eed");
+        Iterator *iter = agg->createIterator();
+        iter->first();
+        CHECK(iter->isDone());
+        delete iter;
+        delete agg;
+
+        inv->query().name("No Such Plant 0x5eed").season("No Such Season 0x5eed").execute();
+        CHECK(inv->findString("No Such Plant 0x5eed") == nullptr);
+        CHECK(inv->findString("No Such Season 0x5eed") == nullptr);
+        CHECK(inv->findString("Summer Season") == inv->getSeason());
+
+        delete plants.front();
+    }
+
+    SUBCASE("Filters keep the strings they match on until they are gone")
+    {
+        Inventory *inv = Inventory::getInstance();
+        std::list<PlantComponent *> plants;
+        LivingPlant *fern = new LivingPlant("Reclaim Test Filter", 10.0, 1, 1);
+        plants.push_back(fern);
+        Flyweight<std::string *> *name = fern->getNameFlyweight();
+
+        AggPlantName *agg = new AggPlantName(&plants, "Reclaim Test Filter");
+        PlantQuery *query = new PlantQuery(&plants);
+        query->name("Reclaim Test Filter");
+        PlantQuery copy(*query);
+        delete fern;
+        plants.clear();
+
+        // Without the filters' references two reclaims would free the name
+        inv->reclaimStrings();
+        inv->reclaimStrings();
+        CHECK(inv->findString("Reclaim Test Filter") == name);
+        CHECK(name->getReferences() == 3);
+
+        delete agg;
+        delete query;
+        CHECK(name->getReferences() == 1);
+        copy.name(inv->getString("Winter Season"));
+        inv->reclaimStrings();
+        inv->reclaimStrings();
+        CHECK(inv->findString("Reclaim Test Filter") == nullptr);
+    }
+
+    SUBCASE("Plants and decorators keep their strings until they are gone")
+    {
+        struct Label : public PlantAttributes
+        {
+            Label() : PlantAttributes("Reclaim Test Label", 5.0, 0, 0) {}
+            PlantComponent *clone() { return new Label(*this); }
+        };
+
+        Inventory *inv = Inventory::getInstance();
+        LivingPlant *plant = new LivingPlant("Reclaim Test Fern", 10.0, 1, 1);
+        plant->setSeason(inv->getString("Reclaim Test Season"));
+        PlantComponent *label = new Label();
+        inv->getString("Reclaim Test Scratch");
+
+        inv->reclaimStrings();
+        inv->reclaimStrings();
+        CHECK(inv->findString("Reclaim Test Scratch") == nullptr);
+        CHECK(plant->getName() == "Reclaim Test Fern");
+        CHECK(plant->getSeasonView() == "Reclaim Test Season");
+        CHECK(*label->getNameFlyweight()->getState() == "Reclaim Test Label");
+
+        LivingPlant *copy = static_cast<LivingPlant *>(plant->clone());
+        delete plant;
+        delete label;
+        inv->reclaimStrings();
+        inv->reclaimStrings();
+        CHECK(copy->getName() == "Reclaim Test Fern");
+        CHECK(inv->findString("Reclaim Test Label") == nullptr);
+
+        copy->setSeason(nullptr);
+        delete copy;
+        inv->reclaimStrings();
+        inv->reclaimStrings();
+        CHECK(inv->findString("Reclaim Test Fern") == nullptr);
+        CHECK(inv->findString("Reclaim Test Season") == nullptr);
+        CHECK(inv->findString("Winter Season") != nullptr);
+        CHECK(inv->getSeason()->isPinned());
+    }
+    delete Inventory::getInstance();
+}
@@ -6,12 +6,18 @@
 #include "iterator/AggPlant.h"
 #include "iterator/AggSeason.h"
 #include "iterator/AggPlantName.h"
+#include "iterator/PlantQuery.h"
+#include "iterator/PlantRange.h"
+#include "iterator/ParallelTraversal.h"
+#include "state/Seed.h"
+#include "state/Mature.h"
 #include "composite/PlantGroup.h"
 #include "prototype/Succulent.h"
 #include "prototype/Tree.h"
 #include "prototype/Shrub.h"
 #include "prototype/Herb.h"
 #include "singleton/Singleton.h"
+#include <climits>
 #include <vector>
 #include <list>
 
@@ -1806,3 +1812,358 @@ TEST_CASE("PlantNameIterator - back() through composite hierarchy")
     }
     delete Inventory::getInstance();
 }
+
+// ============================================================================
+// PLANTQUERY TESTS
+// ============================================================================
+
+TEST_CASE("PlantQuery - Composable criteria over nested groups")
+{
+    Inventory *inv = Inventory::getInstance();
+
+    PlantGroup *root = new PlantGroup();
+    PlantGroup *nested = new PlantGroup();
+
+    LivingPlant *thirstyMature = createPlantWithSeason("Spring Season");
+    thirstyMature->setMaturity(Mature::getID());
+    thirstyMature->setHealth(20);
+    thirstyMature->setWaterLevel(5);
+
+    LivingPlant *healthyMature = createPlantWithSeason("Spring Season");
+    healthyMature->setMaturity(Mature::getID());
+    healthyMature->setHealth(90);
+    healthyMature->setWaterLevel(80);
+
+    LivingPlant *thirstySeed = createPlantWithSeason("Winter Season");
+    thirstySeed->setMaturity(Seed::getID());
+    thirstySeed->setHealth(10);
+    thirstySeed->setWaterLevel(5);
+
+    LivingPlant *nestedThirstyMature = createPlantWithSeason("Spring Season");
+    nestedThirstyMature->setMaturity(Mature::getID());
+    nestedThirstyMature->setHealth(25);
+    nestedThirstyMature->setWaterLevel(10);
+
+    root->addComponent(thirstyMature);
+    root->addComponent(healthyMature);
+    nested->addComponent(nestedThirstyMature);
+    root->addComponent(nested);
+    root->addComponent(thirstySeed);
+
+    SUBCASE("Unrestricted query returns every plant")
+    {
+        PlantQuery query(root->getPlants());
+        CHECK(query.count() == 4);
+    }
+
+    SUBCASE("State and vitals combine in a single traversal")
+    {
+        PlantQuery query(root->getPlants());
+        std::vector<LivingPlant *> results = query.state(Mature::getID()).waterBelow(20).execute();
+
+        REQUIRE(results.size() == 2);
+        CHECK(results[0] == thirstyMature);
+        CHECK(results[1] == nestedThirstyMature);
+    }
+
+    SUBCASE("Season and health ranges intersect")
+    {
+        PlantQuery query(root->getPlants());
+        query.season("Spring Season").healthAbove(15).healthBelow(30);
+
+        CHECK(query.count() == 2);
+        CHECK(query.matches(thirstyMature));
+        CHECK_FALSE(query.matches(healthyMature));
+        CHECK_FALSE(query.matches(thirstySeed));
+    }
+
+    SUBCASE("Limit stops the traversal early")
+    {
+        PlantQuery query(root->getPlants());
+        query.healthBelow(30).limit(2);
+
+        std::vector<LivingPlant *> results = query.execute();
+        CHECK(results.size() == 2);
+        CHECK(query.count() == 2);
+        CHECK(query.firstMatch() == thirstyMature);
+    }
+
+    SUBCASE("Back after the limit returns to the last result")
+    {
+        PlantQuery query(root->getPlants());
+        query.healthBelow(30).limit(2);
+        Iterator *iter = query.createIterator();
+
+        iter->next();
+        CHECK(iter->currentItem() == nestedThirstyMature);
+        iter->next();
+        CHECK(iter->isDone());
+        iter->next();
+        CHECK(iter->isDone());
+        iter->back();
+        CHECK(iter->currentItem() == nestedThirstyMature);
+        iter->back();
+        CHECK(iter->currentItem() == thirstyMature);
+
+        delete iter;
+    }
+
+    SUBCASE("Bounds at the ends of the int range match nothing")
+    {
+        PlantQuery below(root->getPlants());
+        CHECK(below.healthBelow(INT_MIN).count() == 0);
+
+        PlantQuery above(root->getPlants());
+        CHECK(above.healthAbove(INT_MAX).count() == 0);
+
+        PlantQuery widest(root->getPlants());
+        CHECK(widest.healthAbove(INT_MIN).healthBelow(INT_MAX).count() == 4);
+    }
+
+    SUBCASE("Custom predicates are AND-ed with built-in criteria")
+    {
+        PlantQuery query(root->getPlants());
+        query.state(Mature::getID()).where([](LivingPlant *plant)
+                                           { return plant->getHealth() > 50; });
+
+        CHECK(query.count() == 1);
+        CHECK(query.firstMatch() == healthyMature);
+    }
+
+    SUBCASE("Query iterator is lazy and bidirectional")
+    {
+        PlantQuery query(root->getPlants());
+        query.state(Mature::getID());
+        Iterator *iter = query.createIterator();
+
+        CHECK(iter->currentItem() == thirstyMature);
+        iter->next();
+        CHECK(iter->currentItem() == healthyMature);
+        iter->next();
+        CHECK(iter->currentItem() == nestedThirstyMature);
+        iter->back();
+        CHECK(iter->currentItem() == healthyMature);
+        iter->next();
+        iter->next();
+        CHECK(iter->isDone());
+
+        delete iter;
+    }
+
+    SUBCASE("No match yields an empty result")
+    {
+        PlantQuery query(root->getPlants());
+        query.name("Nonexistent Plant");
+
+        CHECK(query.count() == 0);
+        CHECK(query.firstMatch() == nullptr);
+        CHECK(query.execute().empty());
+    }
+
+    delete root;
+    delete inv;
+}
+
+TEST_CASE("PlantQuery - Inventory entry point")
+{
+    Inventory *inv = Inventory::getInstance();
+
+    LivingPlant *dehydrated = createPlantWithSeason("Summer Season");
+    dehydrated->setMaturity(Mature::getID());
+    dehydrated->setWaterLevel(0);
+    LivingPlant *watered = createPlantWithSeason("Summer Season");
+    watered->setMaturity(Mature::getID());
+    watered->setWaterLevel(70);
+
+    inv->getInventory()->addComponent(dehydrated);
+    inv->getInventory()->addComponent(watered);
+
+    std::vector<LivingPlant *> results = inv->query().state(Mature::getID()).waterBelow(10).limit(100).execute();
+
+    REQUIRE(results.size() == 1);
+    CHECK(results[0] == dehydrated);
+
+    delete inv;
+}
+
+// ============================================================================
+// PLANTRANGE TESTS
+// ============================================================================
+
+TEST_CASE("PlantRange - Matches PlantIterator order without heap iterators")
+{
+    Inventory *inv = Inventory::getInstance();
+
+    PlantGroup *root = new PlantGroup();
+    PlantGroup *nested = new PlantGroup();
+    PlantGroup *empty = new PlantGroup();
+
+    LivingPlant *first = createPlantWithSeason("Spring");
+    LivingPlant *inner = createPlantWithSeason("Summer");
+    LivingPlant *last = createPlantWithSeason("Autumn");
+
+    root->addComponent(first);
+    root->addComponent(empty);
+    nested->addComponent(inner);
+    root->addComponent(nested);
+    root->addComponent(last);
+
+    SUBCASE("Range-for visits plants depth-first")
+    {
+        std::vector<LivingPlant *> visited;
+        for (LivingPlant *plant : PlantRange(root->getPlants()))
+        {
+            visited.push_back(plant);
+        }
+
+        AggPlant agg(root->getPlants());
+        Iterator *iter = agg.createIterator();
+        CHECK(visited == collectPlants(iter));
+        delete iter;
+
+        REQUIRE(visited.size() == 3);
+        CHECK(visited[0] == first);
+        CHECK(visited[1] == inner);
+        CHECK(visited[2] == last);
+    }
+
+    SUBCASE("Indexed lookup")
+    {
+        PlantRange range(root->getPlants());
+        CHECK(range.at(0) == first);
+        CHECK(range.at(1) == inner);
+        CHECK(range.at(2) == last);
+        CHECK(range.at(3) == nullptr);
+        CHECK(range.at(-1) == nullptr);
+    }
+
+    SUBCASE("Empty and null collections yield nothing")
+    {
+        CHECK(PlantRange(empty->getPlants()).begin() == PlantRange(empty->getPlants()).end());
+        CHECK(PlantRange(nullptr).begin() == PlantRange(nullptr).end());
+    }
+
+    delete root;
+    delete inv;
+}
+
+TEST_CASE("PlantRange - Hierarchies deeper than the inline frame buffer")
+{
+    Inventory *inv = Inventory::getInstance();
+
+    PlantGroup *root = new PlantGroup();
+    PlantGroup *level = root;
+    const int depth = (int)PlantRange::INLINE_DEPTH + 4;
+
+    for (int i = 0; i < depth; i++)
+    {
+        level->addComponent(createPlantWithSeason("Winter"));
+        PlantGroup *child = new PlantGroup();
+        level->addComponent(child);
+        level = child;
+    }
+    LivingPlant *deepest = createPlantWithSeason("Spring");
+    level->addComponent(deepest);
+
+    int count = 0;
+    LivingPlant *lastSeen = nullptr;
+    for (LivingPlant *plant : PlantRange(root->getPlants()))
+    {
+        lastSeen = plant;
+        count++;
+    }
+
+    CHECK(count == depth + 1);
+    CHECK(lastSeen == deepest);
+
+    delete root;
+    delete inv;
+}
+
+// ============================================================================
+// PARALLELTRAVERSAL TESTS
+// ============================================================================
+
+TEST_CASE("ParallelTraversal - Chunked reductions agree with serial walks")
+{
+    Inventory *inv = Inventory::getInstance();
+
+    PlantGroup *root = new PlantGroup();
+    PlantGroup *large = new PlantGroup();
+    PlantGroup *small = new PlantGroup();
+    root->addComponent(large);
+    root->addComponent(small);
+
+    // Lopsided tree: most plants sit in one group
+    for (int i = 0; i < 97; i++)
+    {
+        LivingPlant *plant = createPlantWithSeason("Spring");
+        plant->setWaterLevel(i);
+        (i % 10 == 0 ? small : large)->addComponent(plant);
+    }
+
+    SUBCASE("Forced multi-threaded split covers every plant once")
+    {
+        ParallelTraversal traversal(root->getPlants(), 4, 1);
+
+        CHECK(traversal.size() == 97);
+        CHECK(traversal.workerCount() == 4);
+        CHECK(traversal.count([](LivingPlant *) { return true; }) == 97);
+        CHECK(traversal.count([](LivingPlant *plant) { return plant->getWaterValue() <= 50; }) == 51);
+        CHECK(traversal.sum([](LivingPlant *plant) { return plant->getPrice(); }) == root->getPrice());
+    }
+
+    SUBCASE("Custom reduction combines partials in chunk order")
+    {
+        ParallelTraversal traversal(root->getPlants(), 3, 1);
+        std::vector<LivingPlant *> ordered = traversal.reduce(
+            std::vector<LivingPlant *>(),
+            [](std::vector<LivingPlant *> &out, LivingPlant *plant) { out.push_back(plant); },
+            [](std::vector<LivingPlant *> &out, const std::vector<LivingPlant *> &part)
+            { out.insert(out.end(), part.begin(), part.end()); });
+
+        std::vector<LivingPlant *> serial;
+        for (LivingPlant *plant : PlantRange(root->getPlants()))
+        {
+            serial.push_back(plant);
+        }
+        CHECK(ordered == serial);
+    }
+
+    SUBCASE("An exception from any worker reaches the caller")
+    {
+        std::vector<LivingPlant *> serial;
+        for (LivingPlant *plant : PlantRange(root->getPlants()))
+        {
+            serial.push_back(plant);
+        }
+        ParallelTraversal traversal(root->getPlants(), 4, 1);
+        REQUIRE(traversal.workerCount() == 4);
+
+        // The first chunk runs on a spawned worker, the last on the calling thread
+        LivingPlant *spawned = serial.front();
+        CHECK_THROWS(traversal.count([spawned](LivingPlant *plant) -> bool
+                                     { if (plant == spawned) throw "bad plant"; return true; }));
+        LivingPlant *caller = serial.back();
+        CHECK_THROWS(traversal.count([caller](LivingPlant *plant) -> bool
+                                     { if (plant == caller) throw "bad plant"; return true; }));
+        CHECK(traversal.count([](LivingPlant *) { return true; }) == 97);
+    }
+
+    SUBCASE("Small inventories stay on the calling thread")
+    {
+        ParallelTraversal traversal(root->getPlants(), 8);
+        CHECK(traversal.workerCount() == 1);
+        CHECK(traversal.count([](LivingPlant *) { return true; }) == 97);
+    }
+
+    SUBCASE("Empty collections reduce to the identity")
+    {
+        ParallelTraversal traversal(nullptr, 4, 1);
+        CHECK(traversal.size() == 0);
+        CHECK(traversal.sum([](LivingPlant *plant) { return plant->getPrice(); }) == 0.0);
+    }
+
+    delete root;
+    delete inv;
+}
@@ -5,11 +5,21 @@
 #include "mediator/SuggestionFloor.h"
 #include "mediator/Mediator.h"
 #include "mediator/User.h"
+#include "facade/NurseryFacade.h"
+#include "builder/SpeciesCatalog.h"
 #include "singleton/Singleton.h"
 #include "prototype/LivingPlant.h"
 #include "prototype/Tree.h"
 #include "prototype/Shrub.h"
+#include "prototype/Succulent.h"
+#include "prototype/Herb.h"
 #include "composite/PlantGroup.h"
+#include "composite/InfoBuffer.h"
+#include "composite/InfoSink.h"
+#include "decorator/plantDecorator/Spring.h"
+#include <cstdio>
+#include <sstream>
+#include <unistd.h>
 #include <vector>
 #include <string>
 #include <cstring>
@@ -183,3 +193,133 @@ TEST_CASE("Testing Mediator Pattern Implementation")
     }
     delete Inventory::getInstance();
 }
+
+TEST_CASE("Testing Mediator Pattern - Species Suggestions")
+{
+    NurseryFacade nursery;
+    Staff *staff = new Staff();
+
+    SUBCASE("Catalog species get their category and species advice")
+    {
+        nursery.createPlant("Pine Tree");
+        std::string suggestion = staff->assistSuggestion();
+        CHECK(suggestion.find("recommend our Pine Tree") != std::string::npos);
+        CHECK(suggestion.find("It's a tree") != std::string::npos);
+        CHECK(suggestion.find(SpeciesCatalog::get(SpeciesCatalog::PINE).advice) != std::string::npos);
+    }
+
+    SUBCASE("Names that contain a species name get that species' advice")
+    {
+        LivingPlant *plant = new Shrub("Wild Rose Hedge");
+        Inventory::getInstance()->getInventory()->addComponent(plant);
+        std::string suggestion = staff->assistSuggestion();
+        CHECK(suggestion.find("one of our flowering plants") != std::string::npos);
+        CHECK(suggestion.find(SpeciesCatalog::get(SpeciesCatalog::ROSE).advice) != std::string::npos);
+    }
+
+    SUBCASE("Trees are matched before flowering plants")
+    {
+        LivingPlant *plant = new Tree("Pine and Rose Bed");
+        Inventory::getInstance()->getInventory()->addComponent(plant);
+        std::string suggestion = staff->assistSuggestion();
+        CHECK(suggestion.find("It's a tree") != std::string::npos);
+        CHECK(suggestion.find(SpeciesCatalog::get(SpeciesCatalog::PINE).advice) != std::string::npos);
+    }
+
+    SUBCASE("Plain succulents get succulent advice")
+    {
+        LivingPlant *plant = new Succulent();
+        Inventory::getInstance()->getInventory()->addComponent(plant);
+        std::string suggestion = staff->assistSuggestion();
+        CHECK(suggestion.find("low-maintenance") != std::string::npos);
+        CHECK(suggestion.find("Succulents are great for beginners") != std::string::npos);
+    }
+
+    SUBCASE("Names with no species keyword get the general recommendation")
+    {
+        LivingPlant *plant = new Herb("Basil");
+        Inventory::getInstance()->getInventory()->addComponent(plant);
+        std::string suggestion = staff->assistSuggestion();
+        CHECK(suggestion.find("one of our quality plants") != std::string::npos);
+    }
+
+    delete staff;
+    delete Inventory::getInstance();
+}
+
+TEST_CASE("Testing Mediator Pattern - Streamed Receipts")
+{
+    // Two identical wholesale baskets
+    PlantGroup *baskets[2];
+    for (PlantGroup *&basket : baskets)
+    {
+        basket = new PlantGroup();
+        for (int i = 0; i < 200; i++)
+        {
+            LivingPlant *shrub = new Shrub();
+            shrub->addAttribute(new Spring());
+            basket->addComponent(shrub);
+        }
+    }
+    Staff *staff = new Staff();
+
+    SUBCASE("A streamed receipt arrives in bounded chunks and matches the string receipt")
+    {
+        std::string whole = staff->assistPurchases(baskets[0]);
+
+        std::string streamed;
+        std::size_t chunks = 0;
+        std::size_t largest = 0;
+        CallbackInfoSink sink([&](const char *data, std::size_t length)
+                              {
+                                  chunks++;
+                                  largest = std::max(largest, length);
+                                  streamed.append(data, length); });
+        staff->assistPurchases(baskets[1], sink);
+
+        CHECK(streamed == whole);
+        CHECK(whole.find("Purchase Receipt:") == 0);
+        CHECK(whole.find("Total price: ") != std::string::npos);
+        CHECK(chunks > 1);
+        // A chunk overshoots the threshold by at most one basket entry
+        CHECK(largest < InfoBuffer::DEFAULT_CHUNK_SIZE + 2048);
+    }
+
+    SUBCASE("Group info streams to an ostream and a file descriptor")
+    {
+        std::string expected = baskets[0]->getInfo();
+
+        std::ostringstream stream;
+        StreamInfoSink streamSink(stream);
+        baskets[0]->streamInfo(streamSink);
+        CHECK(stream.str() == expected);
+
+        FILE *file = std::tmpfile();
+        REQUIRE(file != nullptr);
+        FdInfoSink fdSink(fileno(file));
+        baskets[0]->streamInfo(fdSink);
+        std::rewind(file);
+        std::string written(expected.size() + 1, '\0');
+        written.resize(std::fread(&written[0], 1, written.size(), file));
+        std::fclose(file);
+        CHECK(written == expected);
+
+        delete baskets[0];
+        delete baskets[1];
+    }
+
+    SUBCASE("Purchases without a sales floor still report through the sink")
+    {
+        Customer *customer = new Customer();
+        std::string reply;
+        StringInfoSink sink(reply);
+        customer->purchasePlants(sink);
+        CHECK(reply == customer->purchasePlants());
+        delete customer;
+        delete baskets[0];
+        delete baskets[1];
+    }
+
+    delete staff;
+    delete Inventory::getInstance();
+}
@@ -0,0 +1,622 @@
+#include "doctest.h"
+#include "memento/InventorySnapshot.h"
+#include "memento/SnapshotFormat.h"
+#include "memento/MappedSnapshot.h"
+#include "memento/InventoryJournal.h"
+#include "memento/SimulationRecording.h"
+#include "singleton/SimulationRandom.h"
+#include "singleton/Singleton.h"
+#include "composite/PlantGroup.h"
+#include "prototype/Herb.h"
+#include "prototype/Tree.h"
+#include "prototype/Shrub.h"
+#include "prototype/Succulent.h"
+#include "decorator/plantDecorator/Spring.h"
+#include "decorator/plantDecorator/LargeLeaf.h"
+#include "decorator/plantDecorator/Thorns.h"
+#include "decorator/customerDecorator/PlantDecorationHeader.h"
+#include "mediator/Staff.h"
+#include "mediator/Customer.h"
+#include "strategy/MidWater.h"
+#include "strategy/AlternatingWater.h"
+#include "strategy/HighSun.h"
+#include "state/Mature.h"
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <thread>
+
+namespace
+{
+	/**
+	 * @brief Fills the inventory with nested groups, decorated plants, staff and a customer basket.
+	 */
+	void buildSnapshotInventory()
+	{
+		Inventory *inv = Inventory::getInstance();
+		inv->changeSeason();
+
+		PlantGroup *herbs = new PlantGroup("Herbs");
+		PlantGroup *shaded = new PlantGroup("Shaded");
+		herbs->addComponent(shaded);
+		inv->getInventory()->addComponent(herbs);
+
+		LivingPlant *basil = new Herb();
+		basil->setAge(5);
+		basil->setHealth(77);
+		basil->setWaterLevel(40);
+		basil->setWaterStrategy(MidWater::getID());
+		basil->setSunStrategy(HighSun::getID());
+		basil->setMaturity(Mature::getID());
+		basil->addAttribute(new Spring());
+		basil->addAttribute(new LargeLeaf());
+		basil->addAttribute(new RedPot());
+		herbs->addComponent(basil);
+
+		shaded->addComponent(new Shrub());
+		inv->getInventory()->addComponent(new Tree());
+
+		Staff *staff = new Staff("Alex");
+		inv->addStaff(staff);
+		herbs->attach(staff);
+
+		Customer *customer = new Customer("Sam");
+		customer->addPlant(new Tree());
+		inv->addCustomer(customer);
+		inv->addCustomer(new Customer("Window Shopper"));
+	}
+}
+
+TEST_CASE("Testing Memento - InventorySnapshot round trip")
+{
+	buildSnapshotInventory();
+	Inventory *inv = Inventory::getInstance();
+
+	PlantGroup *herbs = static_cast<PlantGroup *>(inv->getInventory()->getPlants()->front());
+	LivingPlant *basil = nullptr;
+	for (PlantComponent *child : *herbs->getPlants())
+	{
+		if (child->getType() != ComponentType::PLANT_GROUP)
+			basil = static_cast<LivingPlant *>(child);
+	}
+	REQUIRE(basil != nullptr);
+
+	double price = inv->getInventory()->getPrice();
+	std::string info = basil->getInfo();
+	std::string decoratedName = basil->getDecorator()->getName();
+	double basilPrice = basil->getDecorator()->getPrice();
+
+	// Strategy flyweights die with the old Inventory, so measure the expected result now
+	LivingPlant *reference = static_cast<LivingPlant *>(basil->clone());
+	reference->water();
+	int wateredLevel = reference->getWaterValue();
+	delete reference;
+
+	std::stringstream image;
+	InventorySnapshot::save(image);
+
+	delete Inventory::getInstance();
+	InventorySnapshot::restore(image);
+	inv = Inventory::getInstance();
+
+	SUBCASE("Hierarchy, prices and decorators are preserved")
+	{
+		PlantGroup *root = inv->getInventory();
+		CHECK(root->getPlants()->size() == 2);
+		CHECK(root->getPrice() == price);
+
+		PlantGroup *restoredHerbs = static_cast<PlantGroup *>(root->getPlants()->front());
+		REQUIRE(restoredHerbs->getType() == ComponentType::PLANT_GROUP);
+		CHECK(restoredHerbs->getGroupName() == "Herbs");
+		CHECK(restoredHerbs->getPlants()->size() == 2);
+
+		PlantComponent *shaded = restoredHerbs->getPlants()->front();
+		REQUIRE(shaded->getType() == ComponentType::PLANT_GROUP);
+		CHECK(static_cast<PlantGroup *>(shaded)->getGroupName() == "Shaded");
+		CHECK(static_cast<PlantGroup *>(shaded)->getPlants()->size() == 1);
+
+		LivingPlant *restored = static_cast<LivingPlant *>(restoredHerbs->getPlants()->back());
+		REQUIRE(restored->getType() == ComponentType::LIVING_PLANT);
+		CHECK(dynamic_cast<Herb *>(restored) != nullptr);
+		CHECK(restored->getInfo() == info);
+		REQUIRE(restored->getDecorator() != nullptr);
+		CHECK(restored->getDecorator()->getName() == decoratedName);
+		CHECK(restored->getDecorator()->getPrice() == basilPrice);
+		CHECK(restored->getMaturity() == inv->getStates(Mature::getID()));
+		CHECK(*inv->getSeason()->getState() == "Autumn Season");
+	}
+
+	SUBCASE("Strategies are restored")
+	{
+		PlantGroup *restoredHerbs = static_cast<PlantGroup *>(inv->getInventory()->getPlants()->front());
+		LivingPlant *restored = static_cast<LivingPlant *>(restoredHerbs->getPlants()->back());
+
+		restored->water();
+		CHECK(restored->getWaterValue() == wateredLevel);
+	}
+
+	SUBCASE("Staff, observers and customers are restored")
+	{
+		REQUIRE(inv->getStaff()->size() == 1);
+		Staff *staff = inv->getStaff()->front();
+		CHECK(staff->getName() == "Alex");
+
+		PlantGroup *restoredHerbs = static_cast<PlantGroup *>(inv->getInventory()->getPlants()->front());
+		REQUIRE(restoredHerbs->getObservers().size() == 1);
+		CHECK(restoredHerbs->getObservers().front() == staff);
+
+		REQUIRE(inv->getCustomers()->size() == 2);
+		Customer *customer = inv->getCustomers()->front();
+		CHECK(customer->getName() == "Sam");
+		REQUIRE(customer->getBasket() != nullptr);
+		CHECK(customer->getBasket()->getPlants()->size() == 1);
+		CHECK(inv->getCustomers()->back()->getBasket() == nullptr);
+	}
+
+	delete Inventory::getInstance();
+}
+
+TEST_CASE("Testing Memento - InventorySnapshot rejects bad images")
+{
+	buildSnapshotInventory();
+	std::ostringstream out;
+	InventorySnapshot::save(out);
+	std::string image = out.str();
+
+	Inventory *inv = Inventory::getInstance();
+	PlantGroup *root = inv->getInventory();
+	size_t staffCount = inv->getStaff()->size();
+
+	SUBCASE("Truncated image")
+	{
+		CHECK_THROWS(InventorySnapshot::restore(image.data(), image.size() - 1));
+	}
+
+	SUBCASE("Wrong magic")
+	{
+		std::string corrupt = image;
+		corrupt[0] = 'X';
+		CHECK_THROWS(InventorySnapshot::restore(corrupt.data(), corrupt.size()));
+	}
+
+	SUBCASE("Out of range child reference")
+	{
+		SnapshotFormat::Header header;
+		std::memcpy(&header, image.data(), sizeof(header));
+		std::string corrupt = image;
+		uint32_t bad = 0x7FFFFFFFu;
+		std::memcpy(&corrupt[header.childrenOffset], &bad, sizeof(bad));
+		CHECK_THROWS(InventorySnapshot::restore(corrupt.data(), corrupt.size()));
+	}
+
+	// Failed restores leave the live inventory untouched
+	CHECK(inv->getInventory() == root);
+	CHECK(inv->getStaff()->size() == staffCount);
+
+	delete Inventory::getInstance();
+}
+
+TEST_CASE("Testing Memento - InventorySnapshot file round trip")
+{
+	buildSnapshotInventory();
+	const std::string path = "inventory_snapshot_test.bin";
+	double price = Inventory::getInstance()->getInventory()->getPrice();
+
+	InventorySnapshot::saveToFile(path);
+	delete Inventory::getInstance();
+
+	InventorySnapshot::restoreFromFile(path);
+	CHECK(Inventory::getInstance()->getInventory()->getPrice() == price);
+	CHECK(Inventory::getInstance()->getCustomers()->size() == 2);
+
+	PlantComponent *flowers = InventorySnapshot::createDecorator("Large Flowers");
+	CHECK(flowers != nullptr);
+	CHECK(flowers->getName() == "Large Flowers");
+	delete flowers;
+	CHECK(InventorySnapshot::createDecorator("Not A Decorator") == nullptr);
+
+	std::remove(path.c_str());
+	CHECK_THROWS(InventorySnapshot::restoreFromFile(path));
+	delete Inventory::getInstance();
+}
+
+TEST_CASE("Testing Memento - MappedSnapshot lazy plant access")
+{
+	buildSnapshotInventory();
+	const std::string path = "mapped_snapshot_test.bin";
+	InventorySnapshot::saveToFile(path);
+
+	PlantGroup *herbs = static_cast<PlantGroup *>(Inventory::getInstance()->getInventory()->getPlants()->front());
+	std::string basilInfo = static_cast<LivingPlant *>(herbs->getPlants()->back())->getInfo();
+
+	MappedSnapshot *mapped = new MappedSnapshot(path);
+	REQUIRE(mapped->getPlantCount() == 4);
+	CHECK(mapped->getMaterialisedCount() == 0);
+
+	SUBCASE("Records are readable without materialising plants")
+	{
+		bool foundBasil = false;
+		for (size_t i = 0; i < mapped->getPlantCount(); i++)
+		{
+			const SnapshotFormat::PlantRecord &record = mapped->getPlantRecord(i);
+			if (record.kind == SnapshotFormat::KIND_HERB)
+			{
+				foundBasil = true;
+				CHECK(record.health == 77);
+				CHECK(record.decoratorCount == 3);
+			}
+		}
+		CHECK(foundBasil);
+		CHECK(mapped->getMaterialisedCount() == 0);
+		CHECK_THROWS(mapped->getPlantRecord(mapped->getPlantCount()));
+	}
+
+	SUBCASE("Plants materialise once, on demand")
+	{
+		size_t basilIndex = 0;
+		while (mapped->getPlantRecord(basilIndex).kind != SnapshotFormat::KIND_HERB)
+			basilIndex++;
+
+		LivingPlant *basil = mapped->getPlant(basilIndex);
+		CHECK(mapped->isMaterialised(basilIndex));
+		CHECK(mapped->getMaterialisedCount() == 1);
+		CHECK(mapped->getPlant(basilIndex) == basil);
+		CHECK(basil->getInfo() == basilInfo);
+		CHECK(basil->getDecorator() != nullptr);
+
+		// Mutations stay on the heap copy; the mapped record keeps the saved value
+		basil->setHealth(5);
+		CHECK(mapped->getPlantRecord(basilIndex).health == 77);
+
+		LivingPlant *taken = mapped->takePlant(basilIndex);
+		CHECK(taken == basil);
+		CHECK_FALSE(mapped->isMaterialised(basilIndex));
+		Inventory::getInstance()->getInventory()->addComponent(taken);
+	}
+
+	SUBCASE("Full restore reads from the mapped file")
+	{
+		double price = Inventory::getInstance()->getInventory()->getPrice();
+		InventorySnapshot::restore(mapped->getData(), mapped->getSize());
+		CHECK(Inventory::getInstance()->getInventory()->getPrice() == price);
+	}
+
+	delete mapped;
+
+	// A truncated file is rejected when it is opened
+	{
+		std::ofstream truncated(path.c_str(), std::ios::binary | std::ios::trunc);
+		truncated << "PHOTOSNP";
+	}
+	CHECK_THROWS(delete new MappedSnapshot(path));
+	CHECK_THROWS(delete new MappedSnapshot("missing_mapped_snapshot.bin"));
+
+	std::remove(path.c_str());
+	delete Inventory::getInstance();
+}
+
+TEST_CASE("Testing Memento - PlantComponent ids")
+{
+	Herb *first = new Herb();
+	Herb *second = new Herb();
+	PlantGroup *group = new PlantGroup("Ids");
+	CHECK(first->getId() != 0);
+	CHECK(first->getId() != second->getId());
+	CHECK(group->getId() != second->getId());
+
+	PlantComponent *copy = first->clone();
+	CHECK(copy->getId() != first->getId());
+	delete copy;
+
+	group->addComponent(first);
+	Inventory::getInstance()->getInventory()->addComponent(group);
+	Inventory::getInstance()->getInventory()->addComponent(second);
+	unsigned int firstId = first->getId();
+	unsigned int groupId = group->getId();
+
+	std::stringstream image;
+	InventorySnapshot::save(image);
+	delete Inventory::getInstance();
+	InventorySnapshot::restore(image);
+
+	PlantGroup *restored = static_cast<PlantGroup *>(Inventory::getInstance()->getInventory()->getPlants()->front());
+	CHECK(restored->getId() == groupId);
+	CHECK(restored->getPlants()->front()->getId() == firstId);
+
+	// Ids handed out after a restore never collide with restored ones
+	Herb *fresh = new Herb();
+	CHECK(fresh->getId() > firstId);
+	delete fresh;
+	delete Inventory::getInstance();
+}
+
+TEST_CASE("Testing Memento - InventoryJournal replay")
+{
+	const std::string snapshotPath = "journal_snapshot_test.bin";
+	const std::string journalPath = "inventory_journal_test.bin";
+	std::remove(journalPath.c_str());
+
+	buildSnapshotInventory();
+	InventorySnapshot::saveToFile(snapshotPath);
+
+	Inventory *inv = Inventory::getInstance();
+	PlantGroup *root = inv->getInventory();
+	PlantComponent *tree = root->getPlants()->back();
+	InventoryJournal *journal = new InventoryJournal(journalPath, InventoryJournal::SyncPolicy::BATCH, 4);
+	inv->setJournal(journal);
+
+	PlantGroup *cacti = new PlantGroup("Cacti");
+	root->addComponent(cacti);
+	journal->recordAttach(cacti, root);
+
+	LivingPlant *cactus = new Succulent();
+	cactus->setMaturity(0);
+	cacti->addComponent(cactus);
+	journal->recordAttach(cactus, cacti);
+	cactus->setMaturity(Mature::getID());
+
+	// Move the loose tree into the new group
+	root->removeComponent(tree);
+	journal->recordDetach(tree);
+	cacti->addComponent(tree);
+	journal->recordAttach(tree, cacti);
+
+	LivingPlant *sold = new Shrub();
+	root->addComponent(sold);
+	journal->recordAttach(sold, root);
+	Customer *sam = inv->getCustomers()->front();
+	root->removeComponent(sold);
+	sam->addPlant(sold);
+	journal->recordBasketAdd(sam, sold);
+	sam->clearBasket();
+	journal->recordSale(sam);
+
+	Customer *jo = new Customer("Jo");
+	inv->addCustomer(jo);
+	journal->recordCustomer(jo);
+	inv->changeSeason();
+
+	double price = root->getPrice();
+	std::string season = *inv->getSeason()->getState();
+	unsigned int cactusId = cactus->getId();
+	CHECK(journal->getPendingCount() < 4);
+
+	inv->setJournal(nullptr);
+	delete journal;
+	delete Inventory::getInstance();
+
+	SUBCASE("Snapshot plus journal reproduces the inventory")
+	{
+		InventorySnapshot::restoreFromFile(snapshotPath);
+		CHECK(InventoryJournal::replay(journalPath) == 10);
+		inv = Inventory::getInstance();
+
+		CHECK(inv->getInventory()->getPrice() == price);
+		CHECK(*inv->getSeason()->getState() == season);
+		REQUIRE(inv->getInventory()->getPlants()->size() == 2);
+
+		PlantGroup *restored = static_cast<PlantGroup *>(inv->getInventory()->getPlants()->back());
+		REQUIRE(restored->getType() == ComponentType::PLANT_GROUP);
+		CHECK(restored->getGroupName() == "Cacti");
+		REQUIRE(restored->getPlants()->size() == 2);
+		LivingPlant *restoredCactus = static_cast<LivingPlant *>(restored->getPlants()->front());
+		CHECK(restoredCactus->getId() == cactusId);
+		CHECK(restoredCactus->getMaturity() == inv->getStates(Mature::getID()));
+
+		REQUIRE(inv->getCustomers()->size() == 3);
+		CHECK(inv->getCustomers()->front()->getBasket() == nullptr);
+		CHECK(inv->getCustomers()->back()->getName() == "Jo");
+	}
+
+	SUBCASE("A torn final record is ignored")
+	{
+		{
+			std::ofstream out(journalPath.c_str(), std::ios::binary | std::ios::app);
+			uint32_t length = 64;
+			out.write(reinterpret_cast<const char *>(&length), sizeof(length));
+			out << "torn";
+		}
+		InventorySnapshot::restoreFromFile(snapshotPath);
+		CHECK(InventoryJournal::replay(journalPath) == 10);
+		CHECK(Inventory::getInstance()->getInventory()->getPrice() == price);
+	}
+
+	SUBCASE("Replay stops at a corrupt record")
+	{
+		std::string bytes;
+		{
+			std::ifstream in(journalPath.c_str(), std::ios::binary);
+			bytes.assign((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+		}
+		bytes[bytes.size() - 1] ^= 0x55;
+		{
+			std::ofstream out(journalPath.c_str(), std::ios::binary | std::ios::trunc);
+			out.write(bytes.data(), bytes.size());
+		}
+		InventorySnapshot::restoreFromFile(snapshotPath);
+		CHECK(InventoryJournal::replay(journalPath) == 9);
+		CHECK(*Inventory::getInstance()->getSeason()->getState() == "Autumn Season");
+	}
+
+	SUBCASE("A checkpoint empties the journal")
+	{
+		InventorySnapshot::restoreFromFile(snapshotPath);
+		CHECK(InventoryJournal::replay(journalPath) == 10);
+		journal = new InventoryJournal(journalPath);
+		journal->checkpoint(snapshotPath);
+		delete journal;
+		delete Inventory::getInstance();
+
+		InventorySnapshot::restoreFromFile(snapshotPath);
+		CHECK(InventoryJournal::replay(journalPath) == 0);
+		CHECK(Inventory::getInstance()->getInventory()->getPrice() == price);
+	}
+
+	CHECK(InventoryJournal::replay("missing_inventory_journal.bin") == 0);
+	std::remove(snapshotPath.c_str());
+	std::remove(journalPath.c_str());
+	delete Inventory::getInstance();
+}
+
+TEST_CASE("Testing Memento - InventoryJournal checkpoints and failed writes")
+{
+	const std::string snapshotPath = "journal_checkpoint_test.bin";
+	const std::string journalPath = "inventory_journal_checkpoint_test.bin";
+	std::remove(journalPath.c_str());
+	buildSnapshotInventory();
+
+	SUBCASE("Records made during a checkpoint are kept")
+	{
+		const int total = 300;
+		InventoryJournal *journal = new InventoryJournal(journalPath, InventoryJournal::SyncPolicy::NONE, 1);
+		std::atomic<int> recorded(0);
+		std::thread recorder([journal, &recorded]()
+							 {
+			for (int i = 0; i < total; i++)
+			{
+				journal->recordSeasonChange("Summer Season");
+				recorded++;
+			} });
+
+		// Only the records made before the last checkpoint started may be dropped
+		int before = 0;
+		int after = 0;
+		do
+		{
+			before = recorded.load();
+			journal->checkpoint(snapshotPath);
+			after = recorded.load();
+		} while (after < total / 2);
+		recorder.join();
+		delete journal;
+
+		std::size_t replayed = InventoryJournal::replay(journalPath);
+		CHECK(replayed >= (std::size_t)(total - after));
+		CHECK(replayed <= (std::size_t)(total - before));
+	}
+
+	SUBCASE("A batch older than the delay is committed")
+	{
+		InventoryJournal *journal = new InventoryJournal(journalPath, InventoryJournal::SyncPolicy::BATCH, 64,
+														 std::chrono::milliseconds(50));
+		journal->recordSeasonChange("Summer Season");
+		journal->commitIfDue();
+		CHECK(journal->getPendingCount() == 1);
+
+		std::this_thread::sleep_for(std::chrono::milliseconds(60));
+		journal->commitIfDue();
+		CHECK(journal->getPendingCount() == 0);
+
+		// A record arriving after the delay takes the old batch with it
+		journal->recordSeasonChange("Autumn Season");
+		std::this_thread::sleep_for(std::chrono::milliseconds(60));
+		journal->recordSeasonChange("Winter Season");
+		CHECK(journal->getPendingCount() == 0);
+		CHECK(InventoryJournal::replay(journalPath) == 3);
+		delete journal;
+	}
+
+	SUBCASE("A failed write leaves no partial record")
+	{
+		InventoryJournal *journal = new InventoryJournal(journalPath, InventoryJournal::SyncPolicy::EVERY_RECORD);
+		journal->recordSeasonChange("Summer Season");
+		struct stat info;
+		REQUIRE(stat(journalPath.c_str(), &info) == 0);
+		off_t size = info.st_size;
+
+		// Let the next write reach the file size limit partway through its frame
+		struct rlimit limit;
+		getrlimit(RLIMIT_FSIZE, &limit);
+		struct rlimit small = limit;
+		small.rlim_cur = size + 16;
+		void (*handler)(int) = std::signal(SIGXFSZ, SIG_IGN);
+		setrlimit(RLIMIT_FSIZE, &small);
+		CHECK_THROWS(journal->recordSeasonChange(std::string(200, 'x')));
+		setrlimit(RLIMIT_FSIZE, &limit);
+		std::signal(SIGXFSZ, handler);
+
+		REQUIRE(stat(journalPath.c_str(), &info) == 0);
+		CHECK(info.st_size == size);
+		CHECK(journal->getPendingCount() == 1);
+		journal->commit();
+		CHECK(InventoryJournal::replay(journalPath) == 2);
+		delete journal;
+	}
+
+	std::remove(snapshotPath.c_str());
+	std::remove(journalPath.c_str());
+	delete Inventory::getInstance();
+}
+
+TEST_CASE("Testing Memento - SimulationRecording replay")
+{
+	buildSnapshotInventory();
+	Inventory *inv = Inventory::getInstance();
+	PlantGroup *herbs = static_cast<PlantGroup *>(inv->getInventory()->getPlants()->front());
+	LivingPlant *basil = static_cast<LivingPlant *>(herbs->getPlants()->back());
+	basil->setWaterStrategy(AlternatingWater::getID());
+
+	SimulationRecording *recording = new SimulationRecording(7);
+	inv->setRecording(recording);
+	for (int i = 0; i < 12; i++)
+	{
+		inv->tickOnce();
+		if (i % 3 == 0)
+		{
+			basil->water();
+			recording->recordWater(basil);
+		}
+	}
+	herbs->setOutside();
+	recording->recordSunlight(herbs);
+	inv->setRecording(nullptr);
+
+	std::string info = basil->getInfo();
+	std::string season = *inv->getSeason()->getState();
+	CHECK(recording->getTickCount() == 12);
+	CHECK(recording->getEvents().size() == 17);
+
+	SUBCASE("Replay reproduces the run")
+	{
+		CHECK(recording->replay() == 12);
+		herbs = static_cast<PlantGroup *>(Inventory::getInstance()->getInventory()->getPlants()->front());
+		CHECK(static_cast<LivingPlant *>(herbs->getPlants()->back())->getInfo() == info);
+		CHECK(*Inventory::getInstance()->getSeason()->getState() == season);
+		CHECK(SimulationRandom::getSeed() == 7);
+	}
+
+	SUBCASE("Replay can stop part way for bisecting")
+	{
+		CHECK(recording->replay(4) == 4);
+		CHECK(recording->replay() == 12);
+		herbs = static_cast<PlantGroup *>(Inventory::getInstance()->getInventory()->getPlants()->front());
+		CHECK(static_cast<LivingPlant *>(herbs->getPlants()->back())->getInfo() == info);
+	}
+
+	SUBCASE("Recordings survive a file round trip")
+	{
+		const std::string path = "simulation_recording_test.bin";
+		recording->saveToFile(path);
+		SimulationRecording *loaded = SimulationRecording::loadFromFile(path);
+		CHECK(loaded->getSeed() == 7);
+		CHECK(loaded->getEvents().size() == 17);
+		CHECK(loaded->replay() == 12);
+		herbs = static_cast<PlantGroup *>(Inventory::getInstance()->getInventory()->getPlants()->front());
+		CHECK(static_cast<LivingPlant *>(herbs->getPlants()->back())->getInfo() == info);
+		delete loaded;
+
+		std::ofstream(path.c_str(), std::ios::binary | std::ios::trunc) << "PHOTOSIM";
+		CHECK_THROWS(delete SimulationRecording::loadFromFile(path));
+		std::remove(path.c_str());
+	}
+
+	delete recording;
+	SimulationRandom::seedFromClock();
+	delete Inventory::getInstance();
+}
@@ -4,6 +4,7 @@
 #include "prototype/Shrub.h"
 #include "prototype/Succulent.h"
 #include "prototype/Herb.h"
+#include <thread>
 
 TEST_CASE("Testing Prototype Pattern - Plant Type Creation")
 {
@@ -278,3 +279,104 @@ TEST_CASE("Testing Prototype Pattern - Plant Type Operations")
     }
     delete Inventory::getInstance();
 }
+
+TEST_CASE("Testing Prototype Pattern - Compact Plant Record")
+{
+    Inventory *inv = Inventory::getInstance();
+
+    SUBCASE("Vitals are clamped and age saturates")
+    {
+        LivingPlant *plant = new Herb();
+
+        plant->setWaterLevel(250);
+        plant->setSunExposure(-40);
+        plant->setHealth(101);
+        plant->setAge(70000);
+        CHECK(plant->getWaterLevel() == 100);
+        CHECK(plant->getSunExposure() == 0);
+        CHECK(plant->getHealth() == 100);
+        CHECK(plant->getAge() == 65535);
+
+        plant->setAge(-3);
+        CHECK(plant->getAge() == 0);
+
+        // update() must not wrap below zero
+        plant->setWaterLevel(1);
+        plant->update();
+        CHECK(plant->getWaterLevel() == 0);
+
+        delete plant;
+    }
+
+    SUBCASE("Ids resolve to the shared flyweights")
+    {
+        LivingPlant *plant = new Tree();
+        CHECK(plant->getNameFlyweight() == inv->getString("Tree"));
+        CHECK(plant->getSeason() == nullptr);
+        CHECK(plant->getMaturity() == nullptr);
+        CHECK(plant->getWaterStrategy() == nullptr);
+        CHECK(plant->getSunStrategy() == nullptr);
+
+        plant->setSeason(inv->getString("Spring"));
+        plant->setMaturity(Seed::getID());
+        plant->setWaterStrategy(HighWater::getID());
+        plant->setSunStrategy(LowSun::getID());
+        CHECK(plant->getSeason() == inv->getString("Spring"));
+        CHECK(plant->getMaturity() == inv->getStates(Seed::getID()));
+        CHECK(plant->getWaterStrategy() == inv->getWaterFly(HighWater::getID()));
+        CHECK(plant->getSunStrategy() == inv->getSunFly(LowSun::getID()));
+
+        LivingPlant *copy = static_cast<LivingPlant *>(plant->clone());
+        CHECK(copy->getName() == "Tree");
+        CHECK(copy->getSeason() == plant->getSeason());
+        CHECK(copy->getMaturity() == plant->getMaturity());
+        CHECK(copy->getWaterStrategy() == plant->getWaterStrategy());
+
+        delete copy;
+        delete plant;
+    }
+
+    SUBCASE("A plant holds no pointers to its flyweights")
+    {
+        // vtable, price, affects, id, decorator, 2-byte ids and 1-byte vitals, then the info cache
+        CHECK(sizeof(LivingPlant) <= 64);
+    }
+
+    SUBCASE("Info rendered during a change is not kept")
+    {
+        LivingPlant *plant = new Herb();
+        plant->setHealth(40);
+
+        // Invalidations race the reader's renders; only the cache is shared
+        std::thread reader([plant]()
+                           {
+            for (int i = 0; i < 2000; i++)
+                plant->getInfo(); });
+        for (int i = 0; i < 2000; i++)
+            plant->invalidateInfo();
+        reader.join();
+
+        std::string before = plant->getInfo();
+        CHECK(before == plant->getInfo());
+        plant->setHealth(97);
+        CHECK(plant->getInfo() != before);
+        CHECK(plant->getInfo().find("97") != std::string::npos);
+        delete plant;
+    }
+
+    SUBCASE("Cached info stays out of date however many changes follow")
+    {
+        LivingPlant *plant = new Herb();
+        plant->setHealth(40);
+        std::string before = plant->getInfo();
+
+        // 65536 changes in all: a 16-bit version would be back where the cached text was rendered
+        plant->setHealth(97);
+        for (int i = 1; i < 65536; i++)
+            plant->invalidateInfo();
+        CHECK(plant->getInfo() != before);
+        CHECK(plant->getInfo().find("97") != std::string::npos);
+        delete plant;
+    }
+    delete Inventory::getInstance();
+}
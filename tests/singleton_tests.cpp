@@ -1,5 +1,6 @@
 #include "doctest.h"
 #include "singleton/Singleton.h"
+#include "singleton/SimulationRandom.h"
 #include "prototype/LivingPlant.h"
 #include "prototype/Tree.h"
 #include "prototype/Shrub.h"
@@ -345,3 +346,42 @@ TEST_CASE("Testing Singleton Pattern - Memory Efficiency Verification")
     delete Inventory::getInstance();
 }
 
+
+TEST_CASE("Testing Singleton Pattern - Deterministic simulation")
+{
+    SUBCASE("Seeded streams repeat and are independent")
+    {
+        SimulationRandom::seed(42);
+        CHECK(SimulationRandom::isDeterministic());
+        std::vector<size_t> first;
+        for (int i = 0; i < 16; i++)
+            first.push_back(SimulationRandom::pick(SimulationRandom::Stream::SALES_FLOOR, 1000));
+
+        // Draws on another stream must not shift the sales floor sequence
+        SimulationRandom::seed(42);
+        std::vector<size_t> second;
+        for (int i = 0; i < 16; i++)
+        {
+            SimulationRandom::pick(SimulationRandom::Stream::STAFF_COMMENT, 6);
+            second.push_back(SimulationRandom::pick(SimulationRandom::Stream::SALES_FLOOR, 1000));
+        }
+        CHECK(first == second);
+        CHECK_THROWS(SimulationRandom::pick(SimulationRandom::Stream::SALES_FLOOR, 0));
+
+        SimulationRandom::seedFromClock();
+        CHECK_FALSE(SimulationRandom::isDeterministic());
+    }
+
+    SUBCASE("tickOnce advances the season like the ticker thread")
+    {
+        Inventory *inv = Inventory::getInstance();
+        inv->resetSimulationState();
+        std::string start = *inv->getSeason()->getState();
+        for (int i = 0; i < 8; i++)
+            inv->tickOnce();
+        CHECK(*inv->getSeason()->getState() == start);
+        inv->tickOnce();
+        CHECK(*inv->getSeason()->getState() != start);
+        delete Inventory::getInstance();
+    }
+}
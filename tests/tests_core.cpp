@@ -17,6 +17,8 @@
 #include "singleton_tests.cpp" //Passing
 #include "strategy_tests.cpp"  //Passing
 #include "state_tests.cpp"     //Passing
+#include "memento_tests.cpp"   //Passing
+#include "diagnostics_tests.cpp" //Passing
 
 TEST_CASE("Testing nursery function")
 {
@@ -74,4 +76,235 @@ TEST_CASE("Testing nursery function")
 
     delete fac;
     delete Inventory::getInstance();
-}
\ No newline at end of file
+}
+TEST_CASE("Testing nursery inventory reports")
+{
+    NurseryFacade *fac = new NurseryFacade;
+    PlantComponent *rose = fac->createPlant("Rose");
+    PlantComponent *cactus = fac->createPlant("Cactus");
+    PlantComponent *pine = fac->createPlant("Pine Tree");
+
+    static_cast<LivingPlant *>(rose)->setHealth(5);
+    static_cast<LivingPlant *>(rose)->setWaterLevel(10);
+    static_cast<LivingPlant *>(cactus)->setHealth(55);
+    static_cast<LivingPlant *>(cactus)->setWaterLevel(90);
+    static_cast<LivingPlant *>(pine)->setHealth(100);
+    static_cast<LivingPlant *>(pine)->setWaterLevel(50);
+
+    CHECK(fac->getStockValuation() == Inventory::getInstance()->getInventory()->getPrice());
+    CHECK(fac->countPlantsNeedingWater() == 2);
+
+    std::vector<int> histogram = fac->getHealthHistogram(4);
+    REQUIRE(histogram.size() == 4);
+    CHECK(histogram[0] == 1);
+    CHECK(histogram[1] == 0);
+    CHECK(histogram[2] == 1);
+    CHECK(histogram[3] == 1);
+    CHECK(fac->getHealthHistogram(0).empty());
+
+    delete fac;
+    delete Inventory::getInstance();
+}
+
+TEST_CASE("Testing nursery paged listings")
+{
+    NurseryFacade *fac = new NurseryFacade;
+    PlantGroup *root = Inventory::getInstance()->getInventory();
+
+    PlantGroup *groupA = fac->createPlantGroup("A");
+    PlantGroup *groupB = fac->createPlantGroup("B");
+    fac->addComponentToGroup(root, groupA);
+    for (int i = 0; i < 5; i++)
+        fac->createPlant("Rose");
+    fac->addComponentToGroup(root, groupB);
+
+    LivingPlant *nestedCactus = static_cast<LivingPlant *>(fac->createPlant("Cactus"));
+    fac->removeComponentFromInventory(nestedCactus);
+    fac->addComponentToGroup(groupB, nestedCactus);
+
+    SUBCASE("Menu pages cover the full listing in order")
+    {
+        std::vector<string> all = fac->getMenuString();
+        REQUIRE(all.size() == 6);
+
+        ListingPage first = fac->getMenuPage(0, 4);
+        CHECK(first.offset == 0);
+        CHECK(first.items.size() == 4);
+        CHECK(first.hasMore());
+
+        ListingPage second = fac->continueMenuPage(first.nextCursor, 4);
+        CHECK(second.offset == 4);
+        CHECK(second.items.size() == 2);
+        CHECK_FALSE(second.hasMore());
+        CHECK(second.components.back() == nestedCactus);
+
+        std::vector<string> paged = first.items;
+        paged.insert(paged.end(), second.items.begin(), second.items.end());
+        CHECK(paged == all);
+    }
+
+    SUBCASE("Offset pages match cursor pages")
+    {
+        ListingPage byOffset = fac->getMenuPage(3, 2);
+        ListingPage first = fac->getMenuPage(0, 3);
+        ListingPage byCursor = fac->continueMenuPage(first.nextCursor, 2);
+
+        CHECK(byOffset.items == byCursor.items);
+        CHECK(byOffset.components == byCursor.components);
+        CHECK(fac->getMenuPage(100, 5).items.empty());
+    }
+
+    SUBCASE("Cursors survive structural changes by offset")
+    {
+        ListingPage first = fac->getMenuPage(0, 2);
+        fac->createPlant("Rose");
+
+        ListingPage rest = fac->continueMenuPage(first.nextCursor, 100);
+        CHECK(rest.offset == 2);
+        CHECK(rest.items.size() == 5);
+    }
+
+    SUBCASE("A zero limit ends the listing")
+    {
+        ListingPage empty = fac->getMenuPage(0, 0);
+        CHECK(empty.items.empty());
+        CHECK_FALSE(empty.hasMore());
+        CHECK_FALSE(fac->getPlantGroupPage(0, 0).hasMore());
+
+        ListingPage first = fac->getMenuPage(0, 2);
+        CHECK_FALSE(fac->continueMenuPage(first.nextCursor, 0).hasMore());
+    }
+
+    SUBCASE("Listings paged side by side keep their own positions")
+    {
+        std::vector<string> all = fac->getMenuString();
+        ListingPage menuA = fac->getMenuPage(0, 2);
+        ListingPage menuB = fac->getMenuPage(0, 1);
+        ListingPage groups = fac->getPlantGroupPage(0, 1);
+        CHECK(menuA.nextCursor != menuB.nextCursor);
+
+        ListingPage restA = fac->continueMenuPage(menuA.nextCursor, 100);
+        ListingPage nextB = fac->continueMenuPage(menuB.nextCursor, 1);
+        ListingPage nextGroups = fac->continuePlantGroupPage(groups.nextCursor, 1);
+        REQUIRE(restA.items.size() == 4);
+        CHECK(restA.items.front() == all[2]);
+        REQUIRE(nextB.items.size() == 1);
+        CHECK(nextB.items.front() == all[1]);
+        CHECK(nextGroups.components.front() == groupB);
+
+        // The same cursor can be continued again, from the same place
+        CHECK(fac->continueMenuPage(menuB.nextCursor, 1).items == nextB.items);
+    }
+
+    SUBCASE("Plant group pages list top-level groups only")
+    {
+        ListingPage first = fac->getPlantGroupPage(0, 1);
+        REQUIRE(first.items.size() == 1);
+        CHECK(first.items[0] == "Plant Group 0");
+        CHECK(first.components[0] == groupA);
+        CHECK(first.hasMore());
+
+        ListingPage second = fac->continuePlantGroupPage(first.nextCursor, 1);
+        REQUIRE(second.items.size() == 1);
+        CHECK(second.items[0] == "Plant Group 1");
+        CHECK(second.components[0] == groupB);
+        CHECK_FALSE(second.hasMore());
+
+        CHECK(fac->getAllPlantGroups().size() == 2);
+    }
+
+    SUBCASE("Group contents pages and malformed cursors")
+    {
+        ListingPage contents = fac->getPlantGroupContentsPage(groupB, 0, 10);
+        REQUIRE(contents.items.size() == 1);
+        CHECK(contents.components[0] == nestedCactus);
+        CHECK(fac->getPlantGroupContentsPage(nullptr, 0, 10).items.empty());
+
+        CHECK(fac->continueMenuPage("not a cursor", 10).items.empty());
+        CHECK(fac->continuePlantGroupPage("", 10).items.empty());
+    }
+
+    delete fac;
+    delete Inventory::getInstance();
+}
+
+TEST_CASE("Testing nursery snapshots")
+{
+    NurseryFacade *fac = new NurseryFacade;
+    const std::string path = "nursery_snapshot_test.bin";
+
+    fac->createPlant("Rose");
+    fac->createPlant("Cactus");
+    fac->addStaff("Robin");
+    Customer *customer = fac->addCustomer("Jo");
+    fac->addToCustomerBasket(customer, fac->createPlant("Lavender"));
+
+    std::vector<std::string> menu = fac->getMenuString();
+    std::vector<std::string> basket = fac->getCustomerBasketString(customer);
+    REQUIRE(fac->saveSnapshot(path));
+
+    fac->createPlant("Pine Tree");
+    REQUIRE(fac->loadSnapshot(path));
+
+    CHECK(fac->getMenuString() == menu);
+    Customer *restored = fac->addCustomer("Jo");
+    REQUIRE(restored != nullptr);
+    CHECK(fac->getCustomerBasketString(restored) == basket);
+    CHECK(Inventory::getInstance()->getCustomers()->size() == 1);
+    CHECK(fac->askForSuggestion(restored) != "");
+
+    CHECK_FALSE(fac->loadSnapshot("missing_snapshot_test.bin"));
+    CHECK(fac->getMenuString() == menu);
+
+    std::remove(path.c_str());
+    delete fac;
+    delete Inventory::getInstance();
+}
+
+TEST_CASE("Testing nursery crash recovery")
+{
+    NurseryFacade *fac = new NurseryFacade;
+    const std::string snapshotPath = "nursery_recovery_snapshot.bin";
+    const std::string journalPath = "nursery_recovery_journal.bin";
+    std::remove(journalPath.c_str());
+
+    fac->createPlant("Rose");
+    REQUIRE(fac->enableJournal(journalPath, InventoryJournal::SyncPolicy::EVERY_RECORD));
+    REQUIRE(fac->saveSnapshot(snapshotPath));
+
+    fac->createPlant("Cactus");
+    PlantGroup *group = fac->createPlantGroup("Display");
+    fac->addComponentToGroup(fac->getInventoryRoot(), group);
+    fac->addComponentToGroup(group, fac->createPlantGroup("Shelf"));
+    fac->addStaff("Robin");
+    Customer *customer = fac->addCustomer("Jo");
+    fac->addToCustomerBasket(customer, fac->createPlant("Lavender"));
+    PlantComponent *removed = fac->findPlant(0);
+    fac->removeComponentFromInventory(removed);
+    delete removed->getDecorator();
+
+    std::vector<std::string> menu = fac->getMenuString();
+    std::vector<std::string> basket = fac->getCustomerBasketString(customer);
+    size_t rootSize = Inventory::getInstance()->getInventory()->getPlants()->size();
+
+    // Simulate a crash: the in-memory nursery is lost, the files survive
+    delete fac;
+    delete Inventory::getInstance();
+
+    fac = new NurseryFacade;
+    REQUIRE(fac->recover(snapshotPath, journalPath));
+    CHECK(fac->getMenuString() == menu);
+    CHECK(Inventory::getInstance()->getInventory()->getPlants()->size() == rootSize);
+    CHECK(Inventory::getInstance()->getStaff()->size() == 1);
+    Customer *restored = fac->addCustomer("Jo");
+    CHECK(fac->getCustomerBasketString(restored) == basket);
+    CHECK(fac->askForSuggestion(restored) != "");
+
+    CHECK(fac->commitJournal());
+    CHECK_FALSE(fac->recover(snapshotPath, snapshotPath));
+
+    std::remove(snapshotPath.c_str());
+    std::remove(journalPath.c_str());
+    delete fac;
+    delete Inventory::getInstance();
+}